@@ -323,6 +323,29 @@ static_cast<void>(position);
 static_cast<void>(position);
 }
 
+{
+/* [BatchTrackView-usage] */
+/* Rotations of three joints at four keyframes, keyframe-major */
+const Float keys[]{0.0f, 0.5f, 1.0f, 1.5f};
+const Quaternion rotations[]{
+    Quaternion{}, Quaternion{}, Quaternion{},
+    Quaternion::rotation(15.0_degf, Vector3::xAxis()), Quaternion{}, Quaternion{},
+    Quaternion::rotation(30.0_degf, Vector3::xAxis()), Quaternion{}, Quaternion{},
+    Quaternion::rotation(45.0_degf, Vector3::xAxis()), Quaternion{}, Quaternion{}
+};
+Animation::BatchTrackView<Float, Quaternion> joints{keys, rotations, 3,
+    Animation::Interpolation::Linear};
+
+Quaternion jointRotations[3];
+std::size_t hint = 0;
+joints.at(0.75f, hint, jointRotations);
+/* [BatchTrackView-usage] */
+
+/* [BatchTrackView-performance] */
+joints.at<Math::slerp>(0.75f, hint, jointRotations);
+/* [BatchTrackView-performance] */
+}
+
 {
 /* [Track-performance-cache] */
 struct Keyframe {
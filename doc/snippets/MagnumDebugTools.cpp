@@ -30,6 +30,10 @@
 #include <Magnum/DebugTools/CompareImage.h>
 #include <Magnum/DebugTools/ResourceManager.h>
 #include <Magnum/DebugTools/ObjectRenderer.h>
+#ifndef MAGNUM_TARGET_GLES2
+#include <Magnum/DebugTools/RendererBatch.h>
+#endif
+#include <Magnum/SceneGraph/Camera.h>
 #include <Magnum/SceneGraph/Drawable.h>
 #include <Magnum/SceneGraph/Object.h>
 #include <Magnum/SceneGraph/MatrixTransformation3D.h>
@@ -111,4 +115,23 @@ DebugTools::ResourceManager::instance().set("my",
 new DebugTools::ObjectRenderer3D{*object, "my", &debugDrawables};
 /* [debug-tools-renderers] */
 }
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+std::vector<SceneGraph::Object<SceneGraph::MatrixTransformation3D>*> objects;
+SceneGraph::Camera3D* camera{};
+DebugTools::ResourceManager manager;
+/* [RendererBatch] */
+DebugTools::RendererBatch3D batch;
+SceneGraph::DrawableGroup3D debugDrawables;
+
+// Attach the renderers to the batch
+for(SceneGraph::Object<SceneGraph::MatrixTransformation3D>* object: objects)
+    new DebugTools::ObjectRenderer3D{*object, batch, {}, &debugDrawables};
+
+// Draw all of them using a single draw call
+batch.draw(*camera, debugDrawables);
+/* [RendererBatch] */
+}
+#endif
 }
@@ -23,6 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <vector>
+
 #include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
@@ -33,10 +36,13 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/PixelFormat.h"
 #include "Magnum/GL/Renderer.h"
 #include "Magnum/GL/Renderbuffer.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
+#include "Magnum/GL/StreamingBuffer.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/GL/Version.h"
@@ -75,6 +81,7 @@
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
+#include "Magnum/GL/DrawCommandList.h"
 #include "Magnum/GL/RectangleTexture.h"
 #endif
 
@@ -1271,6 +1278,95 @@ q.endConditionalRender();
 #endif
 #endif
 
+{
+/* [ShaderProgramCache-usage] */
+GL::ShaderProgramCache cache{"/home/user/.cache/myapp/shaders"};
+
+/* Compiled from sources and saved on the first run, loaded on next runs */
+Shaders::Phong phong;
+
+Debug{} << cache.hits() << "hits," << cache.misses() << "misses";
+/* [ShaderProgramCache-usage] */
+}
+
+#ifndef MAGNUM_TARGET_GLES
+{
+struct MyShader: GL::AbstractShaderProgram {
+/* [ShaderProgramCache-subclassing] */
+explicit MyShader() {
+    GL::Shader vert{GL::Version::GL430, GL::Shader::Type::Vertex};
+    GL::Shader frag{GL::Version::GL430, GL::Shader::Type::Fragment};
+    vert.addFile("MyShader.vert");
+    frag.addFile("MyShader.frag");
+
+    std::string key;
+    if(!GL::ShaderProgramCache::loadCurrent(*this, {vert, frag}, key)) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+        attachShaders({vert, frag});
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+        GL::ShaderProgramCache::saveCurrent(*this, key);
+    }
+}
+/* [ShaderProgramCache-subclassing] */
+};
+}
+#endif
+
+{
+struct Particle {
+    Vector3 position;
+    Color3 color;
+};
+std::vector<Particle> particles;
+GL::Mesh mesh;
+Shaders::Phong shader;
+/* [StreamingBuffer-usage] */
+/* Space for 64k particles in each of three frames in flight */
+GL::StreamingBuffer buffer{65536*sizeof(Particle)};
+
+/* Each frame, allocate the data, write them and point the mesh to them */
+std::pair<GLintptr, Containers::ArrayView<char>> data =
+    buffer.allocate(particles.size()*sizeof(Particle));
+std::copy(particles.begin(), particles.end(),
+    reinterpret_cast<Particle*>(data.second.data()));
+buffer.flush();
+
+mesh.setCount(particles.size())
+    .addVertexBuffer(buffer.buffer(), data.first,
+        GL::Attribute<0, Vector3>{}, GL::Attribute<1, Color3>{});
+mesh.draw(shader);
+
+/* At the end of the frame, after all draws */
+buffer.nextFrame();
+/* [StreamingBuffer-usage] */
+}
+
+#ifndef MAGNUM_TARGET_GLES
+{
+struct Part {
+    Int indexOffset, indexCount;
+};
+std::vector<Part> parts;
+GL::Mesh mesh;
+Shaders::Phong shader;
+/* [DrawCommandList-usage] */
+/* All parts share the vertex and index buffer of a single mesh, each part
+   uses its own per-instance transformation selected by the base instance */
+GL::DrawCommandList commands{mesh};
+for(std::size_t i = 0; i != parts.size(); ++i) {
+    GL::MeshView view{mesh};
+    view.setCount(parts[i].indexCount)
+        .setIndexRange(parts[i].indexOffset)
+        .setBaseInstance(i);
+    commands.add(view);
+}
+
+/* Each frame, draw all parts in a single call */
+commands.draw(shader);
+/* [DrawCommandList-usage] */
+}
+#endif
+
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
 {
 char data[1]{};
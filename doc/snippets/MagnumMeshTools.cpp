@@ -27,12 +27,15 @@
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/MeshTools/Compile.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateFlatNormals.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/OptimizeMesh.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/MeshData3D.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -128,6 +131,14 @@ auto data = MeshTools::interleave(positions, weights, 2, vertexColors, 1);
 /* [interleave2] */
 }
 
+{
+/* [optimizeMesh] */
+Trade::MeshData3D meshData{MeshPrimitive::Triangles, {}, {{}}, {}, {}, {}};
+MeshTools::optimizeMesh(meshData);
+GL::Mesh mesh = MeshTools::compile(meshData);
+/* [optimizeMesh] */
+}
+
 {
 /* [removeDuplicates1] */
 std::vector<UnsignedInt> indices;
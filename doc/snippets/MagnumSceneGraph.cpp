@@ -202,6 +202,20 @@ o.addFeature<MyFeature>(some, params);
 }
 }
 
+{
+SceneGraph::Camera3D* camera{};
+SceneGraph::DrawableGroup3D drawables;
+/* [Scene-setFlatTransformationCache] */
+Scene3D scene;
+scene.setFlatTransformationCache(true);
+
+// populate the scene with many objects ...
+
+// only the changed subtrees get recalculated in each draw
+camera->draw(drawables);
+/* [Scene-setFlatTransformationCache] */
+}
+
 {
 /* [construction-order] */
 {
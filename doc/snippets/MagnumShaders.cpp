@@ -101,6 +101,23 @@ mesh.draw(visualizerShader);
 /* [shaders-meshvisualizer] */
 }
 
+{
+/* [shaders-async] */
+/* Submit all variants first so the driver can compile them in parallel */
+Shaders::Phong::CompileState phongState = Shaders::Phong::compile({}, 3);
+Shaders::Flat3D::CompileState flatState = Shaders::Flat3D::compile(
+    Shaders::Flat3D::Flag::Textured);
+
+/* Do other work, such as loading the data, until the shaders are done */
+while(!phongState.isLinkFinished() || !flatState.isLinkFinished()) {
+    // ...
+}
+
+Shaders::Phong phong{std::move(phongState)};
+Shaders::Flat3D flat{std::move(flatState)};
+/* [shaders-async] */
+}
+
 {
 /* [DistanceFieldVector-usage1] */
 struct Vertex {
@@ -203,6 +220,37 @@ mesh.draw(shader);
 /* [Flat-usage-textured2] */
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+{
+GL::Mesh mesh;
+Matrix4 projectionMatrix;
+/* [Flat-usage-instancing] */
+struct Instance {
+    Matrix4 transformation;
+    Color3 color;
+};
+Instance instanceData[]{
+    {Matrix4::translation({1.0f, 2.0f, 0.0f}), 0xff3366_rgbf},
+    {Matrix4::translation({2.0f, 1.0f, 0.0f}), 0xffcc33_rgbf},
+    {Matrix4::translation({3.0f, 0.0f, 1.0f}), 0x3366ff_rgbf},
+    // ...
+};
+
+GL::Buffer instances;
+instances.setData(instanceData, GL::BufferUsage::StaticDraw);
+mesh.setInstanceCount(Containers::arraySize(instanceData))
+    .addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Flat3D::TransformationMatrix{},
+        Shaders::Flat3D::Color3{});
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::VertexColor|
+                       Shaders::Flat3D::Flag::InstancedTransformation};
+shader.setTransformationProjectionMatrix(projectionMatrix);
+mesh.draw(shader);
+/* [Flat-usage-instancing] */
+}
+#endif
+
 {
 /* [MeshVisualizer-usage-geom1] */
 struct Vertex {
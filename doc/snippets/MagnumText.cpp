@@ -26,6 +26,8 @@
 #include "Magnum/Shaders/Vector.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/Text/DynamicGlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
 #include "Magnum/Text/Renderer.h"
 
 using namespace Magnum;
@@ -43,6 +45,28 @@ font->fillGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
 /* [DistanceFieldGlyphCache-usage] */
 }
 
+{
+Matrix3 projectionMatrix;
+Shaders::Vector2D shader;
+std::string message;
+/* [DynamicGlyphCache-usage] */
+std::unique_ptr<Text::AbstractFont> font;
+Text::DynamicGlyphCache cache{Vector2i{1024}, Vector2i{48}};
+Text::Renderer2D renderer{*font, cache, 0.15f};
+renderer.reserve(64, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+
+/* Every frame, rasterize glyphs that are not in the cache yet, lay out the
+   text and upload the new glyphs to the texture */
+cache.request(*font, message);
+renderer.render(message);
+cache.flush();
+
+shader.setTransformationProjectionMatrix(projectionMatrix)
+    .bindVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+/* [DynamicGlyphCache-usage] */
+}
+
 {
 /* [GlyphCache-usage] */
 std::unique_ptr<Text::AbstractFont> font;
@@ -97,4 +121,23 @@ renderer.mesh().draw(shader);
 /* [Renderer-usage2] */
 }
 
+{
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache{Vector2i{512}};
+/* [LayoutCache-usage] */
+/* Cache shared by all HUD labels */
+Text::LayoutCache layoutCache{512};
+
+Text::Renderer2D renderer{*font, cache, 0.15f};
+renderer.setLayoutCache(&layoutCache)
+    .reserve(16, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+
+/* Texts that were rendered before are taken from the cache */
+renderer.render("00:42");
+
+Debug{} << "Layout cache hits:" << layoutCache.hits()
+        << "misses:" << layoutCache.misses();
+/* [LayoutCache-usage] */
+}
+
 }
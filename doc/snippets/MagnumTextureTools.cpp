@@ -0,0 +1,54 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/Atlas.h"
+
+using namespace Magnum;
+
+int main() {
+
+{
+/* [AtlasPacker] */
+std::vector<Vector2i> sizes;
+std::vector<Vector2i> moreSizes;
+
+TextureTools::AtlasPacker packer{{1024, 1024}, {2, 2},
+    TextureTools::AtlasPackerFlag::AllowRotation};
+
+/* Place the initial set of textures */
+std::vector<Range2Di> ranges = packer.add(sizes);
+Debug{} << "Atlas is" << packer.occupancy()*100.0f << Debug::nospace << "% full";
+
+/* Later on, place more textures without moving the already placed ones */
+std::vector<Range2Di> moreRanges = packer.add(moreSizes);
+/* [AtlasPacker] */
+static_cast<void>(ranges);
+static_cast<void>(moreRanges);
+}
+
+}
@@ -86,6 +86,7 @@
 #  OpenGLTester                 - OpenGLTester class
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
+#  MeshBlobImporter             - Mesh blob importer plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -339,8 +340,8 @@ if(MAGNUM_BUILD_DEPRECATED)
 endif()
 set(_MAGNUM_PLUGIN_COMPONENT_LIST
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneImporter
-    MagnumFont MagnumFontConverter ObjImporter TgaImageConverter TgaImporter
-    WavAudioImporter)
+    MagnumFont MagnumFontConverter MeshBlobImporter ObjImporter
+    TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENT_LIST
     distancefieldconverter fontconverter imageconverter gl-info al-info)
 
@@ -365,10 +366,10 @@ if(MAGNUM_TARGET_GL)
     endif()
 endif()
 
-set(_MAGNUM_MeshTools_DEPENDENCIES )
+set(_MAGNUM_MeshTools_DEPENDENCIES Trade)
 if(MAGNUM_TARGET_GL)
-    # Trade is used only in compile(), which needs GL as well
-    list(APPEND _MAGNUM_MeshTools_DEPENDENCIES Trade GL)
+    # GL is used only in compile()
+    list(APPEND _MAGNUM_MeshTools_DEPENDENCIES GL)
 endif()
 
 set(_MAGNUM_OpenGLTester_DEPENDENCIES GL)
@@ -844,7 +845,14 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         elseif(_component STREQUAL Primitives)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-        # No special setup for SceneGraph library
+        # SceneGraph library
+        elseif(_component STREQUAL SceneGraph)
+            if(MAGNUM_BUILD_MULTITHREADED)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
+
         # No special setup for Shaders library
         # No special setup for Shapes library
 
@@ -856,6 +864,11 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # TextureTools library
         elseif(_component STREQUAL TextureTools)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Atlas.h)
+            if(MAGNUM_BUILD_MULTITHREADED)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
 
         # Trade library
         elseif(_component STREQUAL Trade)
@@ -876,7 +889,15 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnySceneImporter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
-        # No special setup for ObjImporter plugin
+        # No special setup for MeshBlobImporter plugin
+
+        # ObjImporter plugin dependencies
+        if(_component STREQUAL ObjImporter AND MAGNUM_BUILD_MULTITHREADED)
+            find_package(Threads REQUIRED)
+            set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
+        endif()
+
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
         # No special setup for WavAudioImporter plugin
@@ -46,6 +46,7 @@ cmake .. ^
     -DWITH_ANYSCENEIMPORTER=OFF ^
     -DWITH_MAGNUMFONT=OFF ^
     -DWITH_MAGNUMFONTCONVERTER=OFF ^
+    -DWITH_MESHBLOBIMPORTER=OFF ^
     -DWITH_OBJIMPORTER=OFF ^
     -DWITH_TGAIMAGECONVERTER=OFF ^
     -DWITH_TGAIMPORTER=OFF ^
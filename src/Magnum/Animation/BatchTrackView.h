@@ -0,0 +1,370 @@
+#ifndef Magnum_Animation_BatchTrackView_h
+#define Magnum_Animation_BatchTrackView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::BatchTrackView
+ */
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    /* Wraps an interpolator function template parameter in a function object
+       so BatchTrackView::atInternal() can inline it */
+    template<class V, class R, R(*interpolator)(const V&, const V&, Float)> struct InlineInterpolator {
+        R operator()(const V& a, const V& b, Float t) const {
+            return interpolator(a, b, t);
+        }
+    };
+}
+
+/**
+@brief Batch animation track view
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+
+A non-owning view onto a set of tracks that share the same keyframe times,
+such as joint transformations of a skinned mesh or a crowd. Compared to having
+a separate @ref TrackView for each of them, the keys are stored just once and
+the values are stored keyframe-major --- all values of the first keyframe
+followed by all values of the second keyframe etc. Evaluation for given time
+then does the keyframe search and calculates the interpolation factor just
+once and interpolates all tracks in a single loop over two contiguous arrays,
+writing the results into a contiguous output array:
+
+@snippet MagnumAnimation.cpp BatchTrackView-usage
+
+@section Animation-BatchTrackView-performance Performance tuning
+
+The @ref at(K, std::size_t&, const Containers::ArrayView<R>&) const function
+calls the interpolator through a function pointer for each value, which
+prevents the compiler from vectorizing the loop. If the interpolator is known
+at compile time, pass it as a template parameter to make it inlineable:
+
+@snippet MagnumAnimation.cpp BatchTrackView-performance
+
+The same keyframe hinting and strict interpolation as described in
+@ref Animation-Track-performance applies here as well. The batch track can
+also be added to a @ref Player using
+@ref Player::add(const BatchTrackView<K, V, R>&, const Containers::ArrayView<R>&).
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class BatchTrackView: public TrackViewStorage<K> {
+    public:
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef ResultType(*Interpolator)(const ValueType&, const ValueType&, Float);
+
+        /**
+         * @brief Construct an empty batch track
+         *
+         * The @ref keys(), @ref values() and @ref interpolator() functions
+         * return @cpp nullptr @ce, @ref trackCount() is @cpp 0 @ce.
+         */
+        /*implicit*/ BatchTrackView() noexcept {}
+
+        /**
+         * @brief Construct with both generic and custom interpolator
+         * @param keys          Frame keys
+         * @param values        Frame values for all tracks, keyframe-major
+         * @param trackCount    Track count
+         * @param interpolation Interpolation behavior
+         * @param interpolator  Interpolator function
+         * @param before        Extrapolation behavior before
+         * @param after         Extrapolation behavior after
+         *
+         * The keyframe data are assumed to be stored in sorted order. It's not
+         * an error to have two successive keyframes with the same frame value.
+         * Expects that size of @p values is size of @p keys multiplied by
+         * @p trackCount, value of track @f$ j @f$ at keyframe @f$ i @f$ being
+         * at index @f$ i n + j @f$, where @f$ n @f$ is @p trackCount.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolation interpolation, Interpolator interpolator, Extrapolation before, Extrapolation after) noexcept:
+            /* The per-keyframe stride of the values encodes the track count,
+               so the type-erased storage is enough to describe the batch */
+            TrackViewStorage<K>{keys, Containers::StridedArrayView<const V>(values.data(), keys.size(), trackCount*sizeof(V)), interpolation, interpolator, before, after}
+        {
+            CORRADE_ASSERT(values.size() == keys.size()*trackCount,
+                "Animation::BatchTrackView: expected" << keys.size()*trackCount << "values for" << keys.size() << "keys and" << trackCount << "tracks but got" << values.size(), );
+        }
+
+        /** @overload
+         * Equivalent to calling @ref BatchTrackView(const Containers::StridedArrayView<const K>&, Containers::ArrayView<const V>, std::size_t, Interpolation, Interpolator, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolation interpolation, Interpolator interpolator, Extrapolation extrapolation = Extrapolation::Extrapolated) noexcept: BatchTrackView<K, V, R>{keys, values, trackCount, interpolation, interpolator, extrapolation, extrapolation} {}
+
+        /**
+         * @brief Construct with custom interpolator
+         *
+         * Equivalent to calling @ref BatchTrackView(const Containers::StridedArrayView<const K>&, Containers::ArrayView<const V>, std::size_t, Interpolation, Interpolator, Extrapolation, Extrapolation)
+         * with @p interpolation set to @ref Interpolation::Custom.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolator interpolator, Extrapolation before, Extrapolation after) noexcept: BatchTrackView<K, V, R>{keys, values, trackCount, Interpolation::Custom, interpolator, before, after} {}
+
+        /** @overload
+         * Equivalent to calling @ref BatchTrackView(const Containers::StridedArrayView<const K>&, Containers::ArrayView<const V>, std::size_t, Interpolator, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolator interpolator, Extrapolation extrapolation = Extrapolation::Extrapolated) noexcept: BatchTrackView<K, V, R>{keys, values, trackCount, Interpolation::Custom, interpolator, extrapolation, extrapolation} {}
+
+        /**
+         * @brief Construct with generic interpolation behavior
+         *
+         * Equivalent to calling @ref BatchTrackView(const Containers::StridedArrayView<const K>&, Containers::ArrayView<const V>, std::size_t, Interpolation, Interpolator, Extrapolation, Extrapolation)
+         * with @p interpolator autodetected from @p interpolation using
+         * @ref interpolatorFor(). See its documentation for more information.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolation interpolation, Extrapolation before, Extrapolation after) noexcept: BatchTrackView<K, V, R>{keys, values, trackCount, interpolation, interpolatorFor<V, R>(interpolation), before, after} {}
+
+        /** @overload
+         * Equivalent to calling @ref BatchTrackView(const Containers::StridedArrayView<const K>&, Containers::ArrayView<const V>, std::size_t, Interpolation, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        explicit BatchTrackView(const Containers::StridedArrayView<const K>& keys, Containers::ArrayView<const V> values, std::size_t trackCount, Interpolation interpolation, Extrapolation extrapolation = Extrapolation::Extrapolated) noexcept: BatchTrackView<K, V, R>{keys, values, trackCount, interpolation, interpolatorFor<V, R>(interpolation), extrapolation, extrapolation} {}
+
+        /** @brief Track count */
+        std::size_t trackCount() const {
+            return std::size_t(TrackViewStorage<K>::_values.stride())/sizeof(V);
+        }
+
+        /**
+         * @brief Interpolation function
+         *
+         * @see @ref interpolation()
+         */
+        Interpolator interpolator() const {
+            return reinterpret_cast<Interpolator>(TrackViewStorage<K>::_interpolator);
+        }
+
+        /**
+         * @brief Value data
+         *
+         * Values of all tracks, keyframe-major. Size is @ref size()
+         * multiplied by @ref trackCount().
+         * @see @ref keys(), @ref values(std::size_t) const
+         */
+        Containers::ArrayView<const V> values() const {
+            return {valueData(0), TrackViewStorage<K>::_keys.size()*trackCount()};
+        }
+
+        /**
+         * @brief Values of given keyframe
+         *
+         * Size of the returned view is @ref trackCount().
+         * @see @ref keys(), @ref values() const
+         */
+        Containers::ArrayView<const V> values(std::size_t keyframe) const {
+            CORRADE_ASSERT(keyframe < TrackViewStorage<K>::_keys.size(),
+                "Animation::BatchTrackView::values(): keyframe" << keyframe << "out of range for" << TrackViewStorage<K>::_keys.size() << "keyframes", {});
+            return {valueData(keyframe), trackCount()};
+        }
+
+        /**
+         * @brief Animated values at a given time
+         *
+         * Equivalent to calling @ref at(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * with a zero hint.
+         */
+        void at(K frame, const Containers::ArrayView<R>& output) const {
+            std::size_t hint{};
+            at(interpolator(), frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time
+         *
+         * Finds the keyframe pair around @p frame and interpolates values of
+         * all tracks into @p output, which is expected to have
+         * @ref trackCount() items. The keyframe search, extrapolation and
+         * @p hint handling is the same as in @ref interpolate(), see its
+         * documentation for more information.
+         * @see @ref atStrict(K, std::size_t&, const Containers::ArrayView<R>&) const
+         */
+        void at(K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            at(interpolator(), frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time
+         *
+         * Unlike @ref at(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * uses @p interpolator, overriding the interpolator function set in
+         * constructor.
+         */
+        void at(Interpolator interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            atInternal(interpolator, frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time with a compile-time interpolator
+         *
+         * Unlike @ref at(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * uses @p interpolator passed as a template parameter, overriding the
+         * interpolator function set in constructor. That allows the compiler
+         * to inline it and vectorize the interpolation loop.
+         */
+        template<R(*interpolator)(const V&, const V&, Float)> void at(K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            atInternal(Implementation::InlineInterpolator<V, R, interpolator>{}, frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time
+         *
+         * A faster version of @ref at(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * with implicit @ref Extrapolation::Extrapolated behavior, expecting
+         * at least two keyframes. See @ref interpolateStrict() for more
+         * information.
+         */
+        void atStrict(K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            atStrict(interpolator(), frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time
+         *
+         * Unlike @ref atStrict(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * uses @p interpolator, overriding the interpolator function set in
+         * constructor.
+         */
+        void atStrict(Interpolator interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            atStrictInternal(interpolator, frame, hint, output);
+        }
+
+        /**
+         * @brief Animated values at a given time with a compile-time interpolator
+         *
+         * Unlike @ref atStrict(K, std::size_t&, const Containers::ArrayView<R>&) const
+         * uses @p interpolator passed as a template parameter, overriding the
+         * interpolator function set in constructor. That allows the compiler
+         * to inline it and vectorize the interpolation loop.
+         */
+        template<R(*interpolator)(const V&, const V&, Float)> void atStrict(K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+            atStrictInternal(Implementation::InlineInterpolator<V, R, interpolator>{}, frame, hint, output);
+        }
+
+    private:
+        const V* valueData(std::size_t keyframe) const {
+            return TrackViewStorage<K>::_keys.empty() ? nullptr : &reinterpret_cast<const Containers::StridedArrayView<const V>&>(TrackViewStorage<K>::_values)[keyframe];
+        }
+
+        /* The same as interpolate(), except that it operates on a batch */
+        template<class I> void atInternal(I interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const;
+
+        /* The same as interpolateStrict(), except that it operates on a
+           batch */
+        template<class I> void atStrictInternal(I interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const;
+
+        /* The actual loop, kept separate so it's small enough to get
+           vectorized */
+        template<class I> static void interpolateBatch(I interpolator, const V* a, const V* b, Float t, const Containers::ArrayView<R>& output) {
+            R* const out = output.data();
+            for(std::size_t i = 0, size = output.size(); i != size; ++i)
+                out[i] = interpolator(a[i], b[i], t);
+        }
+};
+
+template<class K, class V, class R> template<class I> void BatchTrackView<K, V, R>::atInternal(I interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+    const std::size_t trackCount = this->trackCount();
+    CORRADE_ASSERT(output.size() == trackCount,
+        "Animation::BatchTrackView::at(): expected output size" << trackCount << "but got" << output.size(), );
+
+    const Containers::StridedArrayView<const K>& keys = TrackViewStorage<K>::_keys;
+    const Extrapolation before = TrackViewStorage<K>::_before;
+    const Extrapolation after = TrackViewStorage<K>::_after;
+
+    /* No data, fill with default-constructed values */
+    if(!keys.size()) {
+        for(R& i: output) i = R{};
+        return;
+    }
+
+    /* Only one frame, return it verbatim (or default-constructed, if
+       desired) */
+    if(keys.size() == 1) {
+        if((frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
+           (frame > keys[0] && after == Extrapolation::DefaultConstructed)) {
+            for(R& i: output) i = R{};
+            return;
+        }
+
+        interpolateBatch(interpolator, valueData(0), valueData(0), 0.0f, output);
+        return;
+    }
+
+    /* Find a pair of keys that is around given time */
+    Implementation::findKeyframe(keys, frame, hint);
+
+    /* Special extrapolation outside of range. Usual extrapolation is handled
+       below. */
+    if(frame < keys[hint]) {
+        if(before == Extrapolation::DefaultConstructed) {
+            for(R& i: output) i = R{};
+            return;
+        }
+        if(before == Extrapolation::Constant) frame = keys[hint];
+    } else if(!(frame < keys[hint + 1])) {
+        if(after == Extrapolation::DefaultConstructed) {
+            for(R& i: output) i = R{};
+            return;
+        }
+        if(after == Extrapolation::Constant) frame = keys[hint + 1];
+    }
+
+    interpolateBatch(interpolator, valueData(hint), valueData(hint + 1),
+        Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)), output);
+}
+
+template<class K, class V, class R> template<class I> void BatchTrackView<K, V, R>::atStrictInternal(I interpolator, K frame, std::size_t& hint, const Containers::ArrayView<R>& output) const {
+    const Containers::StridedArrayView<const K>& keys = TrackViewStorage<K>::_keys;
+    CORRADE_ASSERT(keys.size() >= 2, "Animation::BatchTrackView::atStrict(): at least two keyframes required", );
+    CORRADE_ASSERT(output.size() == trackCount(),
+        "Animation::BatchTrackView::atStrict(): expected output size" << trackCount() << "but got" << output.size(), );
+
+    /* Find a pair of keys that is around given time */
+    Implementation::findKeyframe(keys, frame, hint);
+
+    interpolateBatch(interpolator, valueData(hint), valueData(hint + 1),
+        Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)), output);
+}
+
+}}
+
+#endif
@@ -175,9 +175,10 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, Extrapolation value);
 @param frame        Frame at which to interpolate
 @param hint         Hint for keyframe search
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value.
+Searches the keyframes for last keyframe which is not larger than @p frame.
+Once the keyframe is found, reference to it and the immediately following
+keyframe is passed to @p interpolator along with calculated interpolation
+factor, returning the interpolated value.
 
 -   In case the first keyframe is already larger than @p frame or @p frame is
     larger or equal to the last keyframe, either the first two or last two
@@ -187,9 +188,12 @@ calculated interpolation factor, returning the interpolated value.
     the interpolator.
 -   In case no keyframes are present, default-constructed value is returned.
 
-The @p hint parameter hints where to start the linear search and is updated
-with keyframe index matching @p frame. If @p frame is earlier than @p hint, the
-search is restarted from the beginning.
+The @p hint parameter hints where to start the search and is updated with
+keyframe index matching @p frame. If the matching keyframe is only a few
+keyframes before or after @p hint, it's found by stepping from it, which makes
+both forward and reverse playback constant-time. Otherwise a binary search is
+done, so random access into the track is @f$ \mathcal{O}(\log n) @f$. If
+@p hint is out of bounds, the whole track is searched.
 
 Used internally from @ref Track::at() / @ref TrackView::at(), see @ref Track
 documentation for more information.
@@ -203,12 +207,12 @@ template<class K, class V, class R = ResultOf<V>> R interpolate(const Containers
 /**
 @brief Interpolate animation value with strict constraints
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value. The @p hint
-parameter hints where to start the linear search and is updated with keyframe
-index matching @p frame. If @p frame is earlier than @p hint, the search is
-restarted from the beginning.
+Searches the keyframes for last keyframe which is not larger than @p frame.
+Once the keyframe is found, reference to it and the immediately following
+keyframe is passed to @p interpolator along with calculated interpolation
+factor, returning the interpolated value. The @p hint parameter hints where to
+start the search and is updated with keyframe index matching @p frame, see
+@ref interpolate() for details about the search.
 
 This is a stricter but more performant version of @ref interpolate() with
 implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
@@ -363,6 +367,49 @@ template<class T> struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<T>, T> {
 
 }
 
+namespace Implementation {
+
+/* How many keyframes to step linearly from the hint before switching to
+   a binary search */
+enum: std::size_t { KeyframeSearchSteps = 4 };
+
+/* Updates hint to the last keyframe in [0, keys.size() - 2] that's not larger
+   than frame (or 0 if there's none). First tries to step a few keyframes from
+   the hint in either direction, which handles forward and reverse playback
+   in constant time, and switches to a binary search if the hint misses by
+   more, which makes random access logarithmic instead of linear. Expects at
+   least two keys. */
+template<class K> void findKeyframe(const Containers::StridedArrayView<const K>& keys, const K& frame, std::size_t& hint) {
+    const std::size_t last = keys.size() - 2;
+
+    /* Search range for the binary search, the result is always inside */
+    std::size_t begin = 0, end = last;
+    if(hint <= last) {
+        if(frame < keys[hint]) {
+            for(std::size_t i = 0; i != KeyframeSearchSteps && hint; ++i)
+                if(!(frame < keys[--hint])) return;
+            if(!hint) return;
+            end = hint - 1;
+        } else {
+            for(std::size_t i = 0; i != KeyframeSearchSteps; ++i) {
+                if(hint == last || frame < keys[hint + 1]) return;
+                ++hint;
+            }
+            begin = hint;
+        }
+    }
+
+    while(begin < end) {
+        const std::size_t middle = begin + (end - begin + 1)/2;
+        if(frame < keys[middle]) end = middle - 1;
+        else begin = middle;
+    }
+
+    hint = begin;
+}
+
+}
+
 /* Needs to be defined later so it can pick up the TypeTraits definitions */
 template<class V, class R> auto interpolatorFor(Interpolation interpolation) -> R(*)(const V&, const V&, Float) {
     return Implementation::TypeTraits<V, R>::interpolator(interpolation);
@@ -383,12 +430,8 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
         return interpolator(values[0], values[0], 0.0f);
     }
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    Implementation::findKeyframe(keys, frame, hint);
 
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
@@ -408,12 +451,8 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    Implementation::findKeyframe(keys, frame, hint);
 
     return interpolator(values[hint], values[hint + 1],
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
@@ -32,7 +32,7 @@
 #include <chrono>
 #include <vector>
 
-#include "Magnum/Animation/Track.h"
+#include "Magnum/Animation/BatchTrackView.h"
 #include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace Animation {
@@ -174,10 +174,13 @@ never from @ref pause(), @ref stop() or any other API.
 
 For managing global application you can use @ref Timeline, @ref std::chrono
 APIs or any other type that supports basic arithmetic. The time doesn't have to
-be monotonic or have constant speed, but note that non-continuous and backward
-time jumps may have worse performance than going monotonically forward. See
-@ref Animation-Player-time-type "below" for more information about using
-different time types.
+be monotonic or have constant speed. The player remembers last used keyframe
+of each track and passes it as a hint to @ref TrackView::at(), so both forward
+and backward playback is done in constant time per track, while
+non-continuous time jumps (such as from @ref seekBy() / @ref seekTo()) fall
+back to a logarithmic binary search, see @ref Animation-Track-performance-hint
+for details. See @ref Animation-Player-time-type "below" for more information
+about using different time types.
 
 @snippet MagnumAnimation.cpp Player-usage-playback
 
@@ -407,6 +410,18 @@ template<class T, class K
         }
         #endif
 
+        /**
+         * @brief Add a batch track with a result destination
+         *
+         * The @p destination is expected to have
+         * @ref BatchTrackView::trackCount() items and is updated with new
+         * values after each call to @ref advance() as long as the animation
+         * is playing. Note that the @ref track() accessor returns only the
+         * type-erased @ref TrackViewStorage, which doesn't contain the
+         * value data.
+         */
+        template<class V, class R> Player<T, K>& add(const BatchTrackView<K, V, R>& track, const Containers::ArrayView<R>& destination);
+
         /**
          * @brief Add a track with a result callback
          *
@@ -790,6 +805,16 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
         }, &destination, nullptr, nullptr);
 }
 
+template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>::add(const BatchTrackView<K, V, R>& track, const Containers::ArrayView<R>& destination) {
+    CORRADE_ASSERT(destination.size() == track.trackCount(),
+        "Animation::Player::add(): expected destination size" << track.trackCount() << "but got" << destination.size(), *this);
+    return addInternal(track,
+        [](const TrackViewStorage<K>& track, K key, std::size_t& hint, void* destination, void(*)(), void*) {
+            const auto& batch = static_cast<const BatchTrackView<K, V, R>&>(track);
+            batch.at(key, hint, Containers::ArrayView<R>{static_cast<R*>(destination), batch.trackCount()});
+        }, destination.data(), nullptr, nullptr);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template<class T, class K> template<class V, class R, class Callback> Player<T, K>& Player<T, K>::addWithCallback(const TrackView<K, V, R>& track, Callback callback, void* userData) {
     auto callbackPtr = static_cast<void(*)(K, const R&, void*)>(callback);
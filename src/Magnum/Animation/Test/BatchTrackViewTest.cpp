@@ -0,0 +1,326 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/BatchTrackView.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct BatchTrackViewTest: TestSuite::Tester {
+    explicit BatchTrackViewTest();
+
+    void constructEmpty();
+    void constructInterpolator();
+    void constructInterpolation();
+    void constructInterpolationInterpolator();
+    void constructInvalidValueCount();
+    void constructCopyStorage();
+
+    void valuesKeyframeOutOfRange();
+
+    void at();
+    void atStrict();
+    void atTemplateInterpolator();
+    void atEmpty();
+    void atSingleKeyframe();
+    void atDifferentResultType();
+    void atInvalidOutputSize();
+};
+
+/* Reduced version from InterpolateTest, keep in sync with TrackViewTest. The
+   second track has all values doubled, so are the results. */
+const struct {
+    const char* name;
+    Extrapolation extrapolationBefore;
+    Extrapolation extrapolationAfter;
+    Float time;
+    Float expectedValue, expectedValueStrict;
+    std::size_t expectedHint;
+} AtData[] {
+    {"before default-constructed",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        -1.0f, 0.0f, 4.0f, 0},
+    {"before constant",
+        Extrapolation::Constant, Extrapolation::Extrapolated,
+        -1.0f, 3.0f, 4.0f, 0},
+    {"before extrapolated",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        -1.0f, 4.0f, 4.0f, 0},
+    {"during first",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        1.5f, 1.5f, 1.5f, 0},
+    {"during second",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        4.75f, 1.0f, 1.0f, 2},
+    {"after default-constructed",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        6.0f, 0.0f, -1.5f, 2},
+    {"after constant",
+        Extrapolation::Extrapolated, Extrapolation::Constant,
+        6.0f, 0.5f, -1.5f, 2},
+    {"after extrapolated",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        6.0f, -1.5f, -1.5f, 2}
+};
+
+BatchTrackViewTest::BatchTrackViewTest() {
+    addTests({&BatchTrackViewTest::constructEmpty,
+              &BatchTrackViewTest::constructInterpolator,
+              &BatchTrackViewTest::constructInterpolation,
+              &BatchTrackViewTest::constructInterpolationInterpolator,
+              &BatchTrackViewTest::constructInvalidValueCount,
+              &BatchTrackViewTest::constructCopyStorage,
+
+              &BatchTrackViewTest::valuesKeyframeOutOfRange});
+
+    addInstancedTests({&BatchTrackViewTest::at,
+                       &BatchTrackViewTest::atStrict,
+                       &BatchTrackViewTest::atTemplateInterpolator},
+                       Containers::arraySize(AtData));
+
+    addTests({&BatchTrackViewTest::atEmpty,
+              &BatchTrackViewTest::atSingleKeyframe,
+              &BatchTrackViewTest::atDifferentResultType,
+              &BatchTrackViewTest::atInvalidOutputSize});
+}
+
+const Float Keys[]{0.0f, 2.0f, 4.0f, 5.0f};
+const Float Values[]{
+    3.0f, 6.0f,
+    1.0f, 2.0f,
+    2.5f, 5.0f,
+    0.5f, 1.0f
+};
+
+void BatchTrackViewTest::constructEmpty() {
+    const BatchTrackView<Float, Vector3> a;
+
+    CORRADE_VERIFY(!a.interpolator());
+    CORRADE_COMPARE(a.duration(), Range1D{});
+    CORRADE_VERIFY(!a.size());
+    CORRADE_COMPARE(a.trackCount(), 0);
+    CORRADE_VERIFY(a.keys().empty());
+    CORRADE_VERIFY(a.values().empty());
+}
+
+void BatchTrackViewTest::constructInterpolator() {
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp, Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.duration(), (Range1D{0.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.trackCount(), 2);
+    CORRADE_COMPARE(a.keys().size(), 4);
+    CORRADE_COMPARE(a.keys()[2], 4.0f);
+    CORRADE_COMPARE(a.values().size(), 8);
+    CORRADE_COMPARE(a.values()[5], 5.0f);
+    CORRADE_COMPARE(a.values(2).size(), 2);
+    CORRADE_COMPARE(a.values(2)[0], 2.5f);
+    CORRADE_COMPARE(a.values(2)[1], 5.0f);
+}
+
+void BatchTrackViewTest::constructInterpolation() {
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Interpolation::Constant};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Constant);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.trackCount(), 2);
+}
+
+void BatchTrackViewTest::constructInterpolationInterpolator() {
+    /* Taking just the first two keys */
+    const BatchTrackView<Float, Float> a{Containers::StridedArrayView<const Float>{Keys, 2, sizeof(Float)}, Values, 4, Interpolation::Linear, Math::select, Extrapolation::Constant};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.before(), Extrapolation::Constant);
+    CORRADE_COMPARE(a.after(), Extrapolation::Constant);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.trackCount(), 4);
+    CORRADE_COMPARE(a.values(1)[3], 1.0f);
+}
+
+void BatchTrackViewTest::constructInvalidValueCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    BatchTrackView<Float, Float>{Keys, Values, 3, Math::lerp};
+    CORRADE_COMPARE(out.str(), "Animation::BatchTrackView: expected 12 values for 4 keys and 3 tracks but got 8\n");
+}
+
+void BatchTrackViewTest::constructCopyStorage() {
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp};
+    const TrackViewStorage<Float>& storage = a;
+    const TrackViewStorage<Float> b = storage;
+
+    /* The track count survives a type-erased copy */
+    const auto& c = static_cast<const BatchTrackView<Float, Float>&>(b);
+    CORRADE_COMPARE(c.trackCount(), 2);
+    CORRADE_COMPARE(c.values(3)[1], 1.0f);
+}
+
+void BatchTrackViewTest::valuesKeyframeOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp};
+    a.values(4);
+    CORRADE_COMPARE(out.str(), "Animation::BatchTrackView::values(): keyframe 4 out of range for 4 keyframes\n");
+}
+
+void BatchTrackViewTest::at() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp,
+        data.extrapolationBefore, data.extrapolationAfter};
+
+    Float out[2]{};
+    std::size_t hint{};
+    a.at(data.time, hint, out);
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+
+    Float out2[2]{};
+    a.at(data.time, out2);
+    CORRADE_COMPARE(out2[0], data.expectedValue);
+    CORRADE_COMPARE(out2[1], data.expectedValue*2.0f);
+}
+
+void BatchTrackViewTest::atStrict() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp,
+        data.extrapolationBefore, data.extrapolationAfter};
+
+    Float out[2]{};
+    std::size_t hint{};
+    a.atStrict(data.time, hint, out);
+    CORRADE_COMPARE(out[0], data.expectedValueStrict);
+    CORRADE_COMPARE(out[1], data.expectedValueStrict*2.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void BatchTrackViewTest::atTemplateInterpolator() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The interpolator set in the constructor should get ignored */
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::select,
+        data.extrapolationBefore, data.extrapolationAfter};
+
+    Float out[2]{};
+    std::size_t hint{};
+    a.at<Math::lerp>(data.time, hint, out);
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+
+    Float outStrict[2]{};
+    hint = 0;
+    a.atStrict<Math::lerp>(data.time, hint, outStrict);
+    CORRADE_COMPARE(outStrict[0], data.expectedValueStrict);
+    CORRADE_COMPARE(outStrict[1], data.expectedValueStrict*2.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void BatchTrackViewTest::atEmpty() {
+    const BatchTrackView<Float, Float> a{nullptr, nullptr, 0, Math::lerp};
+
+    std::size_t hint{};
+    a.at(1.0f, hint, nullptr);
+    CORRADE_COMPARE(hint, 0);
+}
+
+void BatchTrackViewTest::atSingleKeyframe() {
+    const Float keys[]{2.0f};
+    const Float values[]{3.0f, -1.0f, 7.0f};
+    const BatchTrackView<Float, Float> a{keys, values, 3, Math::lerp,
+        Extrapolation::DefaultConstructed, Extrapolation::Constant};
+
+    Float out[3]{};
+    a.at(3.0f, out);
+    CORRADE_COMPARE(out[0], 3.0f);
+    CORRADE_COMPARE(out[1], -1.0f);
+    CORRADE_COMPARE(out[2], 7.0f);
+
+    a.at(1.0f, out);
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 0.0f);
+    CORRADE_COMPARE(out[2], 0.0f);
+}
+
+using namespace Math::Literals;
+
+const Half HalfValues[]{
+    3.0_h, 6.0_h,
+    1.0_h, 2.0_h,
+    2.5_h, 5.0_h,
+    0.5_h, 1.0_h
+};
+
+Float lerpHalf(const Half& a, const Half& b, Float t) {
+    return Math::lerp(Float(a), Float(b), t);
+}
+
+void BatchTrackViewTest::atDifferentResultType() {
+    const BatchTrackView<Float, Half, Float> a{Keys, HalfValues, 2, lerpHalf};
+
+    Float out[2]{};
+    std::size_t hint{};
+    a.at(4.75f, hint, out);
+    CORRADE_COMPARE(out[0], 1.0f);
+    CORRADE_COMPARE(out[1], 2.0f);
+    CORRADE_COMPARE(hint, 2);
+}
+
+void BatchTrackViewTest::atInvalidOutputSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const BatchTrackView<Float, Float> a{Keys, Values, 2, Math::lerp};
+    Float output[3];
+    std::size_t hint{};
+    a.at(1.0f, hint, output);
+    a.atStrict(1.0f, hint, output);
+    CORRADE_COMPARE(out.str(),
+        "Animation::BatchTrackView::at(): expected output size 2 but got 3\n"
+        "Animation::BatchTrackView::atStrict(): expected output size 2 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::BatchTrackViewTest)
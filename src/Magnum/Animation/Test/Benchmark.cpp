@@ -25,6 +25,7 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Animation/BatchTrackView.h"
 #include "Magnum/Animation/Player.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
@@ -39,20 +40,32 @@ struct Benchmark: TestSuite::Tester {
     void atEmpty();
     void at();
     void atHint();
+    void atHintReverse();
+    void atHintRandomAccess();
     void atStrict();
     void atStrictInterleaved();
     void atStrictInterleavedDirectInterpolator();
 
+    void atManyTracks();
+    void atBatch();
+    void atBatchTemplateInterpolator();
+
     void playerAdvanceEmpty();
     void playerAdvanceEmptyTrack();
     void playerAdvance();
     void playerAdvanceCallback();
+    void playerAdvanceCallbackReverse();
+    void playerAdvanceCallbackRandomAccess();
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
 
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
     Containers::Array<std::pair<Float, Int>> _interleaved;
+    Containers::Array<Float> _randomFrames;
+    Containers::Array<Float> _batchValues;
+    Containers::Array<TrackView<Float, Float>> _manyTracks;
+    BatchTrackView<Float, Float> _batchTrack;
     Containers::StridedArrayView<const Float> _keysInterleaved;
     Containers::StridedArrayView<const Int> _valuesInterleaved;
     TrackView<Float, Int> _track;
@@ -60,7 +73,12 @@ struct Benchmark: TestSuite::Tester {
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t {
+        DataSize = 2000,
+        /* Keyframe and track count for the batch benchmarks */
+        BatchKeyCount = 100,
+        BatchTrackCount = 1000
+    };
 }
 
 Benchmark::Benchmark() {
@@ -71,14 +89,22 @@ Benchmark::Benchmark() {
                    &Benchmark::atEmpty,
                    &Benchmark::at,
                    &Benchmark::atHint,
+                   &Benchmark::atHintReverse,
+                   &Benchmark::atHintRandomAccess,
                    &Benchmark::atStrict,
                    &Benchmark::atStrictInterleaved,
                    &Benchmark::atStrictInterleavedDirectInterpolator,
 
+                   &Benchmark::atManyTracks,
+                   &Benchmark::atBatch,
+                   &Benchmark::atBatchTemplateInterpolator,
+
                    &Benchmark::playerAdvanceEmpty,
                    &Benchmark::playerAdvanceEmptyTrack,
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
+                   &Benchmark::playerAdvanceCallbackReverse,
+                   &Benchmark::playerAdvanceCallbackRandomAccess,
                    &Benchmark::playerAdvanceRawCallback,
                    &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
 
@@ -88,9 +114,32 @@ Benchmark::Benchmark() {
     for(std::size_t i = 0; i != DataSize; ++i)
         _keys[i] = _interleaved[i].first = Float(i)*3.1254f;
 
+    /* Frames spread randomly over the whole track duration, generated with
+       a LCG to be deterministic */
+    _randomFrames = Containers::Array<Float>{Containers::NoInit, 500};
+    UnsignedInt seed = 1;
+    for(Float& frame: _randomFrames) {
+        seed = seed*1103515245u + 12345u;
+        frame = Float((seed >> 8) % 0xffff)/Float(0xffff)*_keys[DataSize - 1];
+    }
+
     _keysInterleaved = {&_interleaved[0].first, _interleaved.size(), sizeof(std::pair<Float, Int>)};
     _valuesInterleaved = {&_interleaved[0].second, _interleaved.size(), sizeof(std::pair<Float, Int>)};
 
+    /* The same data once as many separate tracks (each track having its
+       values contiguous) and once as a single batch track (values
+       keyframe-major) */
+    _batchValues = Containers::Array<Float>{Containers::DirectInit, BatchKeyCount*BatchTrackCount, 1.0f};
+    _manyTracks = Containers::Array<TrackView<Float, Float>>{BatchTrackCount};
+    for(std::size_t i = 0; i != BatchTrackCount; ++i)
+        _manyTracks[i] = TrackView<Float, Float>{
+            Containers::StridedArrayView<const Float>{_keys.data(), BatchKeyCount, sizeof(Float)},
+            Containers::StridedArrayView<const Float>{_batchValues.data() + i*BatchKeyCount, BatchKeyCount, sizeof(Float)},
+            Math::lerp};
+    _batchTrack = BatchTrackView<Float, Float>{
+        Containers::StridedArrayView<const Float>{_keys.data(), BatchKeyCount, sizeof(Float)},
+        _batchValues, BatchTrackCount, Math::lerp};
+
     _track = TrackView<Float, Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
@@ -154,6 +203,26 @@ void Benchmark::atHint() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atHintReverse() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        for(Float i = 500.0f; i > 0.0f; i -= 1.0f)
+            result += _track.at(i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
+void Benchmark::atHintRandomAccess() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        for(Float i: _randomFrames)
+            result += _track.at(i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::atStrict() {
     Int result{};
     CORRADE_BENCHMARK(250) {
@@ -184,6 +253,47 @@ void Benchmark::atStrictInterleavedDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atManyTracks() {
+    Containers::Array<Float> out{Containers::ValueInit, BatchTrackCount};
+    Containers::Array<std::size_t> hints{BatchTrackCount};
+    Float result{};
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t& hint: hints) hint = 0;
+        for(Float i = 0.0f; i < 100.0f; i += 1.0f) {
+            for(std::size_t j = 0; j != BatchTrackCount; ++j)
+                out[j] = _manyTracks[j].at(i, hints[j]);
+            result += out[BatchTrackCount - 1];
+        }
+    }
+    CORRADE_COMPARE(result, 1000.0f);
+}
+
+void Benchmark::atBatch() {
+    Containers::Array<Float> out{Containers::ValueInit, BatchTrackCount};
+    Float result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float i = 0.0f; i < 100.0f; i += 1.0f) {
+            _batchTrack.at(i, hint, out);
+            result += out[BatchTrackCount - 1];
+        }
+    }
+    CORRADE_COMPARE(result, 1000.0f);
+}
+
+void Benchmark::atBatchTemplateInterpolator() {
+    Containers::Array<Float> out{Containers::ValueInit, BatchTrackCount};
+    Float result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float i = 0.0f; i < 100.0f; i += 1.0f) {
+            _batchTrack.at<Math::lerp>(i, hint, out);
+            result += out[BatchTrackCount - 1];
+        }
+    }
+    CORRADE_COMPARE(result, 1000.0f);
+}
+
 void Benchmark::playerAdvanceEmpty() {
     Player<Float> player;
     player.play(0.0f);
@@ -232,6 +342,34 @@ void Benchmark::playerAdvanceCallback() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceCallbackReverse() {
+    Int result{};
+    Player<Float> player;
+    player.addWithCallback(_track, [](Float, const Int& value, Int& result) {
+        result += value;
+    }, result)
+        .play({});
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 500.0f; i > 0.0f; i -= 1.0f)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
+void Benchmark::playerAdvanceCallbackRandomAccess() {
+    Int result{};
+    Player<Float> player;
+    player.addWithCallback(_track, [](Float, const Int& value, Int& result) {
+        result += value;
+    }, result)
+        .play({});
+    CORRADE_BENCHMARK(250) {
+        for(Float i: _randomFrames)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::playerAdvanceRawCallback() {
     Int result{};
     Player<Float> player;
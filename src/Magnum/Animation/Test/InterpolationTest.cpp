@@ -56,6 +56,7 @@ struct InterpolationTest: TestSuite::Tester {
 
     void interpolateHint();
     void interpolateStrictHint();
+    void interpolateHintSearch();
 
     void interpolateDifferentResultType();
     void interpolateStrictDifferentResultType();
@@ -144,6 +145,23 @@ const struct {
     {"out of bounds", 405780454}
 };
 
+const struct {
+    const char* name;
+    std::size_t hint;
+    Float frame;
+    std::size_t expectedHint;
+} HintSearchData[] {
+    {"few keyframes forward", 37, 81.5f, 40},
+    {"many keyframes forward", 37, 170.0f, 85},
+    {"few keyframes backward", 37, 68.5f, 34},
+    {"many keyframes backward", 37, 11.0f, 5},
+    {"before first", 37, -5.0f, 0},
+    {"after last", 37, 500.0f, 98},
+    {"at the very end", 98, 196.0f, 98},
+    {"from the beginning", 0, 131.0f, 65},
+    {"out of bounds", 405780454, 65.0f, 32}
+};
+
 InterpolationTest::InterpolationTest() {
     addTests({&InterpolationTest::interpolatorFor,
               &InterpolationTest::interpolatorForBool,
@@ -169,6 +187,9 @@ InterpolationTest::InterpolationTest() {
                        &InterpolationTest::interpolateStrictHint},
                        Containers::arraySize(HintData));
 
+    addInstancedTests({&InterpolationTest::interpolateHintSearch},
+                       Containers::arraySize(HintSearchData));
+
     addTests({&InterpolationTest::interpolateDifferentResultType,
               &InterpolationTest::interpolateStrictDifferentResultType,
 
@@ -436,6 +457,27 @@ void InterpolationTest::interpolateStrictHint() {
     CORRADE_COMPARE(hint, 2);
 }
 
+void InterpolationTest::interpolateHintSearch() {
+    const auto& data = HintSearchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Keys are 0, 2, 4, ..., 198, values the same */
+    Float keys[100];
+    for(std::size_t i = 0; i != Containers::arraySize(keys); ++i)
+        keys[i] = Float(i)*2.0f;
+
+    std::size_t hint = data.hint;
+    CORRADE_COMPARE((Animation::interpolate<Float, Float>(
+        keys, keys, Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, data.frame, hint)), data.frame);
+    CORRADE_COMPARE(hint, data.expectedHint);
+
+    hint = data.hint;
+    CORRADE_COMPARE((Animation::interpolateStrict<Float, Float>(
+        keys, keys, Math::lerp, data.frame, hint)), data.frame);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
 using namespace Math::Literals;
 
 const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
@@ -77,6 +77,7 @@ struct PlayerTest: TestSuite::Tester {
     void setState();
 
     void add();
+    void addBatch();
     void addWithCallback();
     void addWithCallbackTemplate();
     void addWithCallbackOnChange();
@@ -159,6 +160,7 @@ PlayerTest::PlayerTest() {
               &PlayerTest::setState,
 
               &PlayerTest::add,
+              &PlayerTest::addBatch,
               &PlayerTest::addWithCallback,
               &PlayerTest::addWithCallbackTemplate,
               &PlayerTest::addWithCallbackOnChange,
@@ -1129,6 +1131,34 @@ void PlayerTest::add() {
     CORRADE_COMPARE(value, 4.0f);
 }
 
+void PlayerTest::addBatch() {
+    /* Same as Track, with the second track having values doubled */
+    const Float keys[]{1.0f, 2.5f, 3.0f, 4.0f};
+    const Float values[]{
+        1.5f, 3.0f,
+        3.0f, 6.0f,
+        5.0f, 10.0f,
+        2.0f, 4.0f
+    };
+    const BatchTrackView<Float, Float> track{keys, values, 2, Math::lerp};
+
+    Float result[]{-1.0f, -1.0f};
+    Player<Float> player;
+    player.add(track, Containers::arrayView(result))
+        .play(2.0f);
+
+    CORRADE_COMPARE(player.duration().size(), 3.0f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(result[0], -1.0f);
+    CORRADE_COMPARE(result[1], -1.0f);
+
+    /* 1.75 secs in */
+    player.advance(3.75f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(result[0], 4.0f);
+    CORRADE_COMPARE(result[1], 8.0f);
+}
+
 void PlayerTest::addWithCallback() {
     struct Data {
         Float value = -1.0f;
@@ -76,12 +76,18 @@ performance. You have the following options:
 @subsection Animation-Track-performance-hint Keyframe hinting
 
 The @ref Track and @ref TrackView classes are fully stateless and the
-@ref at(K) const function performs a linear search for matching keyframe from
-the beginning every time. You can use @ref at(K, std::size_t&) const to
+@ref at(K) const function performs a binary search for matching keyframe over
+the whole track every time. You can use @ref at(K, std::size_t&) const to
 remember last used keyframe index and pass it in the next iteration as a hint:
 
 @snippet MagnumAnimation.cpp Track-performance-hint
 
+If the matching keyframe is at most a few keyframes before or after the hint,
+it's found in constant time, which is the case for both forward and reverse
+playback. If the hint misses by more, such as when seeking or scrubbing
+through the animation, the lookup falls back to a binary search. See
+@ref interpolate() for more information.
+
 @subsection Animation-Track-performance-strict Strict interpolation
 
 While it's possible to have different @ref Extrapolation modes for frames
@@ -104,6 +110,11 @@ instead of having data duplicated scattered across disjoint allocations of
 
 @snippet MagnumAnimation.cpp Track-performance-cache
 
+If there are many tracks sharing the same keyframe times, such as joints of
+a skinned mesh, consider using a @ref BatchTrackView instead. It stores the
+keys just once and evaluates all tracks in a single loop over contiguous
+memory.
+
 @subsection Animation-Track-performance-interpolator Interpolator function choice
 
 The interpolator function has a direct effect on animation performance. You can
@@ -327,8 +338,9 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function performs a binary search
+         * every time, use @ref at(K, std::size_t&) const to supply a search
+         * hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
@@ -472,6 +484,7 @@ template<class K> class TrackViewStorage {
 
     private:
         template<class, class, class> friend class TrackView;
+        template<class, class, class> friend class BatchTrackView;
 
         template<class V, class R> explicit TrackViewStorage(const Containers::StridedArrayView<const K>& keys, const Containers::StridedArrayView<const V>& values, Interpolation interpolation, R(*interpolator)(const V&, const V&, Float), Extrapolation before, Extrapolation after) noexcept: _keys{keys}, _values{reinterpret_cast<const Containers::StridedArrayView<const char>&>(values)}, _interpolator{reinterpret_cast<void(*)()>(interpolator)}, _interpolation{interpolation}, _before{before}, _after{after} {}
 
@@ -670,8 +683,9 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function performs a binary search
+         * every time, use @ref at(K, std::size_t&) const to supply a search
+         * hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
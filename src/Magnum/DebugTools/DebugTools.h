@@ -47,6 +47,12 @@ typedef ObjectRenderer<2> ObjectRenderer2D;
 typedef ObjectRenderer<3> ObjectRenderer3D;
 class ObjectRendererOptions;
 
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt> class RendererBatch;
+typedef RendererBatch<2> RendererBatch2D;
+typedef RendererBatch<3> RendererBatch3D;
+#endif
+
 class ResourceManager;
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -31,8 +31,13 @@
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/Shaders/Flat.h"
 
+#include "Magnum/DebugTools/Implementation/ForceRendererMesh.h"
 #include "Magnum/DebugTools/Implementation/ForceRendererTransformation.h"
 
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/DebugTools/RendererBatch.h"
+#endif
+
 namespace Magnum { namespace DebugTools {
 
 namespace {
@@ -41,19 +46,6 @@ template<UnsignedInt dimensions> ResourceKey shaderKey();
 template<> inline ResourceKey shaderKey<2>() { return ResourceKey("FlatShader2D"); }
 template<> inline ResourceKey shaderKey<3>() { return ResourceKey("FlatShader3D"); }
 
-constexpr std::array<Vector2, 4> positions{{
-    {0.0f,  0.0f},
-    {1.0f,  0.0f},
-    {0.9f,  0.1f},
-    {0.9f, -0.1f}
-}};
-
-constexpr std::array<UnsignedByte, 6> indices{{
-    0, 1,
-    1, 2,
-    1, 3
-}};
-
 }
 
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _forcePosition(forcePosition), _force(force), _options(ResourceManager::instance().get<ForceRendererOptions>(options)) {
@@ -71,25 +63,37 @@ template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneG
     GL::Buffer* vertexBuffer = new GL::Buffer{GL::Buffer::TargetHint::Array};
     GL::Buffer* indexBuffer = new GL::Buffer{GL::Buffer::TargetHint::ElementArray};
 
-    _vertexBuffer->setData(positions, GL::BufferUsage::StaticDraw);
+    vertexBuffer->setData(Implementation::forceRendererPositions, GL::BufferUsage::StaticDraw);
     ResourceManager::instance().set(_vertexBuffer.key(), vertexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
 
-    _indexBuffer->setData(indices, GL::BufferUsage::StaticDraw);
+    indexBuffer->setData(Implementation::forceRendererIndices, GL::BufferUsage::StaticDraw);
     ResourceManager::instance().set(_indexBuffer.key(), indexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
 
     GL::Mesh* mesh = new GL::Mesh;
     mesh->setPrimitive(GL::MeshPrimitive::Lines)
-        .setCount(indices.size())
+        .setCount(Implementation::forceRendererIndices.size())
         .addVertexBuffer(*vertexBuffer, 0,
             typename Shaders::Flat<dimensions>::Position(Shaders::Flat<dimensions>::Position::Components::Two))
-        .setIndexBuffer(*indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, positions.size());
+        .setIndexBuffer(*indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, Implementation::forceRendererPositions.size());
     ResourceManager::instance().set(_mesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+/* The batch has its own shader and mesh, so only the options are needed */
+template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, RendererBatch<dimensions>& batch, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _forcePosition(forcePosition), _force(force), _batch{&batch}, _options(ResourceManager::instance().get<ForceRendererOptions>(options)) {}
+#endif
+
 /* To avoid deleting pointers to incomplete type on destruction of Resource members */
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::~ForceRenderer() = default;
 
 template<UnsignedInt dimensions> void ForceRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_batch) {
+        _batch->addForce(Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(_forcePosition), _force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->scale()}), _options->color());
+        return;
+    }
+    #endif
+
     _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(_forcePosition), _force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->scale()}))
         .setColor(_options->color());
     _mesh->draw(*_shader);
@@ -36,6 +36,7 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/Shaders/Shaders.h"
+#include "Magnum/DebugTools/DebugTools.h"
 #include "Magnum/DebugTools/visibility.h"
 
 #ifdef MAGNUM_TARGET_GL
@@ -108,6 +109,10 @@ Vector3 force;
 new DebugTools::ForceRenderer2D(object, {0.3f, 1.5f, -0.7f}, &force, "my", debugDrawables);
 @endcode
 
+For drawing many forces at once, attach the renderers to a
+@ref RendererBatch using
+@ref ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>&, RendererBatch<dimensions>&, const VectorTypeFor<dimensions, Float>&, const VectorTypeFor<dimensions, Float>&, ResourceKey, SceneGraph::DrawableGroup<dimensions, Float>*).
+
 @note This class is available only if Magnum is compiled with
     @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
     default). See @ref building-features for more information.
@@ -138,6 +143,33 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ForceRenderer: p
          */
         ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>&, const VectorTypeFor<dimensions, Float>&, VectorTypeFor<dimensions, Float>&&, ResourceKey = ResourceKey(), SceneGraph::DrawableGroup<dimensions, Float>* = nullptr) = delete;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Construct a batched renderer
+         * @param object        Object for which to create debug renderer
+         * @param batch         Renderer batch
+         * @param forcePosition Where to render the force, relative to object
+         * @param force         Force vector
+         * @param options       Options resource key
+         * @param drawables     Drawable group
+         *
+         * Instead of drawing the force on its own, the renderer only records
+         * its transformation and color into @p batch, which then draws all
+         * its renderers at once. The @p drawables group is expected to be
+         * drawn using @ref RendererBatch::draw(). See @ref RendererBatch for
+         * more information.
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_webgl20 Not available in WebGL 1.0.
+         */
+        explicit ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, RendererBatch<dimensions>& batch, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ResourceKey options = ResourceKey(), SceneGraph::DrawableGroup<dimensions, Float>* drawables = nullptr);
+
+        /**
+         * You have to pass reference to existing force instance, as the
+         * renderer uses the current value when rendering.
+         */
+        ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>&, RendererBatch<dimensions>&, const VectorTypeFor<dimensions, Float>&, VectorTypeFor<dimensions, Float>&&, ResourceKey = ResourceKey(), SceneGraph::DrawableGroup<dimensions, Float>* = nullptr) = delete;
+        #endif
+
         ~ForceRenderer();
 
     private:
@@ -146,6 +178,9 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ForceRenderer: p
         const VectorTypeFor<dimensions, Float> _forcePosition;
         const VectorTypeFor<dimensions, Float>& _force;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        RendererBatch<dimensions>* _batch{};
+        #endif
         Resource<ForceRendererOptions> _options;
         Resource<GL::AbstractShaderProgram, Shaders::Flat<dimensions>> _shader;
         Resource<GL::Mesh> _mesh;
@@ -0,0 +1,52 @@
+#ifndef Magnum_DebugTools_Implementation_ForceRendererMesh_h
+#define Magnum_DebugTools_Implementation_ForceRendererMesh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <array>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector2.h"
+
+namespace Magnum { namespace DebugTools { namespace Implementation {
+
+/* Arrow pointing in the direction of X axis, shared by ForceRenderer and
+   RendererBatch */
+constexpr std::array<Vector2, 4> forceRendererPositions{{
+    {0.0f,  0.0f},
+    {1.0f,  0.0f},
+    {0.9f,  0.1f},
+    {0.9f, -0.1f}
+}};
+
+constexpr std::array<UnsignedByte, 6> forceRendererIndices{{
+    0, 1,
+    1, 2,
+    1, 3
+}};
+
+}}}
+
+#endif
@@ -36,6 +36,10 @@
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/DebugTools/RendererBatch.h"
+#endif
+
 namespace Magnum { namespace DebugTools {
 
 namespace {
@@ -94,10 +98,22 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
     ResourceManager::instance().set<GL::Mesh>(_mesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+/* The batch has its own shader and mesh, so only the options are needed */
+template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, RendererBatch<dimensions>& batch, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _batch{&batch}, _options{ResourceManager::instance().get<ObjectRendererOptions>(options)} {}
+#endif
+
 /* To avoid deleting pointers to incomplete type on destruction of Resource members */
 template<UnsignedInt dimensions> ObjectRenderer<dimensions>::~ObjectRenderer() = default;
 
 template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_batch) {
+        _batch->addObject(transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}));
+        return;
+    }
+    #endif
+
     _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}));
     _mesh->draw(*_shader);
 }
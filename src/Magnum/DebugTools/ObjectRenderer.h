@@ -32,6 +32,7 @@
 #endif
 
 #include "Magnum/Resource.h"
+#include "Magnum/DebugTools/DebugTools.h"
 #include "Magnum/DebugTools/visibility.h"
 #include "Magnum/GL/GL.h"
 #include "Magnum/SceneGraph/Drawable.h"
@@ -90,6 +91,10 @@ Object3D* object;
 new DebugTools::ObjectRenderer2D(object, "my", debugDrawables);
 @endcode
 
+For drawing many objects at once, attach the renderers to a
+@ref RendererBatch using
+@ref ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>&, RendererBatch<dimensions>&, ResourceKey, SceneGraph::DrawableGroup<dimensions, Float>*).
+
 @note This class is available only if Magnum is compiled with
     @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
     default). See @ref building-features for more information.
@@ -110,11 +115,33 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRenderer:
          */
         explicit ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, ResourceKey options = ResourceKey(), SceneGraph::DrawableGroup<dimensions, Float>* drawables = nullptr);
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Construct a batched renderer
+         * @param object    Object for which to create debug renderer
+         * @param batch     Renderer batch
+         * @param options   Options resource key
+         * @param drawables Drawable group
+         *
+         * Instead of drawing the object on its own, the renderer only records
+         * its transformation into @p batch, which then draws all its
+         * renderers at once. The @p drawables group is expected to be drawn
+         * using @ref RendererBatch::draw(). See @ref RendererBatch for more
+         * information.
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_webgl20 Not available in WebGL 1.0.
+         */
+        explicit ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, RendererBatch<dimensions>& batch, ResourceKey options = ResourceKey(), SceneGraph::DrawableGroup<dimensions, Float>* drawables = nullptr);
+        #endif
+
         ~ObjectRenderer();
 
     private:
         void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        RendererBatch<dimensions>* _batch{};
+        #endif
         Resource<ObjectRendererOptions> _options;
         Resource<GL::AbstractShaderProgram, Shaders::VertexColor<dimensions>> _shader;
         Resource<GL::Mesh> _mesh;
@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RendererBatch.h"
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Primitives/Axis.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "Magnum/DebugTools/Implementation/ForceRendererMesh.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+template<UnsignedInt> struct ObjectMesh;
+template<> struct ObjectMesh<2> {
+    static Trade::MeshData2D meshData() { return Primitives::axis2D(); }
+};
+template<> struct ObjectMesh<3> {
+    static Trade::MeshData3D meshData() { return Primitives::axis3D(); }
+};
+
+template<UnsignedInt dimensions> struct ForceInstance {
+    MatrixTypeFor<dimensions, Float> transformation;
+    Color4 color;
+};
+
+}
+
+template<UnsignedInt dimensions> struct RendererBatch<dimensions>::State {
+    explicit State();
+
+    Shaders::Flat<dimensions> shader{Shaders::Flat<dimensions>::Flag::VertexColor|Shaders::Flat<dimensions>::Flag::InstancedTransformation};
+
+    GL::Buffer objectVertices{GL::Buffer::TargetHint::Array},
+        objectIndices{GL::Buffer::TargetHint::ElementArray},
+        objectInstances{GL::Buffer::TargetHint::Array};
+    GL::Mesh objectMesh{GL::MeshPrimitive::Lines};
+    std::vector<MatrixTypeFor<dimensions, Float>> objects;
+
+    GL::Buffer forceVertices{GL::Buffer::TargetHint::Array},
+        forceIndices{GL::Buffer::TargetHint::ElementArray},
+        forceInstances{GL::Buffer::TargetHint::Array};
+    GL::Mesh forceMesh{GL::MeshPrimitive::Lines};
+    std::vector<ForceInstance<dimensions>> forces;
+};
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::State::State() {
+    typedef Shaders::Flat<dimensions> Shader;
+
+    /* Object axes with per-vertex colors */
+    auto data = ObjectMesh<dimensions>::meshData();
+    objectVertices.setData(MeshTools::interleave(data.positions(0), data.colors(0)), GL::BufferUsage::StaticDraw);
+    objectIndices.setData(MeshTools::compressIndicesAs<UnsignedByte>(data.indices()), GL::BufferUsage::StaticDraw);
+    objectMesh.setCount(data.indices().size())
+        .addVertexBuffer(objectVertices, 0,
+            typename Shader::Position{},
+            typename Shader::Color4{})
+        .addVertexBufferInstanced(objectInstances, 1, 0,
+            typename Shader::TransformationMatrix{})
+        .setIndexBuffer(objectIndices, 0, GL::MeshIndexType::UnsignedByte, 0, data.positions(0).size());
+
+    /* Force arrow, the color is per-instance */
+    forceVertices.setData(Implementation::forceRendererPositions, GL::BufferUsage::StaticDraw);
+    forceIndices.setData(Implementation::forceRendererIndices, GL::BufferUsage::StaticDraw);
+    forceMesh.setCount(Implementation::forceRendererIndices.size())
+        .addVertexBuffer(forceVertices, 0,
+            typename Shader::Position{Shader::Position::Components::Two})
+        .addVertexBufferInstanced(forceInstances, 1, 0,
+            typename Shader::TransformationMatrix{},
+            typename Shader::Color4{})
+        .setIndexBuffer(forceIndices, 0, GL::MeshIndexType::UnsignedByte, 0, Implementation::forceRendererPositions.size());
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::RendererBatch() {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::instanced_arrays);
+    #endif
+
+    _state.reset(new State);
+}
+
+/* To avoid deleting pointers to incomplete type on destruction of the state */
+template<UnsignedInt dimensions> RendererBatch<dimensions>::~RendererBatch() = default;
+
+template<UnsignedInt dimensions> std::size_t RendererBatch<dimensions>::objectCount() const {
+    return _state->objects.size();
+}
+
+template<UnsignedInt dimensions> std::size_t RendererBatch<dimensions>::forceCount() const {
+    return _state->forces.size();
+}
+
+template<UnsignedInt dimensions> void RendererBatch<dimensions>::addObject(const MatrixTypeFor<dimensions, Float>& transformation) {
+    _state->objects.push_back(transformation);
+}
+
+template<UnsignedInt dimensions> void RendererBatch<dimensions>::addForce(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    _state->forces.push_back({transformation, color});
+}
+
+template<UnsignedInt dimensions> void RendererBatch<dimensions>::draw(SceneGraph::Camera<dimensions, Float>& camera, SceneGraph::DrawableGroup<dimensions, Float>& drawables) {
+    State& state = *_state;
+
+    /* Collect transformations of all batched renderers. The arrays keep their
+       capacity, so there are no allocations in the steady state. */
+    state.objects.clear();
+    state.forces.clear();
+    camera.draw(drawables);
+
+    /* The per-instance transformations are already relative to the camera */
+    state.shader.setTransformationProjectionMatrix(camera.projectionMatrix());
+
+    /* Orphan the previous instance data and draw everything at once */
+    if(!state.objects.empty()) {
+        state.objectInstances.setData(state.objects, GL::BufferUsage::StreamDraw);
+        state.objectMesh.setInstanceCount(state.objects.size())
+            .draw(state.shader);
+    }
+
+    if(!state.forces.empty()) {
+        state.forceInstances.setData(state.forces, GL::BufferUsage::StreamDraw);
+        state.forceMesh.setInstanceCount(state.forces.size())
+            .draw(state.shader);
+    }
+}
+
+template class RendererBatch<2>;
+template class RendererBatch<3>;
+
+}}
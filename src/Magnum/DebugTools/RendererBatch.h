@@ -0,0 +1,156 @@
+#ifndef Magnum_DebugTools_RendererBatch_h
+#define Magnum_DebugTools_RendererBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::RendererBatch, typedef @ref Magnum::DebugTools::RendererBatch2D, @ref Magnum::DebugTools::RendererBatch3D
+ */
+#endif
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/DebugTools/DebugTools.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+
+#ifdef MAGNUM_TARGET_GL
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Batch of debug renderers
+
+Draws all @ref ObjectRenderer and @ref ForceRenderer instances attached to it
+using just one instanced draw call for each primitive type, instead of one
+draw call with a dedicated shader and mesh setup per renderer. Useful for
+scenes with thousands of debug-rendered objects.
+
+@section DebugTools-RendererBatch-usage Basic usage
+
+Create the batch, pass it to constructors of the debug renderers and then
+draw their drawable group through @ref draw() instead of
+@ref SceneGraph::Camera::draw():
+
+@snippet MagnumDebugTools.cpp RendererBatch
+
+While drawing the group, the batched renderers only record their final
+transformation and color. After the whole group is processed, transformations
+of all renderers of given type are uploaded into a single instance buffer and
+drawn using @ref Shaders::Flat with @ref Shaders::Flat::Flag::InstancedTransformation
+enabled. The group can contain also regular drawables, those are drawn
+immediately as usual.
+
+You must ensure that the batch is available for whole lifetime of all
+renderers attached to it.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
+    default). See @ref building-features for more information.
+
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Not available in OpenGL ES 2.0.
+@requires_webgl20 Not available in WebGL 1.0.
+
+@see @ref RendererBatch2D, @ref RendererBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT RendererBatch {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates the shader and meshes for all supported primitive types.
+         */
+        explicit RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RendererBatch(RendererBatch<dimensions>&&) = delete;
+
+        ~RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch<dimensions>& operator=(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RendererBatch<dimensions>& operator=(RendererBatch<dimensions>&&) = delete;
+
+        /**
+         * @brief Count of object renderers drawn in last @ref draw()
+         *
+         * @see @ref ObjectRenderer
+         */
+        std::size_t objectCount() const;
+
+        /**
+         * @brief Count of force renderers drawn in last @ref draw()
+         *
+         * @see @ref ForceRenderer
+         */
+        std::size_t forceCount() const;
+
+        /**
+         * @brief Draw a drawable group
+         *
+         * Calls @ref SceneGraph::Camera::draw() on @p drawables, which makes
+         * all batched renderers in the group record their transformations,
+         * and then draws each primitive type with a single instanced draw
+         * call. Primitive types with no renderers are skipped.
+         */
+        void draw(SceneGraph::Camera<dimensions, Float>& camera, SceneGraph::DrawableGroup<dimensions, Float>& drawables);
+
+    private:
+        friend ObjectRenderer<dimensions>;
+        friend ForceRenderer<dimensions>;
+
+        struct State;
+
+        void MAGNUM_DEBUGTOOLS_LOCAL addObject(const MatrixTypeFor<dimensions, Float>& transformation);
+        void MAGNUM_DEBUGTOOLS_LOCAL addForce(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color);
+
+        std::unique_ptr<State> _state;
+};
+
+/** @brief Two-dimensional renderer batch */
+typedef RendererBatch<2> RendererBatch2D;
+
+/** @brief Three-dimensional renderer batch */
+typedef RendererBatch<3> RendererBatch3D;
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL 1.0 builds
+#endif
+#else
+#error this header is available only in the OpenGL build
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/DebugTools/ForceRenderer.h"
+#include "Magnum/DebugTools/ObjectRenderer.h"
+#include "Magnum/DebugTools/RendererBatch.h"
+#include "Magnum/DebugTools/ResourceManager.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct RendererBatchGLTest: GL::OpenGLTester {
+    explicit RendererBatchGLTest();
+
+    void drawEmpty();
+    void draw2D();
+    void draw3D();
+};
+
+RendererBatchGLTest::RendererBatchGLTest() {
+    addTests({&RendererBatchGLTest::drawEmpty,
+              &RendererBatchGLTest::draw2D,
+              &RendererBatchGLTest::draw3D});
+}
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+void RendererBatchGLTest::drawEmpty() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+        CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() + std::string(" is not supported"));
+    #endif
+
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    SceneGraph::Camera3D camera{cameraObject};
+    SceneGraph::DrawableGroup3D drawables;
+
+    RendererBatch3D batch;
+    batch.draw(camera, drawables);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(batch.objectCount(), 0);
+    CORRADE_COMPARE(batch.forceCount(), 0);
+}
+
+void RendererBatchGLTest::draw2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+        CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() + std::string(" is not supported"));
+    #endif
+
+    ResourceManager manager;
+
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    SceneGraph::Camera2D camera{cameraObject};
+    SceneGraph::DrawableGroup2D drawables;
+
+    RendererBatch2D batch;
+    Object2D a{&scene}, b{&scene};
+    a.translate({0.5f, 0.0f});
+    const Vector2 force{0.0f, 1.0f};
+    new ObjectRenderer2D{a, batch, {}, &drawables};
+    new ObjectRenderer2D{b, batch, {}, &drawables};
+    new ForceRenderer2D{b, batch, {}, force, {}, &drawables};
+
+    /* Non-batched renderers in the same group are drawn as usual */
+    new ObjectRenderer2D{b, {}, &drawables};
+
+    batch.draw(camera, drawables);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(batch.objectCount(), 2);
+    CORRADE_COMPARE(batch.forceCount(), 1);
+
+    /* Drawing again doesn't accumulate the instances */
+    batch.draw(camera, drawables);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(batch.objectCount(), 2);
+    CORRADE_COMPARE(batch.forceCount(), 1);
+}
+
+void RendererBatchGLTest::draw3D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+        CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() + std::string(" is not supported"));
+    #endif
+
+    ResourceManager manager;
+    manager.set("my", ForceRendererOptions{}.setColor(0xff3366ff_rgbaf));
+
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    SceneGraph::Camera3D camera{cameraObject};
+    SceneGraph::DrawableGroup3D drawables;
+
+    RendererBatch3D batch;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    b.translate({0.0f, 0.5f, 0.0f});
+    c.rotateX(90.0_degf);
+    const Vector3 force{1.0f, 0.0f, 0.0f};
+    new ObjectRenderer3D{a, batch, {}, &drawables};
+    new ObjectRenderer3D{b, batch, {}, &drawables};
+    new ObjectRenderer3D{c, batch, {}, &drawables};
+    new ForceRenderer3D{a, batch, {}, force, "my", &drawables};
+    new ForceRenderer3D{c, batch, {0.0f, 1.0f, 0.0f}, force, {}, &drawables};
+
+    batch.draw(camera, drawables);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(batch.objectCount(), 3);
+    CORRADE_COMPARE(batch.forceCount(), 2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::RendererBatchGLTest)
@@ -395,12 +395,19 @@ void AbstractShaderProgram::transformFeedbackVaryingsImplementationDanglingWorka
 #endif
 
 bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
-    bool allSuccess = true;
+    submitLink(shaders);
+    return checkLink(shaders);
+}
 
+void AbstractShaderProgram::submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
     /* Invoke (possibly parallel) linking on all shaders */
     for(AbstractShaderProgram& shader: shaders) glLinkProgram(shader._id);
+}
+
+bool AbstractShaderProgram::checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    bool allSuccess = true;
 
-    /* After linking phase, check status of all shaders */
+    /* Check status of all shaders */
     Int i = 1;
     for(AbstractShaderProgram& shader: shaders) {
         GLint success, logLength;
@@ -437,6 +444,22 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
     return allSuccess;
 }
 
+bool AbstractShaderProgram::isLinkFinished() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(Context::current().isExtensionSupported<Extensions::KHR::parallel_shader_compile>()
+        #ifndef MAGNUM_TARGET_GLES
+        || Context::current().isExtensionSupported<Extensions::ARB::parallel_shader_compile>()
+        #endif
+    ) {
+        GLint success;
+        glGetProgramiv(_id, GL_COMPLETION_STATUS_KHR, &success);
+        return success == GL_TRUE;
+    }
+    #endif
+
+    return true;
+}
+
 Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayView<const char> name) {
     const GLint location = glGetUniformLocation(_id, name);
     if(location == -1)
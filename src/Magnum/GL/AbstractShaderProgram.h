@@ -415,11 +415,18 @@ documentation for more information.
 To achieve least state changes, set all uniforms in one run --- method chaining
 comes in handy.
 
+Linked program binaries can be stored on disk and reused on subsequent runs
+using @ref ShaderProgramCache. All builtin shaders in the @ref Shaders library
+use it if there's a current cache.
+
 @see @ref portability-shaders
 
 @todo `GL_NUM_{PROGRAM,SHADER}_BINARY_FORMATS` + `GL_{PROGRAM,SHADER}_BINARY_FORMATS` (vector), (@gl_extension{ARB,ES2_compatibility})
  */
 class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
+    #ifndef MAGNUM_TARGET_GLES
+    friend DrawCommandList;
+    #endif
     friend Mesh;
     friend MeshView;
     #ifndef MAGNUM_TARGET_GLES2
@@ -728,6 +735,21 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         std::pair<bool, std::string> validate();
 
+        /**
+         * @brief Whether the linking has finished
+         *
+         * Expects that @ref submitLink() was called before. If
+         * @gl_extension{KHR,parallel_shader_compile} or
+         * @gl_extension{ARB,parallel_shader_compile} is supported, returns
+         * whether the driver finished linking the program, so the following
+         * @ref checkLink() call won't block. Otherwise always returns
+         * @cpp true @ce.
+         * @see @fn_gl_keyword{GetProgram} with @def_gl{COMPLETION_STATUS_KHR}
+         * @requires_gles Parallel shader compilation is not available in
+         *      WebGL, there the function always returns @cpp true @ce.
+         */
+        bool isLinkFinished();
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         /**
          * @brief Dispatch compute
@@ -752,13 +774,42 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          * output. All attached shaders must be compiled with
          * @ref Shader::compile() before linking. The operation is batched in a
          * way that allows the driver to link multiple shaders simultaneously
-         * (i.e. in multiple threads).
+         * (i.e. in multiple threads). Equivalent to calling
+         * @ref submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * followed by @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
          * @see @fn_gl_keyword{LinkProgram}, @fn_gl_keyword{GetProgram} with
          *      @def_gl{LINK_STATUS} and @def_gl{INFO_LOG_LENGTH},
          *      @fn_gl_keyword{GetProgramInfoLog}
          */
         static bool link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for linking
+         *
+         * First half of @ref link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>),
+         * starts the linking without waiting for the result. Poll
+         * @ref isLinkFinished() and then call
+         * @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * to get the result. Attached shaders don't need to be checked with
+         * @ref Shader::checkCompile() before, a compilation failure results in
+         * a link failure.
+         * @see @fn_gl_keyword{LinkProgram}
+         */
+        static void submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
+        /**
+         * @brief Check link status of multiple shaders
+         *
+         * Second half of @ref link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>),
+         * expects that @ref submitLink() was called on all @p shaders before.
+         * Blocks until the linking finishes, returns @cpp false @ce if linking
+         * of any shader failed and @cpp true @ce if everything succeeded.
+         * Linker message (if any) is printed to error output.
+         * @see @fn_gl_keyword{GetProgram} with @def_gl{LINK_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl_keyword{GetProgramInfoLog}
+         */
+        static bool checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         /**
          * @brief Allow retrieving program binary
@@ -936,6 +987,20 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         bool link() { return link({*this}); }
 
+        /**
+         * @brief Submit the shader for linking
+         *
+         * Single-shader version of @ref submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         */
+        void submitLink() { submitLink({*this}); }
+
+        /**
+         * @brief Check shader link status
+         *
+         * Single-shader version of @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         */
+        bool checkLink() { return checkLink({*this}); }
+
         /**
          * @brief Get uniform location
          * @param name          Uniform name
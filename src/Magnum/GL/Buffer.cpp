@@ -298,6 +298,13 @@ Buffer& Buffer::setData(const Containers::ArrayView<const void> data, const Buff
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+Buffer& Buffer::setStorage(const Containers::ArrayView<const void> data, const StorageFlags flags) {
+    (this->*Context::current().state().buffer->storageImplementation)(data.size(), data, flags);
+    return *this;
+}
+#endif
+
 Buffer& Buffer::setSubData(const GLintptr offset, const Containers::ArrayView<const void> data) {
     (this->*Context::current().state().buffer->subDataImplementation)(offset, data.size(), data);
     return *this;
@@ -464,6 +471,21 @@ void Buffer::dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, Buffe
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void Buffer::storageImplementationDefault(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    glBufferStorage(GLenum(bindSomewhereInternal(_targetHint)), size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSA(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    glNamedBufferStorage(_id, size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSAEXT(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    _flags |= ObjectFlag::Created;
+    glNamedBufferStorageEXT(_id, size, data, GLbitfield(flags));
+}
+#endif
+
 void Buffer::subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data) {
     glBufferSubData(GLenum(bindSomewhereInternal(_targetHint)), offset, size, data);
 }
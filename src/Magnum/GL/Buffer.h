@@ -224,6 +224,9 @@ functions do nothing.
  */
 class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
     friend Implementation::BufferState;
+    #ifndef MAGNUM_TARGET_GLES
+    friend DrawCommandList;
+    #endif
 
     public:
         /**
@@ -497,9 +500,33 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
              * before mapping.
              */
             #ifndef MAGNUM_TARGET_GLES2
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT,
             #else
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * The buffer can stay mapped while it's used by the GPU. The
+             * buffer storage has to be created with
+             * @ref StorageFlag::MapPersistent.
+             * @see @ref setStorage()
+             * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+             * @requires_gl Persistent buffer mapping is not available in
+             *      OpenGL ES or WebGL.
+             */
+            Persistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Writes to a persistently mapped buffer are visible to the GPU
+             * without calling @ref flushMappedRange(). The buffer storage has
+             * to be created with @ref StorageFlag::MapCoherent.
+             * @see @ref setStorage()
+             * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+             * @requires_gl Persistent buffer mapping is not available in
+             *      OpenGL ES or WebGL.
+             */
+            Coherent = GL_MAP_COHERENT_BIT
             #endif
         };
 
@@ -515,6 +542,53 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         typedef Containers::EnumSet<MapFlag> MapFlags;
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Buffer storage flag
+         *
+         * @see @ref StorageFlags, @ref setStorage()
+         * @m_enum_values_as_keywords
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL ES
+         *      or WebGL.
+         */
+        enum class StorageFlag: GLbitfield {
+            /** Allow mapping the buffer for reading. */
+            MapRead = GL_MAP_READ_BIT,
+
+            /** Allow mapping the buffer for writing. */
+            MapWrite = GL_MAP_WRITE_BIT,
+
+            /**
+             * Allow the buffer to be mapped while it's used by the GPU.
+             * @see @ref MapFlag::Persistent
+             */
+            MapPersistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Allow coherent persistent mapping.
+             * @see @ref MapFlag::Coherent
+             */
+            MapCoherent = GL_MAP_COHERENT_BIT,
+
+            /** Allow updating the buffer contents using @ref setSubData(). */
+            DynamicStorage = GL_DYNAMIC_STORAGE_BIT,
+
+            /** Prefer to allocate the storage in client memory. */
+            ClientStorage = GL_CLIENT_STORAGE_BIT
+        };
+
+        /**
+         * @brief Buffer storage flags
+         *
+         * @see @ref setStorage()
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL ES
+         *      or WebGL.
+         */
+        typedef Containers::EnumSet<StorageFlag> StorageFlags;
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Minimal supported mapping alignment
@@ -1022,6 +1096,31 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
          */
         Buffer& setData(Containers::ArrayView<const void> data, BufferUsage usage = BufferUsage::StaticDraw);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set immutable buffer storage
+         * @param data      Data
+         * @param flags     Storage flags
+         * @return Reference to self (for method chaining)
+         *
+         * After calling this function the buffer size can't be changed and
+         * the contents can be updated only in a way allowed by @p flags. Pass
+         * a @cpp nullptr @ce view of desired size to leave the contents
+         * uninitialized. If neither @gl_extension{ARB,direct_state_access}
+         * (part of OpenGL 4.5) nor @gl_extension{EXT,direct_state_access}
+         * desktop extension is available, the buffer is bound to hinted target
+         * before the operation (if not already).
+         * @see @ref setTargetHint(), @ref StreamingBuffer,
+         *      @fn_gl2_keyword{NamedBufferStorage,BufferStorage},
+         *      @fn_gl_extension_keyword{NamedBufferStorage,EXT,direct_state_access},
+         *      eventually @fn_gl{BindBuffer} and @fn_gl_keyword{BufferStorage}
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL ES
+         *      or WebGL.
+         */
+        Buffer& setStorage(Containers::ArrayView<const void> data, StorageFlags flags);
+        #endif
+
         /** @overload */
         template<class T> Buffer& setData(const std::vector<T>& data, BufferUsage usage = BufferUsage::StaticDraw) {
             setData({data.data(), data.size()}, usage);
@@ -1284,6 +1383,12 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         void MAGNUM_GL_LOCAL dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, BufferUsage usage);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_GL_LOCAL storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_GL_LOCAL storageImplementationDSA(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_GL_LOCAL storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        #endif
+
         void MAGNUM_GL_LOCAL subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_GL_LOCAL subDataImplementationDSA(GLintptr offset, GLsizeiptr size, const GLvoid* data);
@@ -1334,6 +1439,9 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
 #ifndef MAGNUM_TARGET_WEBGL
 CORRADE_ENUMSET_OPERATORS(Buffer::MapFlags)
 #endif
+#ifndef MAGNUM_TARGET_GLES
+CORRADE_ENUMSET_OPERATORS(Buffer::StorageFlags)
+#endif
 
 /** @debugoperatorclassenum{Buffer,Buffer::TargetHint} */
 MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Buffer::TargetHint value);
@@ -82,6 +82,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(ARB,sparse_texture),
         _extension(ARB,sparse_buffer),
         _extension(ARB,ES3_2_compatibility),
+        _extension(ARB,parallel_shader_compile),
         _extension(ATI,texture_mirror_once),
         _extension(EXT,texture_filter_anisotropic),
         _extension(EXT,texture_compression_s3tc),
@@ -95,7 +96,8 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(KHR,texture_compression_astc_ldr),
         _extension(KHR,texture_compression_astc_hdr),
         _extension(KHR,blend_equation_advanced),
-        _extension(KHR,blend_equation_advanced_coherent)};
+        _extension(KHR,blend_equation_advanced_coherent),
+        _extension(KHR,parallel_shader_compile)};
     static const std::vector<Extension> extensions300{
         _extension(ARB,map_buffer_range),
         _extension(ARB,color_buffer_float),
@@ -292,6 +294,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(KHR,blend_equation_advanced_coherent),
         _extension(KHR,context_flush_control),
         _extension(KHR,no_error),
+        _extension(KHR,parallel_shader_compile),
         _extension(NV,read_buffer_front),
         _extension(NV,read_depth),
         _extension(NV,read_stencil),
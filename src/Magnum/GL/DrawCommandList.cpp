@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DrawCommandList.h"
+
+#ifndef MAGNUM_TARGET_GLES
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/MeshState.h"
+
+namespace Magnum { namespace GL {
+
+DrawCommandList::DrawCommandList(Mesh& mesh): _mesh{&mesh}, _buffer{Buffer::TargetHint::DrawIndirect} {}
+
+DrawCommandList::DrawCommandList(NoCreateT) noexcept: _mesh{}, _buffer{NoCreate} {}
+
+DrawCommandList::DrawCommandList(DrawCommandList&&) noexcept = default;
+
+DrawCommandList::~DrawCommandList() = default;
+
+DrawCommandList& DrawCommandList::operator=(DrawCommandList&&) noexcept = default;
+
+DrawCommandList& DrawCommandList::add(const MeshView& view) {
+    CORRADE_ASSERT(&view._original.get() == _mesh,
+        "GL::DrawCommandList::add(): the view is not a view of the original mesh", *this);
+    CORRADE_ASSERT(view._countSet,
+        "GL::DrawCommandList::add(): setCount() was never called on the view, probably a mistake?", *this);
+
+    Command command;
+    command.count = view._count;
+    command.instanceCount = view._instanceCount;
+
+    /* Indexed mesh. The first index is counted from the start of the index
+       buffer, not relative to the mesh index offset. */
+    if(_mesh->_indexBuffer.id()) {
+        const UnsignedInt indexTypeSize = _mesh->indexTypeSize();
+        CORRADE_ASSERT(view._indexOffset % indexTypeSize == 0,
+            "GL::DrawCommandList::add(): index offset" << view._indexOffset << "is not aligned to the index type size", *this);
+        command.first = view._indexOffset/indexTypeSize;
+        command.baseVertex = view._baseVertex;
+        command.baseInstance = view._baseInstance;
+
+    /* Non-indexed mesh, put base instance in place of base vertex */
+    } else {
+        command.first = view._baseVertex;
+        command.baseVertex = view._baseInstance;
+        command.baseInstance = 0;
+    }
+
+    _commands.push_back(command);
+    _dirty = true;
+    return *this;
+}
+
+DrawCommandList& DrawCommandList::clear() {
+    _commands.clear();
+    _dirty = true;
+    return *this;
+}
+
+DrawCommandList& DrawCommandList::draw(AbstractShaderProgram& shader) {
+    /* Nothing to draw, exit without touching any state */
+    if(_commands.empty()) return *this;
+
+    shader.use();
+    (this->*Context::current().state().mesh->drawCommandListImplementation)();
+    return *this;
+}
+
+void DrawCommandList::drawImplementationIndirect() {
+    static_assert(sizeof(Command) == 5*4, "improper size of the indirect draw command");
+
+    const Implementation::MeshState& state = *Context::current().state().mesh;
+
+    /* Upload the commands only if they changed since last time */
+    if(_dirty) {
+        _buffer.setData({_commands.data(), _commands.size()*sizeof(Command)}, BufferUsage::DynamicDraw);
+        _dirty = false;
+    }
+
+    Buffer::bindInternal(Buffer::TargetHint::DrawIndirect, &_buffer);
+    (_mesh->*state.bindImplementation)();
+
+    /* Non-indexed mesh */
+    if(!_mesh->_indexBuffer.id())
+        glMultiDrawArraysIndirect(GLenum(_mesh->_primitive), nullptr, _commands.size(), sizeof(Command));
+
+    /* Indexed mesh */
+    else glMultiDrawElementsIndirect(GLenum(_mesh->_primitive), GLenum(_mesh->_indexType), nullptr, _commands.size(), sizeof(Command));
+
+    (_mesh->*state.unbindImplementation)();
+}
+
+void DrawCommandList::drawImplementationFallback() {
+    const bool indexed = _mesh->_indexBuffer.id();
+    const UnsignedInt indexTypeSize = indexed ? _mesh->indexTypeSize() : 0;
+
+    for(const Command& command: _commands) {
+        /* Nothing to draw in this command */
+        if(!command.count || !command.instanceCount) continue;
+
+        const Int baseVertex = indexed ? command.baseVertex : command.first;
+        const UnsignedInt baseInstance = indexed ? command.baseInstance : command.baseVertex;
+        const GLintptr indexOffset = GLintptr(command.first)*indexTypeSize;
+
+        /* Mesh::drawInternal() uses base instance only for instanced draws,
+           so draw the commands that need it directly */
+        if(baseInstance) {
+            CORRADE_ASSERT(Context::current().isExtensionSupported<Extensions::ARB::base_instance>(),
+                "GL::DrawCommandList::draw():" << Extensions::ARB::base_instance::string() << "is required for a non-zero base instance", );
+
+            const Implementation::MeshState& state = *Context::current().state().mesh;
+
+            (_mesh->*state.bindImplementation)();
+
+            if(!indexed)
+                glDrawArraysInstancedBaseInstance(GLenum(_mesh->_primitive), baseVertex, command.count, command.instanceCount, baseInstance);
+            else glDrawElementsInstancedBaseVertexBaseInstance(GLenum(_mesh->_primitive), command.count, GLenum(_mesh->_indexType), reinterpret_cast<GLvoid*>(indexOffset), command.instanceCount, baseVertex, baseInstance);
+
+            (_mesh->*state.unbindImplementation)();
+
+        } else _mesh->drawInternal(command.count, baseVertex, command.instanceCount, 0, indexOffset, 0, 0);
+    }
+}
+
+}}
+#endif
@@ -0,0 +1,194 @@
+#ifndef Magnum_GL_DrawCommandList_h
+#define Magnum_GL_DrawCommandList_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES
+/** @file
+ * @brief Class @ref Magnum::GL::DrawCommandList
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/GL/Buffer.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum { namespace GL {
+
+namespace Implementation { struct MeshState; }
+
+/**
+@brief Draw command list
+
+Batches draws of many @ref MeshView instances of the same original @ref Mesh
+into a single call. Each view added with @ref add() is recorded as one
+indirect draw command including its instance count and base instance, the
+commands are stored in a @ref Buffer::TargetHint::DrawIndirect buffer and
+@ref draw() then submits all of them at once. Because all views share the
+vertex array of the original mesh and are drawn with the same shader, this
+avoids the per-draw validation overhead of calling @ref MeshView::draw() for
+each of them.
+
+@snippet MagnumGL.cpp DrawCommandList-usage
+
+The base instance can be used to fetch per-draw data from an instanced vertex
+attribute --- see @ref Mesh::addVertexBufferInstanced() --- so each command
+can for example use a different transformation while still drawing a single
+instance.
+
+@section GL-DrawCommandList-performance Performance optimizations
+
+If @gl_extension{ARB,multi_draw_indirect} (part of OpenGL 4.3) is available,
+the commands are uploaded to @ref buffer() only when the list changes and all
+of them are submitted using a single @fn_gl_keyword{MultiDrawElementsIndirect}
+or @fn_gl_keyword{MultiDrawArraysIndirect} call. Otherwise, @ref draw() falls
+back to drawing the commands one by one, in the same way as
+@ref MeshView::draw() would do. Commands with a non-zero base instance then
+require @gl_extension{ARB,base_instance} (part of OpenGL 4.2).
+
+@requires_gl Indirect drawing is not available in OpenGL ES or WebGL.
+*/
+class MAGNUM_GL_EXPORT DrawCommandList {
+    friend Implementation::MeshState;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param mesh      Original mesh of all views added to the list
+         *
+         * Creates an empty list. You must ensure that the mesh remains
+         * available for whole list lifetime.
+         * @see @ref Buffer::TargetHint::DrawIndirect
+         */
+        explicit DrawCommandList(Mesh& mesh);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit DrawCommandList(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        DrawCommandList(const DrawCommandList&) = delete;
+
+        /** @brief Move constructor */
+        DrawCommandList(DrawCommandList&&) noexcept;
+
+        ~DrawCommandList();
+
+        /** @brief Copying is not allowed */
+        DrawCommandList& operator=(const DrawCommandList&) = delete;
+
+        /** @brief Move assignment */
+        DrawCommandList& operator=(DrawCommandList&&) noexcept;
+
+        /** @brief Original mesh */
+        Mesh& mesh() { return *_mesh; }
+
+        /**
+         * @brief Indirect draw buffer
+         *
+         * Contains the commands as of the last call to @ref draw(). Empty if
+         * @gl_extension{ARB,multi_draw_indirect} is not available.
+         */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Count of commands in the list */
+        std::size_t size() const { return _commands.size(); }
+
+        /** @brief Whether the list is empty */
+        bool isEmpty() const { return _commands.empty(); }
+
+        /**
+         * @brief Add a mesh view to the list
+         * @return Reference to self (for method chaining)
+         *
+         * Records index or vertex range, base vertex, instance count and base
+         * instance of @p view. Expects that the view is a view of @ref mesh()
+         * and that @ref MeshView::setCount() was called on it. Subsequent
+         * changes to the view don't affect the recorded command. If the mesh
+         * is indexed, its index buffer and index offset are expected to not
+         * change while the list is in use.
+         */
+        DrawCommandList& add(const MeshView& view);
+
+        /**
+         * @brief Clear the list
+         * @return Reference to self (for method chaining)
+         */
+        DrawCommandList& clear();
+
+        /**
+         * @brief Draw all commands in the list
+         * @return Reference to self (for method chaining)
+         *
+         * Does nothing if the list is empty. See
+         * @ref GL-DrawCommandList-performance for more information.
+         * @see @ref Mesh::draw(), @ref MeshView::draw(),
+         *      @fn_gl_keyword{UseProgram}, @fn_gl{BindVertexArray},
+         *      @fn_gl{BindBuffer}, @fn_gl{BufferData},
+         *      @fn_gl_keyword{MultiDrawElementsIndirect} or
+         *      @fn_gl_keyword{MultiDrawArraysIndirect}
+         */
+        DrawCommandList& draw(AbstractShaderProgram& shader);
+        DrawCommandList& draw(AbstractShaderProgram&& shader) {
+            return draw(shader);
+        } /**< @overload */
+
+    private:
+        /* Layout of DrawElementsIndirectCommand. For non-indexed meshes the
+           first four fields are interpreted as DrawArraysIndirectCommand,
+           i.e. {count, instanceCount, first, baseInstance}, and the last one
+           is unused. */
+        struct Command {
+            UnsignedInt count;
+            UnsignedInt instanceCount;
+            UnsignedInt first;
+            Int baseVertex;
+            UnsignedInt baseInstance;
+        };
+
+        void MAGNUM_GL_LOCAL drawImplementationIndirect();
+        void MAGNUM_GL_LOCAL drawImplementationFallback();
+
+        Mesh* _mesh;
+        Buffer _buffer;
+        std::vector<Command> _commands;
+        bool _dirty{};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
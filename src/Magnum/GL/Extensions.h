@@ -209,13 +209,14 @@ namespace AMD {
     _extension(125,ARB,sparse_buffer,                   GL210,  None) // #172
     _extension(126,ARB,transform_feedback_overflow_query, GL300, None) // #173
     _extension(127,ARB,ES3_2_compatibility,             GL450,  None) // #177
-    _extension(128,ARB,shader_atomic_counter_ops,       GL300, GL460) // #182
-    _extension(129,ARB,gl_spirv,                        GL330, GL460) // #190
-    _extension(130,ARB,polygon_offset_clamp,            GL330, GL460) // #193
-    _extension(131,ARB,spirv_extensions,                GL330, GL460) // #194
-    _extension(132,ARB,texture_filter_anisotropic,      GL210, GL460) // #195
+    _extension(128,ARB,parallel_shader_compile,         GL210,  None) // #179
+    _extension(129,ARB,shader_atomic_counter_ops,       GL300, GL460) // #182
+    _extension(130,ARB,gl_spirv,                        GL330, GL460) // #190
+    _extension(131,ARB,polygon_offset_clamp,            GL330, GL460) // #193
+    _extension(132,ARB,spirv_extensions,                GL330, GL460) // #194
+    _extension(133,ARB,texture_filter_anisotropic,      GL210, GL460) // #195
 } namespace ATI {
-    _extension(133,ATI,texture_mirror_once,             GL210,  None) // #221
+    _extension(134,ATI,texture_mirror_once,             GL210,  None) // #221
 } namespace EXT {
     _extension(140,EXT,texture_filter_anisotropic,      GL210,  None) // #187
     _extension(141,EXT,texture_compression_s3tc,        GL210,  None) // #198
@@ -248,10 +249,11 @@ namespace AMD {
     _extension(166,KHR,blend_equation_advanced,         GL210,  None) // #174
     _extension(167,KHR,blend_equation_advanced_coherent, GL210, None) // #174
     _extension(168,KHR,no_error,                        GL210,  None) // #175
+    _extension(169,KHR,parallel_shader_compile,         GL210,  None) // #192
 } namespace NV {
-    _extension(169,NV,primitive_restart,                GL210, GL310) // #285
-    _extension(170,NV,depth_buffer_float,               GL210, GL300) // #334
-    _extension(171,NV,conditional_render,               GL210, GL300) // #346
+    _extension(170,NV,primitive_restart,                GL210, GL310) // #285
+    _extension(171,NV,depth_buffer_float,               GL210, GL300) // #334
+    _extension(172,NV,conditional_render,               GL210, GL300) // #346
     /* NV_draw_texture not supported */                               // #430
 }
 /* IMPORTANT: if this line is > 329 (73 + size), don't forget to update array size in Context.h */
@@ -398,6 +400,7 @@ namespace ANDROID {
     _extension( 76,KHR,robust_buffer_access_behavior, GLES200, GLES320) // #189
     _extension( 77,KHR,context_flush_control,       GLES200,    None) // #191
     _extension( 78,KHR,no_error,                    GLES200,    None) // #243
+    _extension( 79,KHR,parallel_shader_compile,     GLES200,    None) // #288
 } namespace NV {
     #ifdef MAGNUM_TARGET_GLES2
     _extension( 80,NV,draw_buffers,                 GLES200, GLES300) // #91
@@ -83,6 +83,10 @@ class CubeMapTextureArray;
 /* DefaultFramebuffer is available only through global instance */
 /* DimensionTraits forward declaration is not needed */
 
+#ifndef MAGNUM_TARGET_GLES
+class DrawCommandList;
+#endif
+
 class Extension;
 class Framebuffer;
 
@@ -134,6 +138,8 @@ enum class SamplerDepthStencilMode: GLenum;
 
 class Sampler;
 class Shader;
+class ShaderProgramCache;
+class StreamingBuffer;
 
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
@@ -108,6 +108,7 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getParameterImplementation = &Buffer::getParameterImplementationDSA;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSA;
         dataImplementation = &Buffer::dataImplementationDSA;
+        storageImplementation = &Buffer::storageImplementationDSA;
         subDataImplementation = &Buffer::subDataImplementationDSA;
         mapImplementation = &Buffer::mapImplementationDSA;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSA;
@@ -120,6 +121,7 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getParameterImplementation = &Buffer::getParameterImplementationDSAEXT;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSAEXT;
         dataImplementation = &Buffer::dataImplementationDSAEXT;
+        storageImplementation = &Buffer::storageImplementationDSAEXT;
         subDataImplementation = &Buffer::subDataImplementationDSAEXT;
         mapImplementation = &Buffer::mapImplementationDSAEXT;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSAEXT;
@@ -136,6 +138,9 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getSubDataImplementation = &Buffer::getSubDataImplementationDefault;
         #endif
         dataImplementation = &Buffer::dataImplementationDefault;
+        #ifndef MAGNUM_TARGET_GLES
+        storageImplementation = &Buffer::storageImplementationDefault;
+        #endif
         subDataImplementation = &Buffer::subDataImplementationDefault;
         #ifndef MAGNUM_TARGET_WEBGL
         mapImplementation = &Buffer::mapImplementationDefault;
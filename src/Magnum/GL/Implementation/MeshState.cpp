@@ -28,6 +28,9 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/MeshView.h"
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/GL/DrawCommandList.h"
+#endif
 
 #include "State.h"
 
@@ -98,6 +101,15 @@ MeshState::MeshState(Context& context, ContextState& contextState, std::vector<s
     }
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    /* Draw command list implementation */
+    if(context.isExtensionSupported<Extensions::ARB::multi_draw_indirect>()) {
+        extensions.emplace_back(Extensions::ARB::multi_draw_indirect::string());
+
+        drawCommandListImplementation = &DrawCommandList::drawImplementationIndirect;
+    } else drawCommandListImplementation = &DrawCommandList::drawImplementationFallback;
+    #endif
+
     #ifdef MAGNUM_TARGET_GLES
     #ifndef MAGNUM_TARGET_WEBGL
     /* Multi draw implementation on ES */
@@ -58,7 +58,9 @@ struct MeshState {
     void(Mesh::*drawElementsInstancedImplementation)(GLsizei, GLintptr, GLsizei);
     #endif
 
-    #ifdef MAGNUM_TARGET_GLES
+    #ifndef MAGNUM_TARGET_GLES
+    void(DrawCommandList::*drawCommandListImplementation)();
+    #else
     void(*multiDrawImplementation)(std::initializer_list<std::reference_wrapper<MeshView>>);
     #endif
 
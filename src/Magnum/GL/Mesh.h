@@ -290,6 +290,9 @@ drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also
 @ref draw() for more information.
  */
 class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
+    #ifndef MAGNUM_TARGET_GLES
+    friend DrawCommandList;
+    #endif
     friend MeshView;
     friend Implementation::MeshState;
 
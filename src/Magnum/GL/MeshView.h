@@ -61,6 +61,9 @@ You must ensure that the original mesh remains available for whole view
 lifetime.
 */
 class MAGNUM_GL_EXPORT MeshView {
+    #ifndef MAGNUM_TARGET_GLES
+    friend DrawCommandList;
+    #endif
     friend Implementation::MeshState;
 
     public:
@@ -77,7 +80,9 @@ class MAGNUM_GL_EXPORT MeshView {
          * available, the associated vertex array object is bound instead of
          * setting up the mesh from scratch.
          * @attention All meshes must be views of the same original mesh and
-         *      must not be instanced.
+         *      must not be instanced. On desktop OpenGL, use
+         *      @ref DrawCommandList for drawing instanced views or for
+         *      submitting the same set of views repeatedly.
          * @see @ref draw(AbstractShaderProgram&), @fn_gl{UseProgram},
          *      @fn_gl_keyword{EnableVertexAttribArray}, @fn_gl{BindBuffer},
          *      @fn_gl_keyword{VertexAttribPointer}, @fn_gl_keyword{DisableVertexAttribArray}
@@ -747,13 +747,16 @@ Shader& Shader::addFile(const std::string& filename) {
 }
 
 bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
-    bool allSuccess = true;
+    submitCompile(shaders);
+    return checkCompile(shaders);
+}
 
+void Shader::submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
     /* Allocate large enough array for source pointers and sizes (to avoid
        reallocating it for each of them) */
     std::size_t maxSourceCount = 0;
     for(Shader& shader: shaders) {
-        CORRADE_ASSERT(shader._sources.size() > 1, "GL::Shader::compile(): no files added", false);
+        CORRADE_ASSERT(shader._sources.size() > 1, "GL::Shader::compile(): no files added", );
         maxSourceCount = std::max(shader._sources.size(), maxSourceCount);
     }
     /** @todo ArrayTuple/VLAs */
@@ -772,8 +775,12 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
 
     /* Invoke (possibly parallel) compilation on all shaders */
     for(Shader& shader: shaders) glCompileShader(shader._id);
+}
 
-    /* After compilation phase, check status of all shaders */
+bool Shader::checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    bool allSuccess = true;
+
+    /* Check status of all shaders */
     Int i = 1;
     for(Shader& shader: shaders) {
         GLint success, logLength;
@@ -810,6 +817,22 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
     return allSuccess;
 }
 
+bool Shader::isCompileFinished() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(Context::current().isExtensionSupported<Extensions::KHR::parallel_shader_compile>()
+        #ifndef MAGNUM_TARGET_GLES
+        || Context::current().isExtensionSupported<Extensions::ARB::parallel_shader_compile>()
+        #endif
+    ) {
+        GLint success;
+        glGetShaderiv(_id, GL_COMPLETION_STATUS_KHR, &success);
+        return success == GL_TRUE;
+    }
+    #endif
+
+    return true;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 Debug& operator<<(Debug& debug, const Shader::Type value) {
     switch(value) {
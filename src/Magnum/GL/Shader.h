@@ -34,6 +34,7 @@
 #include <vector>
 #include <Corrade/Containers/ArrayView.h>
 
+#include "Magnum/Tags.h"
 #include "Magnum/GL/AbstractObject.h"
 #include "Magnum/GL/GL.h"
 
@@ -493,13 +494,44 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          * @cpp true @ce if everything succeeded. Compiler messages (if any)
          * are printed to error output. The operation is batched in a way that
          * allows the driver to perform multiple compilations simultaneously
-         * (i.e. in multiple threads).
+         * (i.e. in multiple threads). Equivalent to calling
+         * @ref submitCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * followed by @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>).
          * @see @fn_gl_keyword{ShaderSource}, @fn_gl_keyword{CompileShader},
          *      @fn_gl_keyword{GetShader} with @def_gl{COMPILE_STATUS} and
          *      @def_gl{INFO_LOG_LENGTH}, @fn_gl_keyword{GetShaderInfoLog}
          */
         static bool compile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for compilation
+         *
+         * First half of @ref compile(std::initializer_list<std::reference_wrapper<Shader>>),
+         * uploads sources of all shaders and starts the compilation without
+         * waiting for the result. Poll @ref isCompileFinished() and then call
+         * @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * to get the result. If neither @gl_extension{KHR,parallel_shader_compile}
+         * nor @gl_extension{ARB,parallel_shader_compile} is supported, the
+         * driver may still compile in the background, but there's no way to
+         * find out whether it finished without blocking.
+         * @see @fn_gl_keyword{ShaderSource}, @fn_gl_keyword{CompileShader}
+         */
+        static void submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        /**
+         * @brief Check compilation status of multiple shaders
+         *
+         * Second half of @ref compile(std::initializer_list<std::reference_wrapper<Shader>>),
+         * expects that @ref submitCompile() was called on all @p shaders
+         * before. Blocks until the compilation finishes, returns
+         * @cpp false @ce if compilation of any shader failed and
+         * @cpp true @ce if everything succeeded. Compiler messages (if any)
+         * are printed to error output.
+         * @see @fn_gl_keyword{GetShader} with @def_gl{COMPILE_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl_keyword{GetShaderInfoLog}
+         */
+        static bool checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
         /**
          * @brief Constructor
          * @param version   Target version
@@ -513,6 +545,19 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          */
         explicit Shader(Version version, Type type);
 
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref Shader(Version, Type)
+         */
+        explicit Shader(NoCreateT) noexcept: _type{}, _id{0} {}
+
         /** @brief Copying is not allowed */
         Shader(const Shader&) = delete;
 
@@ -616,6 +661,35 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          */
         bool compile() { return compile({*this}); }
 
+        /**
+         * @brief Submit shader for compilation
+         *
+         * Single-shader version of @ref submitCompile(std::initializer_list<std::reference_wrapper<Shader>>).
+         */
+        void submitCompile() { submitCompile({*this}); }
+
+        /**
+         * @brief Check shader compilation status
+         *
+         * Single-shader version of @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>).
+         */
+        bool checkCompile() { return checkCompile({*this}); }
+
+        /**
+         * @brief Whether the compilation has finished
+         *
+         * Expects that @ref submitCompile() was called before. If
+         * @gl_extension{KHR,parallel_shader_compile} or
+         * @gl_extension{ARB,parallel_shader_compile} is supported, returns
+         * whether the driver finished compiling the shader, so the following
+         * @ref checkCompile() call won't block. Otherwise always returns
+         * @cpp true @ce.
+         * @see @fn_gl_keyword{GetShader} with @def_gl{COMPLETION_STATUS_KHR}
+         * @requires_gles Parallel shader compilation is not available in
+         *      WebGL, there the function always returns @cpp true @ce.
+         */
+        bool isCompileFinished();
+
     private:
         Shader& setLabelInternal(Containers::ArrayView<const char> label);
 
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderProgramCache.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+
+namespace Magnum { namespace GL {
+
+namespace {
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    #ifndef CORRADE_TARGET_APPLE
+    thread_local
+    #else
+    __thread
+    #endif
+    #endif
+    ShaderProgramCache* currentCache = nullptr;
+
+    /* Cache file header, followed by the binary itself. Files are never
+       shared between machines, so native endianness is fine. */
+    struct CacheFileHeader {
+        char signature[4];
+        UnsignedInt format;
+    };
+
+    constexpr const char CacheFileSignature[]{'M', 'S', 'P', 'B'};
+}
+
+ShaderProgramCache* ShaderProgramCache::current() { return currentCache; }
+
+ShaderProgramCache::ShaderProgramCache(std::string directory): _previous{currentCache}, _directory{std::move(directory)} {
+    Context& context = Context::current();
+
+    /* Separating the strings with \0 so e.g. renderer "AB" + version "C"
+       doesn't hash the same as "A" + "BC" */
+    _driver = context.vendorString();
+    _driver += '\0';
+    _driver += context.rendererString();
+    _driver += '\0';
+    _driver += context.versionString();
+    _driver += '\0';
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.isExtensionSupported<Extensions::ARB::get_program_binary>())
+    #endif
+    {
+        /* Some drivers expose the extension but don't support any format */
+        GLint formatCount;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if(formatCount > 0) {
+            _formats = Containers::Array<Int>{std::size_t(formatCount)};
+            glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, _formats);
+        }
+    }
+    #endif
+
+    currentCache = this;
+}
+
+ShaderProgramCache::~ShaderProgramCache() {
+    if(currentCache == this) currentCache = _previous;
+}
+
+std::string ShaderProgramCache::key(const std::initializer_list<std::reference_wrapper<const Shader>> shaders, const std::string& extra) const {
+    Utility::Sha1 sha1;
+    sha1 << _driver;
+    for(const Shader& shader: shaders) {
+        const GLenum type = GLenum(shader.type());
+        sha1 << std::string{reinterpret_cast<const char*>(&type), sizeof(GLenum)};
+        /* Source boundaries don't matter to the compiler, so neither do they
+           matter here */
+        for(const std::string& source: shader.sources()) sha1 << source;
+        sha1 << std::string(1, '\0');
+    }
+    sha1 << extra;
+    return sha1.digest().hexString();
+}
+
+std::string ShaderProgramCache::filename(const std::string& key) const {
+    return Utility::Directory::join(_directory, key + ".bin");
+}
+
+bool ShaderProgramCache::load(AbstractShaderProgram& program, const std::string& key) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(isSupported()) {
+        /* Make the binary retrievable in case we need to link the program
+           from sources and save it afterwards. Has no effect on a binary
+           loaded below. */
+        glProgramParameteri(program.id(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+        const std::string file = filename(key);
+        if(Utility::Directory::exists(file)) {
+            const Containers::Array<char> data = Utility::Directory::read(file);
+            if(data.size() > sizeof(CacheFileHeader) && std::memcmp(data, CacheFileSignature, 4) == 0) {
+                CacheFileHeader header;
+                std::memcpy(&header, data, sizeof(CacheFileHeader));
+
+                /* Passing an unsupported format would be a GL error */
+                bool formatSupported = false;
+                for(const Int format: _formats) if(UnsignedInt(format) == header.format) {
+                    formatSupported = true;
+                    break;
+                }
+
+                /* The driver is free to reject the binary (e.g. after an
+                   update that didn't change the version string), in which
+                   case the program needs to be linked from sources */
+                GLint success = GL_FALSE;
+                if(formatSupported) {
+                    glProgramBinary(program.id(), header.format, data + sizeof(CacheFileHeader), data.size() - sizeof(CacheFileHeader));
+                    glGetProgramiv(program.id(), GL_LINK_STATUS, &success);
+                }
+                if(success) {
+                    ++_hits;
+                    return true;
+                }
+            }
+        }
+    }
+    #else
+    static_cast<void>(program);
+    static_cast<void>(key);
+    #endif
+
+    ++_misses;
+    return false;
+}
+
+bool ShaderProgramCache::save(AbstractShaderProgram& program, const std::string& key) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!isSupported()) return false;
+
+    GLint success, length;
+    glGetProgramiv(program.id(), GL_LINK_STATUS, &success);
+    CORRADE_ASSERT(success,
+        "GL::ShaderProgramCache::save(): the program is not linked", false);
+    glGetProgramiv(program.id(), GL_PROGRAM_BINARY_LENGTH, &length);
+
+    Containers::Array<char> data{sizeof(CacheFileHeader) + std::size_t(length)};
+    CacheFileHeader header;
+    std::memcpy(header.signature, CacheFileSignature, 4);
+    GLenum format;
+    glGetProgramBinary(program.id(), length, nullptr, &format, data + sizeof(CacheFileHeader));
+    header.format = format;
+    std::memcpy(data, &header, sizeof(CacheFileHeader));
+
+    if(!Utility::Directory::mkpath(_directory)) {
+        Error() << "GL::ShaderProgramCache::save(): can't create directory" << _directory;
+        return false;
+    }
+
+    /* Directory::write() prints a message on its own */
+    return Utility::Directory::write(filename(key), data);
+    #else
+    static_cast<void>(program);
+    static_cast<void>(key);
+    return false;
+    #endif
+}
+
+bool ShaderProgramCache::loadCurrent(AbstractShaderProgram& program, const std::initializer_list<std::reference_wrapper<const Shader>> shaders, std::string& key) {
+    ShaderProgramCache* const cache = current();
+    if(!cache) {
+        key = {};
+        return false;
+    }
+
+    key = cache->key(shaders);
+    if(!cache->load(program, key)) return false;
+
+    /* Nothing to save on a hit */
+    key = {};
+    return true;
+}
+
+void ShaderProgramCache::saveCurrent(AbstractShaderProgram& program, const std::string& key) {
+    ShaderProgramCache* const cache = current();
+    if(cache && !key.empty()) cache->save(program, key);
+}
+
+}}
@@ -0,0 +1,220 @@
+#ifndef Magnum_GL_ShaderProgramCache_h
+#define Magnum_GL_ShaderProgramCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::ShaderProgramCache
+ */
+
+#include <initializer_list>
+#include <functional>
+#include <string>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/GL/visibility.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief On-disk shader program binary cache
+
+Stores linked shader program binaries in a directory and restores them on
+subsequent runs, avoiding the GLSL compilation and linking step. Binaries are
+keyed by a hash of all shader sources, shader types and the
+@ref Context::vendorString(), @ref Context::rendererString() and
+@ref Context::versionString(), so a driver update or a different GPU
+transparently results in a cache miss instead of a broken program.
+
+@section GL-ShaderProgramCache-usage Usage
+
+Create an instance with a writable directory after the @ref Context is
+created. While it exists, it's available through @ref current() and the
+builtin shaders in the @ref Shaders library use it automatically:
+
+@snippet MagnumGL.cpp ShaderProgramCache-usage
+
+@section GL-ShaderProgramCache-subclassing Usage in custom shaders
+
+Populate the shader sources, then call @ref loadCurrent(). If it fails,
+compile, attach and link the shaders the usual way and then pass the program
+together with the returned key to @ref saveCurrent():
+
+@snippet MagnumGL.cpp ShaderProgramCache-subclassing
+
+Attribute and fragment output locations bound before linking are part of the
+stored binary, uniform locations have to be queried after both a cache hit and
+a cache miss.
+
+@requires_gl41 Extension @gl_extension{ARB,get_program_binary}. If not
+    available, @ref load() always fails and @ref save() does nothing.
+@requires_gles30 Program binaries are not supported in OpenGL ES 2.0. If
+    compiled for it, @ref load() always fails and @ref save() does nothing.
+@requires_gles Program binaries are not supported in WebGL. If compiled for
+    it, @ref load() always fails and @ref save() does nothing.
+*/
+class MAGNUM_GL_EXPORT ShaderProgramCache {
+    public:
+        /**
+         * @brief Current cache
+         *
+         * The cache that was created last, if it wasn't destroyed yet.
+         * Returns @cpp nullptr @ce if there's no cache. In a multithreaded
+         * build the current cache is thread-local, same as the current
+         * @ref Context.
+         */
+        static ShaderProgramCache* current();
+
+        /**
+         * @brief Constructor
+         * @param directory     Directory to store the binaries in
+         *
+         * Makes the cache current, the previously current cache (if any) is
+         * made current again once this instance is destroyed. The directory
+         * is created on first @ref save() if it doesn't exist yet. Expects
+         * that a @ref Context is current.
+         */
+        explicit ShaderProgramCache(std::string directory);
+
+        /** @brief Copying is not allowed */
+        ShaderProgramCache(const ShaderProgramCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderProgramCache(ShaderProgramCache&&) = delete;
+
+        ~ShaderProgramCache();
+
+        /** @brief Copying is not allowed */
+        ShaderProgramCache& operator=(const ShaderProgramCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderProgramCache& operator=(ShaderProgramCache&&) = delete;
+
+        /** @brief Cache directory */
+        std::string directory() const { return _directory; }
+
+        /**
+         * @brief Whether program binaries are supported
+         *
+         * Returns @cpp false @ce if @gl_extension{ARB,get_program_binary} is
+         * not supported or the driver reports no binary formats, in which case
+         * the cache does nothing.
+         * @see @fn_gl{Get} with @def_gl{NUM_PROGRAM_BINARY_FORMATS} and
+         *      @def_gl{PROGRAM_BINARY_FORMATS}
+         */
+        bool isSupported() const { return !_formats.empty(); }
+
+        /**
+         * @brief Cache key for given shaders
+         * @param shaders   Shaders that are going to be linked into the
+         *      program, with all sources already added
+         * @param extra     Additional data affecting the result, such as
+         *      attribute locations that are not specified in the sources
+         *
+         * Returns a hex-encoded SHA-1 hash of shader types and sources,
+         * @p extra and driver identification strings.
+         */
+        std::string key(std::initializer_list<std::reference_wrapper<const Shader>> shaders, const std::string& extra = {}) const;
+
+        /**
+         * @brief Load a program binary
+         *
+         * If a binary for @p key exists, is in one of the formats supported by
+         * the driver and the driver accepts it, the
+         * @p program is linked from it, @ref hits() is incremented and
+         * @cpp true @ce is returned. Otherwise @ref misses() is incremented
+         * and @cpp false @ce is returned. In that case, if binaries are
+         * supported, the program is marked as retrievable, so it's possible
+         * to @ref save() it after linking.
+         * @see @fn_gl_keyword{ProgramBinary}, @fn_gl{GetProgram} with
+         *      @def_gl{LINK_STATUS}, @fn_gl{ProgramParameter} with
+         *      @def_gl{PROGRAM_BINARY_RETRIEVABLE_HINT}
+         */
+        bool load(AbstractShaderProgram& program, const std::string& key);
+
+        /**
+         * @brief Save a program binary
+         *
+         * Expects that @p program was successfully linked. Returns
+         * @cpp false @ce and prints a message to @ref Error if the binary
+         * can't be written, does nothing and returns @cpp false @ce if
+         * binaries are not supported.
+         * @see @fn_gl{GetProgram} with @def_gl{PROGRAM_BINARY_LENGTH},
+         *      @fn_gl_keyword{GetProgramBinary}
+         */
+        bool save(AbstractShaderProgram& program, const std::string& key);
+
+        /**
+         * @brief Load a program binary using the current cache
+         * @param[in] program   Program to load the binary into
+         * @param[in] shaders   Shaders that are going to be linked into the
+         *      program, with all sources already added
+         * @param[out] key      Key to pass to @ref saveCurrent() once the
+         *      program is linked
+         *
+         * If there's a @ref current() cache, calls @ref load() with
+         * @ref key() of @p shaders and returns its result. On a miss, @p key
+         * is set to the cache key, otherwise and if there's no current cache
+         * it's set to an empty string.
+         */
+        static bool loadCurrent(AbstractShaderProgram& program, std::initializer_list<std::reference_wrapper<const Shader>> shaders, std::string& key);
+
+        /**
+         * @brief Save a program binary using the current cache
+         *
+         * If there's a @ref current() cache and @p key is not empty, calls
+         * @ref save(), otherwise does nothing. Expects that @p program was
+         * successfully linked.
+         * @see @ref loadCurrent()
+         */
+        static void saveCurrent(AbstractShaderProgram& program, const std::string& key);
+
+        /** @brief Count of programs loaded from the cache */
+        UnsignedInt hits() const { return _hits; }
+
+        /** @brief Count of programs not found in the cache */
+        UnsignedInt misses() const { return _misses; }
+
+        /**
+         * @brief Reset hit and miss statistics
+         *
+         * @see @ref hits(), @ref misses()
+         */
+        void resetStatistics() { _hits = _misses = 0; }
+
+    private:
+        std::string MAGNUM_GL_LOCAL filename(const std::string& key) const;
+
+        ShaderProgramCache* _previous;
+        std::string _directory, _driver;
+        Containers::Array<Int> _formats;
+        UnsignedInt _hits{}, _misses{};
+};
+
+}}
+
+#endif
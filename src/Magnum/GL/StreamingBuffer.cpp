@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StreamingBuffer.h"
+
+#include <utility>
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+
+namespace Magnum { namespace GL {
+
+StreamingBuffer::StreamingBuffer(const std::size_t frameSize, const UnsignedInt frameCount, const Buffer::TargetHint targetHint): _buffer{targetHint}, _frameSize{frameSize}, _frameCount{frameCount} {
+    CORRADE_ASSERT(frameSize && frameCount,
+        "GL::StreamingBuffer: expected non-zero frame size and count", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>()) {
+        const std::size_t size = frameSize*frameCount;
+        _buffer.setStorage({nullptr, size}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+        _mapped = _buffer.map(0, size, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent).data();
+        CORRADE_INTERNAL_ASSERT(_mapped);
+        _fences = Containers::Array<GLsync>{Containers::ValueInit, frameCount};
+        return;
+    }
+    #endif
+
+    _buffer.setData({nullptr, frameSize}, BufferUsage::StreamDraw);
+    _data = Containers::Array<char>{Containers::NoInit, frameSize};
+}
+
+StreamingBuffer::StreamingBuffer(NoCreateT) noexcept: _buffer{NoCreate} {}
+
+StreamingBuffer::StreamingBuffer(StreamingBuffer&& other) noexcept: _buffer{std::move(other._buffer)}, _frameSize{other._frameSize}, _offset{other._offset}, _flushed{other._flushed}, _frameCount{other._frameCount}, _frame{other._frame}, _mapped{other._mapped}, _data{std::move(other._data)}
+    #ifndef MAGNUM_TARGET_GLES
+    , _fences{std::move(other._fences)}
+    #endif
+{
+    other._frameSize = other._offset = other._flushed = 0;
+    other._frameCount = other._frame = 0;
+    other._mapped = nullptr;
+}
+
+StreamingBuffer::~StreamingBuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+    #endif
+}
+
+StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexcept {
+    using std::swap;
+    swap(_buffer, other._buffer);
+    swap(_frameSize, other._frameSize);
+    swap(_offset, other._offset);
+    swap(_flushed, other._flushed);
+    swap(_frameCount, other._frameCount);
+    swap(_frame, other._frame);
+    swap(_mapped, other._mapped);
+    swap(_data, other._data);
+    #ifndef MAGNUM_TARGET_GLES
+    swap(_fences, other._fences);
+    #endif
+    return *this;
+}
+
+std::pair<GLintptr, Containers::ArrayView<char>> StreamingBuffer::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment,
+        "GL::StreamingBuffer::allocate(): expected non-zero alignment", {});
+    const std::size_t offset = (_offset + alignment - 1)/alignment*alignment;
+    CORRADE_ASSERT(offset <= _frameSize && size <= _frameSize - offset,
+        "GL::StreamingBuffer::allocate(): can't allocate" << size << "bytes with alignment" << alignment << Debug::nospace << "," << availableSize() << "bytes available in the frame", {});
+    _offset = offset + size;
+
+    if(_mapped) {
+        const std::size_t frameOffset = _frame*_frameSize + offset;
+        return {GLintptr(frameOffset), {_mapped + frameOffset, size}};
+    }
+
+    return {GLintptr(offset), {_data + offset, size}};
+}
+
+void StreamingBuffer::flush() {
+    if(_mapped || _flushed == _offset) return;
+
+    _buffer.setSubData(_flushed, {_data + _flushed, _offset - _flushed});
+    _flushed = _offset;
+}
+
+void StreamingBuffer::nextFrame() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(_mapped) {
+        /* Mark the end of commands using current region */
+        CORRADE_INTERNAL_ASSERT(!_fences[_frame]);
+        _fences[_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        /* Wait until the GPU is done with the region that's going to be
+           reused. The first wait flushes the command queue so the fence is
+           guaranteed to be signaled eventually. */
+        _frame = (_frame + 1) % _frameCount;
+        if(GLsync& fence = _fences[_frame]) {
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            GLenum result;
+            while((result = glClientWaitSync(fence, flags, 1000000)) == GL_TIMEOUT_EXPIRED)
+                flags = 0;
+            CORRADE_INTERNAL_ASSERT(result != GL_WAIT_FAILED);
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        _offset = 0;
+        return;
+    }
+    #endif
+
+    /* Orphan the storage so the next frame doesn't need to wait for draws
+       using the data of this one */
+    if(_offset) _buffer.setData({nullptr, _frameSize}, BufferUsage::StreamDraw);
+
+    _frame = (_frame + 1) % _frameCount;
+    _offset = _flushed = 0;
+}
+
+}}
@@ -0,0 +1,198 @@
+#ifndef Magnum_GL_StreamingBuffer_h
+#define Magnum_GL_StreamingBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::GL::StreamingBuffer
+ */
+
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Buffer.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Streaming buffer ring
+
+Sub-allocates data that changes every frame, such as text, debug geometry or
+particles, from one large buffer instead of re-specifying a buffer with
+@ref Buffer::setData() each frame, which causes driver-side copies and
+implicit synchronization.
+
+The buffer is split into @ref frameCount() regions of @ref frameSize() bytes.
+Each frame, data are allocated from the current region using @ref allocate()
+and written directly through the returned view. The returned offset is then
+used to point a mesh to the data in @ref buffer(). After submitting all draws
+of a frame, call @ref nextFrame(), which moves to the next region.
+
+@snippet MagnumGL.cpp StreamingBuffer-usage
+
+@section GL-StreamingBuffer-persistent Persistent mapping
+
+If @gl_extension{ARB,buffer_storage} (part of OpenGL 4.4) is supported, the
+whole buffer is created with immutable storage using @ref Buffer::setStorage()
+and stays mapped with @ref Buffer::MapFlag::Persistent and
+@ref Buffer::MapFlag::Coherent for its whole lifetime, so @ref allocate()
+returns a view directly into GPU-visible memory. @ref nextFrame() places a
+fence after the commands of current frame and waits until the GPU is done
+with the region that's about to be reused, which with at least two frames in
+flight usually means no wait at all.
+
+@section GL-StreamingBuffer-fallback Orphaning fallback
+
+On OpenGL ES, WebGL and desktop drivers without
+@gl_extension{ARB,buffer_storage} the buffer has a size of just one frame and
+@ref allocate() returns a view into client memory. The data are uploaded with
+@ref Buffer::setSubData() in @ref flush(), which thus has to be called after
+writing the data and before drawing them. In @ref nextFrame() the buffer
+storage is orphaned by calling @ref Buffer::setData() with
+@cpp nullptr @ce, letting the driver allocate a fresh storage instead of
+waiting for the draws that use the previous one. With persistent mapping
+@ref flush() is a no-op, so it's safe to call it unconditionally.
+
+@see @ref isPersistent(), @ref Text::Renderer::render(AbstractFont&, const GlyphCache&, Float, const std::string&, GL::StreamingBuffer&, GL::StreamingBuffer&, Alignment)
+*/
+class MAGNUM_GL_EXPORT StreamingBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameSize     Size of the region available to each frame
+         * @param frameCount    Count of frames in flight
+         * @param targetHint    Target hint for the underlying buffer
+         *
+         * Expects that both @p frameSize and @p frameCount are non-zero.
+         * @see @ref Buffer::setStorage(), @ref Buffer::map(),
+         *      @ref Buffer::setData()
+         */
+        explicit StreamingBuffer(std::size_t frameSize, UnsignedInt frameCount = 3, Buffer::TargetHint targetHint = Buffer::TargetHint::Array);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit StreamingBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer(const StreamingBuffer&) = delete;
+
+        /** @brief Move constructor */
+        StreamingBuffer(StreamingBuffer&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences and the underlying buffer.
+         */
+        ~StreamingBuffer();
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+        /** @brief Move assignment */
+        StreamingBuffer& operator=(StreamingBuffer&&) noexcept;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Size of the region available to each frame */
+        std::size_t frameSize() const { return _frameSize; }
+
+        /** @brief Count of frames in flight */
+        UnsignedInt frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         * See @ref GL-StreamingBuffer-persistent and
+         * @ref GL-StreamingBuffer-fallback for more information.
+         */
+        bool isPersistent() const { return _mapped; }
+
+        /** @brief Count of bytes allocated in current frame */
+        std::size_t usedSize() const { return _offset; }
+
+        /** @brief Count of bytes still available in current frame */
+        std::size_t availableSize() const { return _frameSize - _offset; }
+
+        /**
+         * @brief Allocate data in current frame
+         * @param size          Size in bytes
+         * @param alignment     Alignment of the allocation offset
+         * @return Offset into @ref buffer() and a view to write the data to
+         *
+         * Expects that the aligned allocation fits into
+         * @ref availableSize(). The view is valid only until the next call to
+         * @ref nextFrame() and the data have to be written before drawing
+         * them, followed by a call to @ref flush().
+         */
+        std::pair<GLintptr, Containers::ArrayView<char>> allocate(std::size_t size, std::size_t alignment = 4);
+
+        /**
+         * @brief Make the allocated data available to the GPU
+         *
+         * If the buffer is not persistently mapped, uploads the data
+         * allocated in current frame since the last call. Otherwise does
+         * nothing.
+         * @see @ref isPersistent(), @ref Buffer::setSubData()
+         */
+        void flush();
+
+        /**
+         * @brief Move to the next frame
+         *
+         * Call after all draws using data of current frame were submitted.
+         * All allocations of current frame are released. If the buffer is
+         * persistently mapped, places a fence after current frame commands
+         * and waits on the fence placed @ref frameCount() frames ago.
+         * Otherwise orphans the buffer storage, if anything was allocated.
+         * @see @fn_gl_keyword{FenceSync}, @fn_gl_keyword{ClientWaitSync},
+         *      @ref Buffer::setData()
+         */
+        void nextFrame();
+
+    private:
+        Buffer _buffer;
+        std::size_t _frameSize{}, _offset{}, _flushed{};
+        UnsignedInt _frameCount{}, _frame{};
+        char* _mapped{};
+        Containers::Array<char> _data;
+        #ifndef MAGNUM_TARGET_GLES
+        Containers::Array<GLsync> _fences;
+        #endif
+};
+
+}}
+
+#endif
@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/Utility/Resource.h>
+#include <Corrade/Utility/System.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Image.h"
@@ -62,6 +63,7 @@ struct AbstractShaderProgramGLTest: OpenGLTester {
     #endif
 
     void linkFailure();
+    void linkAsync();
     void uniformNotFound();
 
     void uniform();
@@ -101,6 +103,7 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
               #endif
 
               &AbstractShaderProgramGLTest::linkFailure,
+              &AbstractShaderProgramGLTest::linkAsync,
               &AbstractShaderProgramGLTest::uniformNotFound,
 
               &AbstractShaderProgramGLTest::uniform,
@@ -189,6 +192,8 @@ struct MyPublicShader: AbstractShaderProgram {
     using AbstractShaderProgram::bindFragmentDataLocation;
     #endif
     using AbstractShaderProgram::link;
+    using AbstractShaderProgram::submitLink;
+    using AbstractShaderProgram::checkLink;
     using AbstractShaderProgram::uniformLocation;
     #ifndef MAGNUM_TARGET_GLES2
     using AbstractShaderProgram::uniformBlockIndex;
@@ -388,6 +393,53 @@ void AbstractShaderProgramGLTest::linkFailure() {
     CORRADE_VERIFY(!program.link());
 }
 
+void AbstractShaderProgramGLTest::linkAsync() {
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    Shader vert(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Vertex);
+    vert.addSource(rs.get("MyShader.vert"));
+
+    Shader frag(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Fragment);
+    frag.addSource(rs.get("MyShader.frag"));
+
+    /* Neither the compilation nor linking is checked until the end */
+    Shader::submitCompile({vert, frag});
+
+    MyPublicShader program;
+    program.attachShaders({vert, frag});
+    program.bindAttributeLocation(0, "position");
+    program.submitLink();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    while(!program.isLinkFinished())
+        Utility::System::sleep(1);
+
+    CORRADE_VERIFY(program.checkLink());
+    CORRADE_VERIFY(program.isLinkFinished());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void AbstractShaderProgramGLTest::uniformNotFound() {
     MyPublicShader program;
 
@@ -52,6 +52,10 @@ struct BufferGLTest: OpenGLTester {
     #endif
 
     void data();
+    #ifndef MAGNUM_TARGET_GLES
+    void storage();
+    void storageMapPersistent();
+    #endif
     #ifndef MAGNUM_TARGET_WEBGL
     void map();
     void mapRange();
@@ -78,6 +82,10 @@ BufferGLTest::BufferGLTest() {
               #endif
 
               &BufferGLTest::data,
+              #ifndef MAGNUM_TARGET_GLES
+              &BufferGLTest::storage,
+              &BufferGLTest::storageMapPersistent,
+              #endif
               #ifndef MAGNUM_TARGET_WEBGL
               &BufferGLTest::map,
               &BufferGLTest::mapRange,
@@ -265,6 +273,60 @@ void BufferGLTest::data() {
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void BufferGLTest::storage() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::ARB::buffer_storage::string() + std::string(" is not supported"));
+
+    constexpr Int data[] = {2, 7, 5, 13, 25};
+    Buffer buffer;
+    buffer.setStorage(data, Buffer::StorageFlag::DynamicStorage);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(buffer.size(), 5*4);
+
+    constexpr Int subData[] = {125, 3, 15};
+    buffer.setSubData(4, subData);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    constexpr Int expected[] = {2, 125, 3, 15, 25};
+    Containers::Array<char> contents = buffer.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(contents),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void BufferGLTest::storageMapPersistent() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::ARB::buffer_storage::string() + std::string(" is not supported"));
+
+    Buffer buffer;
+    buffer.setStorage({nullptr, 5}, Buffer::StorageFlag::MapRead|Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::ArrayView<char> contents = buffer.map(0, 5, Buffer::MapFlag::Read|Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(contents);
+
+    /* The buffer can be used while mapped, coherent writes are visible to
+       the GPU without any flush */
+    contents[0] = 2;
+    contents[4] = 107;
+
+    Buffer copy;
+    copy.setData({nullptr, 5}, BufferUsage::StaticRead);
+    Buffer::copy(buffer, copy, 0, 0, 5);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<char> copied = copy.data();
+    CORRADE_COMPARE(copied[0], 2);
+    CORRADE_COMPARE(copied[4], 107);
+
+    CORRADE_VERIFY(buffer.unmap());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
 #ifndef MAGNUM_TARGET_WEBGL
 void BufferGLTest::map() {
     #ifdef MAGNUM_TARGET_GLES
@@ -30,6 +30,9 @@
 #include "Magnum/GL/AbstractShaderProgram.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/GL/DrawCommandList.h"
+#endif
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Mesh.h"
@@ -46,7 +49,7 @@
 
 namespace Magnum { namespace GL { namespace Test { namespace {
 
-/* Tests also the MeshView class. */
+/* Tests also the MeshView and DrawCommandList classes. */
 
 struct MeshGLTest: OpenGLTester {
     explicit MeshGLTest();
@@ -159,6 +162,13 @@ struct MeshGLTest: OpenGLTester {
     void multiDrawIndexed();
     #ifndef MAGNUM_TARGET_GLES
     void multiDrawBaseVertex();
+
+    void drawCommandList();
+    void drawCommandListIndexed();
+    void drawCommandListBaseVertex();
+    void drawCommandListBaseInstance();
+    void drawCommandListEmpty();
+    void drawCommandListAddWrongMesh();
     #endif
 };
 
@@ -280,7 +290,14 @@ MeshGLTest::MeshGLTest() {
               &MeshGLTest::multiDraw,
               &MeshGLTest::multiDrawIndexed,
               #ifndef MAGNUM_TARGET_GLES
-              &MeshGLTest::multiDrawBaseVertex
+              &MeshGLTest::multiDrawBaseVertex,
+
+              &MeshGLTest::drawCommandList,
+              &MeshGLTest::drawCommandListIndexed,
+              &MeshGLTest::drawCommandListBaseVertex,
+              &MeshGLTest::drawCommandListBaseInstance,
+              &MeshGLTest::drawCommandListEmpty,
+              &MeshGLTest::drawCommandListAddWrongMesh
               #endif
               });
 }
@@ -2641,7 +2658,9 @@ void MeshGLTest::resetDivisorAfterInstancedDraw() {
 }
 
 struct MultiChecker {
-    MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh);
+    /* If commandList is true, the views are drawn using DrawCommandList
+       instead of MeshView::draw() */
+    MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, bool commandList = false);
 
     template<class T> T get(PixelFormat format, PixelType type);
 
@@ -2650,7 +2669,7 @@ struct MultiChecker {
 };
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
-MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuffer({{}, Vector2i(1)}) {
+MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, bool commandList): framebuffer({{}, Vector2i(1)}) {
     renderbuffer.setStorage(
         #ifndef MAGNUM_TARGET_GLES2
         RenderbufferFormat::RGBA8,
@@ -2680,6 +2699,19 @@ MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuf
          .setIndexRange(1);
     } else c.setBaseVertex(1);
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(commandList) {
+        DrawCommandList list{mesh};
+        list.add(a)
+            .add(b)
+            .add(c)
+            .draw(shader);
+        return;
+    }
+    #else
+    static_cast<void>(commandList);
+    #endif
+
     MeshView::draw(shader, {a, b, c});
 }
 
@@ -2763,6 +2795,161 @@ void MeshGLTest::multiDrawBaseVertex() {
     MAGNUM_VERIFY_NO_GL_ERROR();
     CORRADE_COMPARE(value, indexedResult);
 }
+
+void MeshGLTest::drawCommandList() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        Debug() << Extensions::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::unpack<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(buffer, 4, Attribute());
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        mesh, true).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
+void MeshGLTest::drawCommandListIndexed() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        Debug() << Extensions::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                         MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, MeshIndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(MultipleShader{}, mesh, true).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
+
+void MeshGLTest::drawCommandListBaseVertex() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_elements_base_vertex>())
+        CORRADE_SKIP(Extensions::ARB::draw_elements_base_vertex::string() + std::string(" is not available."));
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        Debug() << Extensions::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    Buffer vertices;
+    vertices.setData(indexedVertexDataBaseVertex, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setBaseVertex(2)
+        .addVertexBuffer(vertices, 2*4,  MultipleShader::Position(),
+                         MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, MeshIndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(MultipleShader{}, mesh, true).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
+
+void MeshGLTest::drawCommandListBaseInstance() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::instanced_arrays>())
+        CORRADE_SKIP(Extensions::ARB::instanced_arrays::string() + std::string(" is not available."));
+    if(!Context::current().isExtensionSupported<Extensions::ARB::base_instance>())
+        CORRADE_SKIP(Extensions::ARB::base_instance::string() + std::string(" is not available."));
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        Debug() << Extensions::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = {
+        -0.7f,  /* First instance */
+        0.3f,   /* Second instance */
+        Math::unpack<Float, UnsignedByte>(96) /* Third instance */
+    };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBufferInstanced(buffer, 1, 0, Attribute{});
+
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i(1));
+    Framebuffer framebuffer{{{}, Vector2i(1)}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer)
+        .bind();
+
+    /* A single instance taking its data from the third one */
+    MeshView view{mesh};
+    view.setCount(1)
+        .setBaseInstance(2);
+
+    DrawCommandList list{mesh};
+    list.add(view)
+        .draw(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 96);
+}
+
+void MeshGLTest::drawCommandListEmpty() {
+    Mesh mesh;
+    DrawCommandList list{mesh};
+    CORRADE_VERIFY(list.isEmpty());
+    CORRADE_COMPARE(&list.mesh(), &mesh);
+
+    MeshView view{mesh};
+    view.setCount(3);
+    list.add(view).add(view);
+    CORRADE_COMPARE(list.size(), 2);
+
+    list.clear();
+    CORRADE_VERIFY(list.isEmpty());
+
+    /* Drawing an empty list should not touch any state */
+    list.draw(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLTest::drawCommandListAddWrongMesh() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Mesh a, b;
+    DrawCommandList list{a};
+
+    MeshView noCount{a};
+    MeshView wrongMesh{b};
+    wrongMesh.setCount(3);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    list.add(noCount)
+        .add(wrongMesh);
+    CORRADE_VERIFY(list.isEmpty());
+    CORRADE_COMPARE(out.str(),
+        "GL::DrawCommandList::add(): setCount() was never called on the view, probably a mistake?\n"
+        "GL::DrawCommandList::add(): the view is not a view of the original mesh\n");
+}
 #endif
 
 }}}}
@@ -24,6 +24,7 @@
 */
 
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/System.h>
 
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
@@ -49,6 +50,7 @@ struct ShaderGLTest: OpenGLTester {
     void addSourceNoVersion();
     void addFile();
     void compile();
+    void compileAsync();
     void compileUtf8();
     void compileNoVersion();
 };
@@ -66,6 +68,7 @@ ShaderGLTest::ShaderGLTest() {
               &ShaderGLTest::addSourceNoVersion,
               &ShaderGLTest::addFile,
               &ShaderGLTest::compile,
+              &ShaderGLTest::compileAsync,
               &ShaderGLTest::compileUtf8,
               &ShaderGLTest::compileNoVersion});
 }
@@ -266,6 +269,34 @@ void ShaderGLTest::compile() {
     CORRADE_VERIFY(!shader2.compile());
 }
 
+void ShaderGLTest::compileAsync() {
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version v =
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        ;
+    #else
+    constexpr Version v = Version::GLES200;
+    #endif
+
+    Shader shader(v, Shader::Type::Fragment);
+    shader.addSource("void main() {}\n");
+    Shader shader2(v, Shader::Type::Fragment);
+    shader2.addSource("[fu] bleh error #:! stuff\n");
+    Shader::submitCompile({shader, shader2});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    while(!shader.isCompileFinished() || !shader2.isCompileFinished())
+        Utility::System::sleep(1);
+
+    CORRADE_VERIFY(shader.checkCompile());
+    CORRADE_VERIFY(!shader2.checkCompile());
+}
+
 void ShaderGLTest::compileUtf8() {
     #ifndef MAGNUM_TARGET_GLES
     constexpr Version v =
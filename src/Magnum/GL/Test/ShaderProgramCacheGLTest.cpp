@@ -0,0 +1,292 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
+#include "Magnum/GL/Version.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct ShaderProgramCacheGLTest: OpenGLTester {
+    explicit ShaderProgramCacheGLTest();
+
+    void construct();
+    void constructNested();
+
+    void key();
+
+    void loadSave();
+    void loadInvalid();
+    void loadSaveCurrent();
+    void resetStatistics();
+};
+
+ShaderProgramCacheGLTest::ShaderProgramCacheGLTest() {
+    addTests({&ShaderProgramCacheGLTest::construct,
+              &ShaderProgramCacheGLTest::constructNested,
+
+              &ShaderProgramCacheGLTest::key,
+
+              &ShaderProgramCacheGLTest::loadSave,
+              &ShaderProgramCacheGLTest::loadInvalid,
+              &ShaderProgramCacheGLTest::loadSaveCurrent,
+              &ShaderProgramCacheGLTest::resetStatistics});
+}
+
+const std::string CacheDirectory = Utility::Directory::join(SHADERPROGRAMCACHEGLTEST_OUTPUT_DIR, "ShaderProgramCacheGLTest");
+
+constexpr Version ShaderVersion =
+    #ifndef MAGNUM_TARGET_GLES
+    #ifndef CORRADE_TARGET_APPLE
+    Version::GL210
+    #else
+    Version::GL310
+    #endif
+    #else
+    Version::GLES200
+    #endif
+    ;
+
+struct MyShader: AbstractShaderProgram {
+    static void addSources(Shader& vert, Shader& frag, const char* value) {
+        vert.addSource("void main() { gl_Position = vec4(0.0); }");
+        frag.addSource(
+            "#ifdef GL_ES\n"
+            "precision mediump float;\n"
+            "#endif\n"
+            "uniform vec4 color;\n"
+            #ifndef CORRADE_TARGET_APPLE
+            "void main() { gl_FragColor = color*")
+            #else
+            "out vec4 fragmentColor;\n"
+            "void main() { fragmentColor = color*")
+            #endif
+            .addSource(value)
+            .addSource("; }\n");
+    }
+
+    /* Returns true if the program was loaded from the cache */
+    bool create(ShaderProgramCache& cache, const char* value = "1.0") {
+        Shader vert{ShaderVersion, Shader::Type::Vertex};
+        Shader frag{ShaderVersion, Shader::Type::Fragment};
+        addSources(vert, frag, value);
+
+        const std::string key = cache.key({vert, frag});
+        if(cache.load(*this, key)) return true;
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+        attachShaders({vert, frag});
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+        cache.save(*this, key);
+        return false;
+    }
+
+    /* Same as above, but with the current cache */
+    bool createCurrent(const char* value) {
+        Shader vert{ShaderVersion, Shader::Type::Vertex};
+        Shader frag{ShaderVersion, Shader::Type::Fragment};
+        addSources(vert, frag, value);
+
+        std::string key;
+        if(ShaderProgramCache::loadCurrent(*this, {vert, frag}, key)) return true;
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+        attachShaders({vert, frag});
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+        ShaderProgramCache::saveCurrent(*this, key);
+        return false;
+    }
+
+    using AbstractShaderProgram::uniformLocation;
+};
+
+void ShaderProgramCacheGLTest::construct() {
+    CORRADE_VERIFY(!ShaderProgramCache::current());
+
+    {
+        ShaderProgramCache cache{CacheDirectory};
+        CORRADE_COMPARE(cache.directory(), CacheDirectory);
+        CORRADE_COMPARE(cache.hits(), 0);
+        CORRADE_COMPARE(cache.misses(), 0);
+        CORRADE_COMPARE(ShaderProgramCache::current(), &cache);
+    }
+
+    CORRADE_VERIFY(!ShaderProgramCache::current());
+}
+
+void ShaderProgramCacheGLTest::constructNested() {
+    ShaderProgramCache a{CacheDirectory};
+    CORRADE_COMPARE(ShaderProgramCache::current(), &a);
+
+    {
+        ShaderProgramCache b{CacheDirectory};
+        CORRADE_COMPARE(ShaderProgramCache::current(), &b);
+    }
+
+    CORRADE_COMPARE(ShaderProgramCache::current(), &a);
+}
+
+void ShaderProgramCacheGLTest::key() {
+    ShaderProgramCache cache{CacheDirectory};
+
+    Shader a{ShaderVersion, Shader::Type::Vertex};
+    a.addSource("void main() {}\n");
+    Shader b{ShaderVersion, Shader::Type::Vertex};
+    b.addSource("void main() {")
+     .addSource("}\n");
+    Shader c{ShaderVersion, Shader::Type::Fragment};
+    c.addSource("void main() {}\n");
+    Shader d{ShaderVersion, Shader::Type::Vertex};
+    d.addSource("void main() { }\n");
+
+    const std::string key = cache.key({a});
+    CORRADE_COMPARE(key.size(), 40);
+
+    /* Source boundaries don't matter */
+    CORRADE_COMPARE(cache.key({b}), key);
+
+    /* Shader type, sources and extra data do */
+    CORRADE_VERIFY(cache.key({c}) != key);
+    CORRADE_VERIFY(cache.key({d}) != key);
+    CORRADE_VERIFY(cache.key({a}, "extra") != key);
+    CORRADE_VERIFY(cache.key({a, c}) != cache.key({c, a}));
+}
+
+void ShaderProgramCacheGLTest::loadSave() {
+    /* Start with an empty cache */
+    for(const std::string& file: Utility::Directory::list(CacheDirectory, Utility::Directory::Flag::SkipDirectories))
+        Utility::Directory::rm(Utility::Directory::join(CacheDirectory, file));
+    ShaderProgramCache cache{CacheDirectory};
+
+    MyShader first;
+    CORRADE_VERIFY(!first.create(cache));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 1);
+
+    if(!cache.isSupported()) {
+        /* Nothing gets saved, so it's a miss again */
+        MyShader second;
+        CORRADE_VERIFY(!second.create(cache));
+        CORRADE_COMPARE(cache.hits(), 0);
+        CORRADE_COMPARE(cache.misses(), 2);
+        CORRADE_SKIP("Program binaries are not supported.");
+    }
+
+    /* Loaded from the cache the second time */
+    MyShader second;
+    CORRADE_VERIFY(second.create(cache));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 1);
+    CORRADE_VERIFY(second.uniformLocation("color") >= 0);
+
+    /* Different source is a miss */
+    MyShader third;
+    CORRADE_VERIFY(!third.create(cache, "0.5"));
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 2);
+
+    /* A new cache instance in the same directory sees the binaries */
+    ShaderProgramCache another{CacheDirectory};
+    MyShader fourth;
+    CORRADE_VERIFY(fourth.create(another, "0.5"));
+    CORRADE_COMPARE(another.hits(), 1);
+    CORRADE_COMPARE(another.misses(), 0);
+}
+
+void ShaderProgramCacheGLTest::loadInvalid() {
+    ShaderProgramCache cache{CacheDirectory};
+    if(!cache.isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    Shader vert{ShaderVersion, Shader::Type::Vertex};
+    vert.addSource("void main() { gl_Position = vec4(0.0); }");
+    const std::string key = cache.key({vert}, "loadInvalid");
+
+    CORRADE_VERIFY(Utility::Directory::mkpath(CacheDirectory));
+    CORRADE_VERIFY(Utility::Directory::writeString(Utility::Directory::join(CacheDirectory, key + ".bin"), std::string{"MSPB\xff\xff\xff\xffgarbage", 15}));
+
+    /* The binary format is unknown, so it's a miss and the program can be
+       linked from sources afterwards */
+    MyShader shader;
+    CORRADE_VERIFY(!cache.load(shader, key));
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderProgramCacheGLTest::loadSaveCurrent() {
+    /* Without a current cache the program is always linked from sources */
+    {
+        MyShader shader;
+        CORRADE_VERIFY(!shader.createCurrent("0.75"));
+        CORRADE_VERIFY(shader.id());
+        MAGNUM_VERIFY_NO_GL_ERROR();
+    }
+
+    /* Start with an empty cache */
+    for(const std::string& file: Utility::Directory::list(CacheDirectory, Utility::Directory::Flag::SkipDirectories))
+        Utility::Directory::rm(Utility::Directory::join(CacheDirectory, file));
+    ShaderProgramCache cache{CacheDirectory};
+
+    MyShader first;
+    CORRADE_VERIFY(!first.createCurrent("0.75"));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 1);
+
+    if(!cache.isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    MyShader second;
+    CORRADE_VERIFY(second.createCurrent("0.75"));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 1);
+}
+
+void ShaderProgramCacheGLTest::resetStatistics() {
+    ShaderProgramCache cache{CacheDirectory};
+
+    MyShader shader;
+    shader.create(cache, "0.25");
+    CORRADE_COMPARE(cache.hits() + cache.misses(), 1);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::ShaderProgramCacheGLTest)
@@ -0,0 +1,244 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/StreamingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct StreamingBufferGLTest: OpenGLTester {
+    explicit StreamingBufferGLTest();
+
+    void construct();
+    void constructNoCreate();
+    void constructMove();
+
+    void allocate();
+    void allocateTooLarge();
+    void nextFrame();
+    void data();
+};
+
+StreamingBufferGLTest::StreamingBufferGLTest() {
+    addTests({&StreamingBufferGLTest::construct,
+              &StreamingBufferGLTest::constructNoCreate,
+              &StreamingBufferGLTest::constructMove,
+
+              &StreamingBufferGLTest::allocate,
+              &StreamingBufferGLTest::allocateTooLarge,
+              &StreamingBufferGLTest::nextFrame,
+              &StreamingBufferGLTest::data});
+}
+
+void StreamingBufferGLTest::construct() {
+    {
+        StreamingBuffer buffer{1024, 3, Buffer::TargetHint::ElementArray};
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_VERIFY(buffer.buffer().id() > 0);
+        CORRADE_COMPARE(buffer.buffer().targetHint(), Buffer::TargetHint::ElementArray);
+        CORRADE_COMPARE(buffer.frameSize(), 1024);
+        CORRADE_COMPARE(buffer.frameCount(), 3);
+        CORRADE_COMPARE(buffer.usedSize(), 0);
+        CORRADE_COMPARE(buffer.availableSize(), 1024);
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>()) {
+            CORRADE_VERIFY(buffer.isPersistent());
+            CORRADE_COMPARE(buffer.buffer().size(), 3*1024);
+        } else
+        #endif
+        {
+            CORRADE_VERIFY(!buffer.isPersistent());
+            CORRADE_COMPARE(buffer.buffer().size(), 1024);
+        }
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::constructNoCreate() {
+    {
+        StreamingBuffer buffer{NoCreate};
+        CORRADE_COMPARE(buffer.buffer().id(), 0);
+        CORRADE_COMPARE(buffer.frameSize(), 0);
+        CORRADE_VERIFY(!buffer.isPersistent());
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::constructMove() {
+    StreamingBuffer a{256};
+    const Int id = a.buffer().id();
+    a.allocate(16);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(id > 0);
+
+    const bool persistent = a.isPersistent();
+
+    StreamingBuffer b{std::move(a)};
+    CORRADE_COMPARE(a.buffer().id(), 0);
+    CORRADE_VERIFY(!a.isPersistent());
+    CORRADE_COMPARE(a.frameSize(), 0);
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(a.usedSize(), 0);
+    CORRADE_COMPARE(b.isPersistent(), persistent);
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_COMPARE(b.frameSize(), 256);
+    CORRADE_COMPARE(b.usedSize(), 16);
+
+    StreamingBuffer c{128, 2};
+    const Int cId = c.buffer().id();
+    const bool cPersistent = c.isPersistent();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(cId > 0);
+    CORRADE_COMPARE(b.buffer().id(), cId);
+    CORRADE_COMPARE(b.isPersistent(), cPersistent);
+    CORRADE_COMPARE(b.frameSize(), 128);
+    CORRADE_COMPARE(b.frameCount(), 2);
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_COMPARE(c.isPersistent(), persistent);
+    CORRADE_COMPARE(c.frameSize(), 256);
+    CORRADE_COMPARE(c.frameCount(), 3);
+    CORRADE_COMPARE(c.usedSize(), 16);
+}
+
+void StreamingBufferGLTest::allocate() {
+    StreamingBuffer buffer{64};
+
+    std::pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(6);
+    CORRADE_COMPARE(a.first, 0);
+    CORRADE_COMPARE(a.second.size(), 6);
+    CORRADE_COMPARE(buffer.usedSize(), 6);
+
+    /* Aligned to four bytes by default */
+    std::pair<GLintptr, Containers::ArrayView<char>> b = buffer.allocate(10);
+    CORRADE_COMPARE(b.first, 8);
+    CORRADE_COMPARE(b.second.size(), 10);
+    CORRADE_COMPARE(b.second.data(), a.second.data() + 8);
+    CORRADE_COMPARE(buffer.usedSize(), 18);
+
+    /* Custom alignment */
+    std::pair<GLintptr, Containers::ArrayView<char>> c = buffer.allocate(4, 16);
+    CORRADE_COMPARE(c.first, 32);
+    CORRADE_COMPARE(buffer.usedSize(), 36);
+    CORRADE_COMPARE(buffer.availableSize(), 28);
+
+    /* Exactly fitting the rest */
+    std::pair<GLintptr, Containers::ArrayView<char>> d = buffer.allocate(28);
+    CORRADE_COMPARE(d.first, 36);
+    CORRADE_COMPARE(buffer.availableSize(), 0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::allocateTooLarge() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    StreamingBuffer buffer{64};
+    buffer.allocate(30);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.allocate(36);
+    CORRADE_COMPARE(out.str(), "GL::StreamingBuffer::allocate(): can't allocate 36 bytes with alignment 4, 34 bytes available in the frame\n");
+    CORRADE_COMPARE(buffer.usedSize(), 30);
+}
+
+void StreamingBufferGLTest::nextFrame() {
+    StreamingBuffer buffer{64, 2};
+
+    CORRADE_COMPARE(buffer.allocate(16).first, 0);
+    buffer.flush();
+    buffer.nextFrame();
+    CORRADE_COMPARE(buffer.usedSize(), 0);
+
+    /* With persistent mapping each frame uses a different region, with
+       orphaning the offsets restart from zero */
+    const GLintptr frameOffset = buffer.isPersistent() ? 64 : 0;
+    CORRADE_COMPARE(buffer.allocate(16).first, frameOffset);
+    buffer.flush();
+    buffer.nextFrame();
+
+    /* Back to the first region, the wait on the fence succeeded */
+    CORRADE_COMPARE(buffer.allocate(16).first, 0);
+    buffer.flush();
+    buffer.nextFrame();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::data() {
+    StreamingBuffer buffer{64, 2};
+
+    /* Fill one frame and move to another so the data end up at a non-zero
+       offset with persistent mapping */
+    buffer.allocate(16);
+    buffer.flush();
+    buffer.nextFrame();
+
+    constexpr Int data[] = {2, 7, 5, 13, 25};
+    constexpr Int data2[] = {125, 3, 15};
+    std::pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(sizeof(data));
+    std::copy_n(reinterpret_cast<const char*>(data), sizeof(data), a.second.begin());
+    buffer.flush();
+    std::pair<GLintptr, Containers::ArrayView<char>> b = buffer.allocate(sizeof(data2));
+    std::copy_n(reinterpret_cast<const char*>(data2), sizeof(data2), b.second.begin());
+    buffer.flush();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> contents = buffer.buffer().subData(a.first, sizeof(data));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(contents),
+        Containers::arrayView(data),
+        TestSuite::Compare::Container);
+
+    Containers::Array<char> contents2 = buffer.buffer().subData(b.first, sizeof(data2));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(contents2),
+        Containers::arrayView(data2),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::StreamingBufferGLTest)
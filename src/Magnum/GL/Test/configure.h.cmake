@@ -24,3 +24,4 @@
 */
 
 #define SHADERGLTEST_FILES_DIR "${SHADERGLTEST_FILES_DIR}"
+#define SHADERPROGRAMCACHEGLTEST_OUTPUT_DIR "${SHADERPROGRAMCACHEGLTEST_OUTPUT_DIR}"
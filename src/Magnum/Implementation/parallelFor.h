@@ -0,0 +1,77 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/Magnum.h"
+
+#if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+/* Calls function(i) for all i in [0, count), distributing the calls over
+   threadCount threads (or std::thread::hardware_concurrency() if zero). The
+   calling thread does its share of the work as well. Without
+   multithreading support everything is executed serially on the calling
+   thread. */
+template<class Function> void parallelFor(const std::size_t count, UnsignedInt threadCount, const Function& function) {
+    #if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    if(std::size_t(threadCount) > count) threadCount = UnsignedInt(count);
+
+    if(threadCount > 1) {
+        /* Work items are picked dynamically, as they can differ in size a
+           lot */
+        std::atomic<std::size_t> next{0};
+        auto worker = [&next, count, &function]() {
+            for(std::size_t i; (i = next.fetch_add(1)) < count; )
+                function(i);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for(UnsignedInt i = 1; i < threadCount; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for(std::thread& thread: threads) thread.join();
+        return;
+    }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    for(std::size_t i = 0; i != count; ++i) function(i);
+}
+
+}}
+
+#endif
@@ -0,0 +1,261 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PackingBatch.h"
+
+#include <cstring>
+#include <type_traits>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+/* The vectorized variants are picked at compile time based on the
+   instruction sets the compiler is allowed to use */
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Count of values converted through the stack buffer at once if the views are
+   not contiguous */
+enum: std::size_t { ChunkSize = 256 };
+
+template<class T, class U, void(*convert)(const T*, U*, std::size_t)> void convertStrided(const Corrade::Containers::StridedArrayView<const T>& src, const Corrade::Containers::StridedArrayView<U>& dst) {
+    const std::size_t size = src.size();
+    if(!size) return;
+
+    /* Contiguous views can be converted directly */
+    if(std::size_t(src.stride()) == sizeof(T) && std::size_t(dst.stride()) == sizeof(U)) {
+        convert(&src[0], &dst[0], size);
+        return;
+    }
+
+    /* Otherwise gather the input into a contiguous buffer, convert and
+       scatter the output */
+    T in[ChunkSize];
+    U out[ChunkSize];
+    for(std::size_t i = 0; i < size; i += ChunkSize) {
+        const std::size_t count = Math::min(std::size_t(ChunkSize), size - i);
+        for(std::size_t j = 0; j != count; ++j) in[j] = src[i + j];
+        convert(in, out, count);
+        for(std::size_t j = 0; j != count; ++j) dst[i + j] = out[j];
+    }
+}
+
+#ifdef __SSE4_1__
+/* Loads four values and extends them to 32-bit integers */
+template<class T> __m128i loadExtend(const T* src);
+template<> inline __m128i loadExtend(const UnsignedByte* const src) {
+    Int packed;
+    std::memcpy(&packed, src, 4);
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+}
+template<> inline __m128i loadExtend(const Byte* const src) {
+    Int packed;
+    std::memcpy(&packed, src, 4);
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+}
+template<> inline __m128i loadExtend(const UnsignedShort* const src) {
+    return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+template<> inline __m128i loadExtend(const Short* const src) {
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+
+/* Narrows four 32-bit integers and stores them. The values are in range, so
+   the saturation doesn't matter. */
+template<class T> void narrowStore(__m128i value, T* dst);
+template<> inline void narrowStore(const __m128i value, UnsignedByte* const dst) {
+    const __m128i shorts = _mm_packs_epi32(value, value);
+    const Int packed = _mm_cvtsi128_si32(_mm_packus_epi16(shorts, shorts));
+    std::memcpy(dst, &packed, 4);
+}
+template<> inline void narrowStore(const __m128i value, Byte* const dst) {
+    const __m128i shorts = _mm_packs_epi32(value, value);
+    const Int packed = _mm_cvtsi128_si32(_mm_packs_epi16(shorts, shorts));
+    std::memcpy(dst, &packed, 4);
+}
+template<> inline void narrowStore(const __m128i value, UnsignedShort* const dst) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(value, value));
+}
+template<> inline void narrowStore(const __m128i value, Short* const dst) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(value, value));
+}
+#endif
+
+template<class T> void unpackContiguous(const T* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+
+    /* Dividing instead of multiplying with a reciprocal to have the same
+       results as unpack() */
+    #ifdef __SSE4_1__
+    const __m128 max = _mm_set1_ps(Float(Implementation::bitMax<T>()));
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for(; i + 4 <= count; i += 4) {
+        __m128 value = _mm_div_ps(_mm_cvtepi32_ps(loadExtend(src + i)), max);
+        if(std::is_signed<T>::value) value = _mm_max_ps(value, minusOne);
+        _mm_storeu_ps(dst + i, value);
+    }
+    #endif
+
+    for(; i != count; ++i) dst[i] = unpack<Float>(src[i]);
+}
+
+template<class T> void packContiguous(const Float* const src, T* const dst, const std::size_t count) {
+    std::size_t i = 0;
+
+    /* Truncating conversion, same as in pack() */
+    #ifdef __SSE4_1__
+    const __m128 max = _mm_set1_ps(Float(Implementation::bitMax<T>()));
+    for(; i + 4 <= count; i += 4)
+        narrowStore(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), max)), dst + i);
+    #endif
+
+    for(; i != count; ++i) dst[i] = pack<T>(src[i]);
+}
+
+void unpackHalfContiguous(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+
+    #ifdef __F16C__
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    #elif defined(__SSE2__)
+    /* Vectorized version of the scalar unpackHalf(), half_to_float_SSE2()
+       from https://gist.github.com/rygorous/2144712 */
+    const __m128i maskNoSign = _mm_set1_epi32(0x7fff);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i wasInfNan = _mm_set1_epi32(0x7bff);
+    const __m128 expInfNan = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+    const __m128i zero = _mm_setzero_si128();
+    for(; i + 4 <= count; i += 4) {
+        const __m128i h = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)), zero);
+        const __m128i expMantissa = _mm_and_si128(maskNoSign, h);
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMantissa, 13)), magic);
+        const __m128 infNan = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(expMantissa, wasInfNan)), expInfNan);
+        const __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_xor_si128(h, expMantissa), 16));
+        _mm_storeu_ps(dst + i, _mm_or_ps(_mm_or_ps(scaled, infNan), sign));
+    }
+    #endif
+
+    for(; i != count; ++i) dst[i] = unpackHalf(src[i]);
+}
+
+void packHalfContiguous(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    std::size_t i = 0;
+
+    #ifdef __F16C__
+    for(; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(__SSE2__)
+    /* Vectorized version of the scalar packHalf(), float_to_half_SSE2()
+       from https://gist.github.com/rygorous/2156668 */
+    const __m128i signMask = _mm_set1_epi32(0x80000000u);
+    const __m128i floatInfinity = _mm_set1_epi32(255 << 23);
+    const __m128i halfInfinity = _mm_set1_epi32(31 << 23);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(15 << 23));
+    const __m128i roundMask = _mm_set1_epi32(~0xfff);
+    const __m128i nanBits = _mm_set1_epi32(0x7e00);
+    const __m128i infBits = _mm_set1_epi32(0x7c00);
+    for(; i + 4 <= count; i += 4) {
+        const __m128i f = _mm_castps_si128(_mm_loadu_ps(src + i));
+        const __m128i sign = _mm_and_si128(f, signMask);
+        const __m128i absolute = _mm_xor_si128(f, sign);
+
+        /* All compares are safe as signed, the operands are positive */
+        const __m128i isInfNan = _mm_cmpgt_epi32(absolute, _mm_sub_epi32(floatInfinity, _mm_set1_epi32(1)));
+        const __m128i isNan = _mm_cmpgt_epi32(absolute, floatInfinity);
+        const __m128i infNan = _mm_or_si128(
+            _mm_and_si128(isNan, nanBits),
+            _mm_andnot_si128(isNan, infBits));
+
+        __m128i finite = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_mm_and_si128(absolute, roundMask)), magic));
+        finite = _mm_sub_epi32(finite, roundMask);
+        const __m128i overflow = _mm_cmpgt_epi32(finite, halfInfinity);
+        finite = _mm_or_si128(
+            _mm_and_si128(overflow, halfInfinity),
+            _mm_andnot_si128(overflow, finite));
+        finite = _mm_srli_epi32(finite, 13);
+
+        const __m128i h = _mm_or_si128(
+            _mm_or_si128(
+                _mm_and_si128(isInfNan, infNan),
+                _mm_andnot_si128(isInfNan, finite)),
+            _mm_srli_epi32(sign, 16));
+
+        /* Sign-extend the 16-bit values so the signed saturation keeps them
+           intact */
+        const __m128i extended = _mm_srai_epi32(_mm_slli_epi32(h, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(extended, extended));
+    }
+    #endif
+
+    for(; i != count; ++i) dst[i] = packHalf(src[i]);
+}
+
+}
+
+#define _c(type)                                                            \
+    void unpackInto(const Corrade::Containers::StridedArrayView<const type>& src, const Corrade::Containers::StridedArrayView<Float>& dst) { \
+        CORRADE_ASSERT(src.size() == dst.size(),                            \
+            "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), ); \
+        convertStrided<type, Float, unpackContiguous<type>>(src, dst);      \
+    }                                                                       \
+    void packInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<type>& dst) { \
+        CORRADE_ASSERT(src.size() == dst.size(),                            \
+            "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), ); \
+        convertStrided<Float, type, packContiguous<type>>(src, dst);        \
+    }
+_c(UnsignedByte)
+_c(Byte)
+_c(UnsignedShort)
+_c(Short)
+#undef _c
+
+void unpackHalfInto(const Corrade::Containers::StridedArrayView<const UnsignedShort>& src, const Corrade::Containers::StridedArrayView<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertStrided<UnsignedShort, Float, unpackHalfContiguous>(src, dst);
+}
+
+void packHalfInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<UnsignedShort>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertStrided<Float, UnsignedShort, packHalfContiguous>(src, dst);
+}
+
+}}
@@ -0,0 +1,118 @@
+#ifndef Magnum_Math_PackingBatch_h
+#define Magnum_Math_PackingBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::packHalfInto()
+ */
+
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Unpack integral values into a floating-point representation
+@param src      Source integral values
+@param dst      Destination floating-point values
+
+Batch variant of @ref unpack(), giving the same results as calling it on each
+value. Expects that @p src and @p dst have the same size. If both views are
+contiguous, the conversion is vectorized using SSE4.1, if enabled at compile
+time; strided views are converted in chunks through a temporary contiguous
+buffer so the vectorized path is used for them as well. To convert
+multi-component types such as @ref Vector3ub, create a view on all the
+components if the data are tightly packed, or a view for each component
+otherwise.
+@see @ref packInto(), @ref unpackHalfInto()
+*/
+MAGNUM_EXPORT void unpackInto(const Corrade::Containers::StridedArrayView<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void unpackInto(const Corrade::Containers::StridedArrayView<const Byte>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void unpackInto(const Corrade::Containers::StridedArrayView<const UnsignedShort>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void unpackInto(const Corrade::Containers::StridedArrayView<const Short>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/**
+@brief Pack floating-point values into an integer representation
+@param src      Source floating-point values
+@param dst      Destination integral values
+
+Batch variant of @ref pack(), giving the same results as calling it on each
+value in the range representable by given type. Expects that @p src and
+@p dst have the same size. Vectorized using SSE4.1 if enabled at compile time,
+see @ref unpackInto() for more information.
+@see @ref packHalfInto()
+*/
+MAGNUM_EXPORT void packInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<UnsignedByte>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void packInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Byte>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void packInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<UnsignedShort>& dst);
+
+/** @overload */
+MAGNUM_EXPORT void packInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Short>& dst);
+
+/**
+@brief Unpack 16-bit half-float values into 32-bit float representation
+@param src      Source half-float values
+@param dst      Destination float values
+
+Batch variant of @ref unpackHalf(). Expects that @p src and @p dst have the
+same size. Vectorized using F16C or SSE2 if enabled at compile time, see
+@ref unpackInto() for more information. The results are the same as with
+@ref unpackHalf() except for the exact NaN bit patterns.
+@see @ref packHalfInto()
+*/
+MAGNUM_EXPORT void unpackHalfInto(const Corrade::Containers::StridedArrayView<const UnsignedShort>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/**
+@brief Pack 32-bit float values into 16-bit half-float representation
+@param src      Source float values
+@param dst      Destination half-float values
+
+Batch variant of @ref packHalf(). Expects that @p src and @p dst have the same
+size. Vectorized using F16C or SSE2 if enabled at compile time, see
+@ref unpackInto() for more information. The SSE2 variant gives the same
+results as @ref packHalf(), the F16C variant rounds to nearest even, which
+means the result may differ in the least significant bit for values exactly
+halfway between two representable half-floats. NaN bit patterns are not
+preserved.
+@see @ref unpackHalfInto()
+*/
+MAGNUM_EXPORT void packHalfInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<UnsignedShort>& dst);
+
+}}
+
+#endif
@@ -0,0 +1,414 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/TypeTraits.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchTest: Corrade::TestSuite::Tester {
+    explicit PackingBatchTest();
+
+    template<class T> void unpack();
+    template<class T> void unpackStrided();
+    template<class T> void pack();
+    template<class T> void packStrided();
+    void unpackHalf();
+    void unpackHalfStrided();
+    void packHalf();
+    void packHalfStrided();
+    void packHalfSpecial();
+
+    void unpackWrongSize();
+    void packWrongSize();
+    void unpackHalfWrongSize();
+    void packHalfWrongSize();
+
+    void benchmarkUnpackScalar();
+    void benchmarkUnpackBatch();
+    void benchmarkPackScalar();
+    void benchmarkPackBatch();
+    void benchmarkUnpackHalfScalar();
+    void benchmarkUnpackHalfBatch();
+    void benchmarkPackHalfScalar();
+    void benchmarkPackHalfBatch();
+};
+
+using Corrade::Containers::StridedArrayView;
+
+/* Odd size to test also the non-vectorized remainder */
+enum: std::size_t {
+    Size = 37,
+    BenchmarkSize = 1000000
+};
+
+PackingBatchTest::PackingBatchTest() {
+    addTests({&PackingBatchTest::unpack<UnsignedByte>,
+              &PackingBatchTest::unpack<Byte>,
+              &PackingBatchTest::unpack<UnsignedShort>,
+              &PackingBatchTest::unpack<Short>,
+              &PackingBatchTest::unpackStrided<UnsignedByte>,
+              &PackingBatchTest::unpackStrided<Byte>,
+              &PackingBatchTest::unpackStrided<UnsignedShort>,
+              &PackingBatchTest::unpackStrided<Short>,
+              &PackingBatchTest::pack<UnsignedByte>,
+              &PackingBatchTest::pack<Byte>,
+              &PackingBatchTest::pack<UnsignedShort>,
+              &PackingBatchTest::pack<Short>,
+              &PackingBatchTest::packStrided<UnsignedByte>,
+              &PackingBatchTest::packStrided<Byte>,
+              &PackingBatchTest::packStrided<UnsignedShort>,
+              &PackingBatchTest::packStrided<Short>,
+              &PackingBatchTest::unpackHalf,
+              &PackingBatchTest::unpackHalfStrided,
+              &PackingBatchTest::packHalf,
+              &PackingBatchTest::packHalfStrided,
+              &PackingBatchTest::packHalfSpecial,
+
+              &PackingBatchTest::unpackWrongSize,
+              &PackingBatchTest::packWrongSize,
+              &PackingBatchTest::unpackHalfWrongSize,
+              &PackingBatchTest::packHalfWrongSize});
+
+    addBenchmarks({&PackingBatchTest::benchmarkUnpackScalar,
+                   &PackingBatchTest::benchmarkUnpackBatch,
+                   &PackingBatchTest::benchmarkPackScalar,
+                   &PackingBatchTest::benchmarkPackBatch,
+                   &PackingBatchTest::benchmarkUnpackHalfScalar,
+                   &PackingBatchTest::benchmarkUnpackHalfBatch,
+                   &PackingBatchTest::benchmarkPackHalfScalar,
+                   &PackingBatchTest::benchmarkPackHalfBatch}, 10);
+}
+
+template<class T> std::vector<T> integralData(std::size_t size) {
+    std::vector<T> data(size);
+    for(std::size_t i = 0; i != size; ++i)
+        data[i] = T(i*7919);
+    /* Make sure the extremes are there */
+    data[1] = Implementation::bitMax<T>();
+    data[2] = std::is_signed<T>::value ? T(-Implementation::bitMax<T>() - 1) : T(0);
+    return data;
+}
+
+template<class T> std::vector<Float> normalizedData(std::size_t size) {
+    std::vector<Float> data(size);
+    const Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    for(std::size_t i = 0; i != size; ++i)
+        data[i] = min + (1.0f - min)*Float((i*7919) % 1000)/999.0f;
+    data[1] = 1.0f;
+    data[2] = min;
+    return data;
+}
+
+template<class T> void PackingBatchTest::unpack() {
+    setTestCaseName(std::string{"unpack<"} + TypeTraits<T>::name() + ">");
+
+    const std::vector<T> src = integralData<T>(Size);
+    std::vector<Float> dst(Size);
+    unpackInto(StridedArrayView<const T>{src.data(), Size, sizeof(T)},
+        StridedArrayView<Float>{dst.data(), Size, sizeof(Float)});
+
+    for(std::size_t i = 0; i != Size; ++i)
+        CORRADE_COMPARE(dst[i], Math::unpack<Float>(src[i]));
+}
+
+template<class T> void PackingBatchTest::unpackStrided() {
+    setTestCaseName(std::string{"unpackStrided<"} + TypeTraits<T>::name() + ">");
+
+    /* Every third input value, every second output value */
+    const std::vector<T> src = integralData<T>(Size*3);
+    std::vector<Float> dst(Size*2);
+    unpackInto(StridedArrayView<const T>{src.data(), Size, 3*sizeof(T)},
+        StridedArrayView<Float>{dst.data(), Size, 2*sizeof(Float)});
+
+    for(std::size_t i = 0; i != Size; ++i) {
+        CORRADE_COMPARE(dst[i*2], Math::unpack<Float>(src[i*3]));
+        CORRADE_COMPARE(dst[i*2 + 1], 0.0f);
+    }
+}
+
+template<class T> void PackingBatchTest::pack() {
+    setTestCaseName(std::string{"pack<"} + TypeTraits<T>::name() + ">");
+
+    const std::vector<Float> src = normalizedData<T>(Size);
+    std::vector<T> dst(Size);
+    packInto(StridedArrayView<const Float>{src.data(), Size, sizeof(Float)},
+        StridedArrayView<T>{dst.data(), Size, sizeof(T)});
+
+    for(std::size_t i = 0; i != Size; ++i)
+        CORRADE_COMPARE(dst[i], Math::pack<T>(src[i]));
+}
+
+template<class T> void PackingBatchTest::packStrided() {
+    setTestCaseName(std::string{"packStrided<"} + TypeTraits<T>::name() + ">");
+
+    /* Every second input value, every third output value */
+    const std::vector<Float> src = normalizedData<T>(Size*2);
+    std::vector<T> dst(Size*3);
+    packInto(StridedArrayView<const Float>{src.data(), Size, 2*sizeof(Float)},
+        StridedArrayView<T>{dst.data(), Size, 3*sizeof(T)});
+
+    for(std::size_t i = 0; i != Size; ++i) {
+        CORRADE_COMPARE(dst[i*3], Math::pack<T>(src[i*2]));
+        CORRADE_COMPARE(dst[i*3 + 1], T(0));
+        CORRADE_COMPARE(dst[i*3 + 2], T(0));
+    }
+}
+
+void PackingBatchTest::unpackHalf() {
+    /* All non-NaN values, including denormals and infinities */
+    std::vector<UnsignedShort> src;
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        if((i & 0x7c00) != 0x7c00 || !(i & 0x03ff)) src.push_back(i);
+    std::vector<Float> dst(src.size());
+    unpackHalfInto(StridedArrayView<const UnsignedShort>{src.data(), src.size(), sizeof(UnsignedShort)},
+        StridedArrayView<Float>{dst.data(), dst.size(), sizeof(Float)});
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        CORRADE_COMPARE(dst[i], Math::unpackHalf(src[i]));
+}
+
+void PackingBatchTest::unpackHalfStrided() {
+    const UnsignedShort src[]{0x3c00, 0, 0xc000, 0, 0x0001, 0, 0x7c00, 0, 0x3555};
+    Float dst[10]{};
+    unpackHalfInto(StridedArrayView<const UnsignedShort>{src, 5, 2*sizeof(UnsignedShort)},
+        StridedArrayView<Float>{dst, 5, 2*sizeof(Float)});
+
+    CORRADE_COMPARE(dst[0], 1.0f);
+    CORRADE_COMPARE(dst[1], 0.0f);
+    CORRADE_COMPARE(dst[2], -2.0f);
+    CORRADE_COMPARE(dst[3], 0.0f);
+    CORRADE_COMPARE(dst[4], Math::unpackHalf(0x0001));
+    CORRADE_COMPARE(dst[5], 0.0f);
+    CORRADE_COMPARE(dst[6], Constants<Float>::inf());
+    CORRADE_COMPARE(dst[7], 0.0f);
+    CORRADE_COMPARE(dst[8], Math::unpackHalf(0x3555));
+    CORRADE_COMPARE(dst[9], 0.0f);
+}
+
+void PackingBatchTest::packHalf() {
+    /* All exactly representable non-NaN values have to round-trip, with any
+       rounding mode */
+    std::vector<Float> src;
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        if((i & 0x7c00) != 0x7c00 || !(i & 0x03ff))
+            src.push_back(Math::unpackHalf(i));
+    std::vector<UnsignedShort> dst(src.size());
+    packHalfInto(StridedArrayView<const Float>{src.data(), src.size(), sizeof(Float)},
+        StridedArrayView<UnsignedShort>{dst.data(), dst.size(), sizeof(UnsignedShort)});
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        CORRADE_COMPARE(dst[i], Math::packHalf(src[i]));
+}
+
+void PackingBatchTest::packHalfStrided() {
+    const Float src[]{1.0f, 7.0f, -2.0f, 7.0f, 65504.0f, 7.0f, 0.333252f, 7.0f, 1.0e10f};
+    UnsignedShort dst[10]{};
+    packHalfInto(StridedArrayView<const Float>{src, 5, 2*sizeof(Float)},
+        StridedArrayView<UnsignedShort>{dst, 5, 2*sizeof(UnsignedShort)});
+
+    CORRADE_COMPARE(dst[0], 0x3c00);
+    CORRADE_COMPARE(dst[1], 0);
+    CORRADE_COMPARE(dst[2], 0xc000);
+    CORRADE_COMPARE(dst[3], 0);
+    CORRADE_COMPARE(dst[4], 0x7bff);
+    CORRADE_COMPARE(dst[5], 0);
+    CORRADE_COMPARE(dst[6], 0x3555);
+    CORRADE_COMPARE(dst[7], 0);
+    /* Overflows to infinity */
+    CORRADE_COMPARE(dst[8], 0x7c00);
+    CORRADE_COMPARE(dst[9], 0);
+}
+
+void PackingBatchTest::packHalfSpecial() {
+    /* Eight values to go through the vectorized path as well */
+    const Float src[]{
+        Constants<Float>::nan(), -Constants<Float>::nan(),
+        Constants<Float>::inf(), -Constants<Float>::inf(),
+        0.0f, -0.0f, 1.0e-10f, -1.0e10f};
+    UnsignedShort dst[8];
+    packHalfInto(StridedArrayView<const Float>{src, 8, sizeof(Float)},
+        StridedArrayView<UnsignedShort>{dst, 8, sizeof(UnsignedShort)});
+
+    /* NaN bit patterns aren't preserved, check just that it's a NaN */
+    CORRADE_COMPARE(dst[0] & 0x7c00, 0x7c00);
+    CORRADE_VERIFY(dst[0] & 0x03ff);
+    CORRADE_COMPARE(dst[1] & 0x7c00, 0x7c00);
+    CORRADE_VERIFY(dst[1] & 0x03ff);
+    CORRADE_COMPARE(dst[2], 0x7c00);
+    CORRADE_COMPARE(dst[3], 0xfc00);
+    CORRADE_COMPARE(dst[4], 0x0000);
+    CORRADE_COMPARE(dst[5], 0x8000);
+    CORRADE_COMPARE(dst[6], 0x0000);
+    CORRADE_COMPARE(dst[7], 0xfc00);
+}
+
+void PackingBatchTest::unpackWrongSize() {
+    const UnsignedByte src[3]{};
+    Float dst[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    unpackInto(StridedArrayView<const UnsignedByte>{src, 3, 1},
+        StridedArrayView<Float>{dst, 4, 4});
+    CORRADE_COMPARE(out.str(), "Math::unpackInto(): wrong destination size, got 4 but expected 3\n");
+}
+
+void PackingBatchTest::packWrongSize() {
+    const Float src[3]{};
+    Short dst[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    packInto(StridedArrayView<const Float>{src, 3, 4},
+        StridedArrayView<Short>{dst, 2, 2});
+    CORRADE_COMPARE(out.str(), "Math::packInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+void PackingBatchTest::unpackHalfWrongSize() {
+    const UnsignedShort src[3]{};
+    Float dst[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    unpackHalfInto(StridedArrayView<const UnsignedShort>{src, 3, 2},
+        StridedArrayView<Float>{dst, 4, 4});
+    CORRADE_COMPARE(out.str(), "Math::unpackHalfInto(): wrong destination size, got 4 but expected 3\n");
+}
+
+void PackingBatchTest::packHalfWrongSize() {
+    const Float src[3]{};
+    UnsignedShort dst[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    packHalfInto(StridedArrayView<const Float>{src, 3, 4},
+        StridedArrayView<UnsignedShort>{dst, 2, 2});
+    CORRADE_COMPARE(out.str(), "Math::packHalfInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+void PackingBatchTest::benchmarkUnpackScalar() {
+    const std::vector<UnsignedShort> src = integralData<UnsignedShort>(BenchmarkSize);
+    std::vector<Float> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != BenchmarkSize; ++i)
+            dst[i] = Math::unpack<Float>(src[i]);
+
+    CORRADE_COMPARE(dst[1], 1.0f);
+}
+
+void PackingBatchTest::benchmarkUnpackBatch() {
+    const std::vector<UnsignedShort> src = integralData<UnsignedShort>(BenchmarkSize);
+    std::vector<Float> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        unpackInto(StridedArrayView<const UnsignedShort>{src.data(), BenchmarkSize, sizeof(UnsignedShort)},
+            StridedArrayView<Float>{dst.data(), BenchmarkSize, sizeof(Float)});
+
+    CORRADE_COMPARE(dst[1], 1.0f);
+}
+
+void PackingBatchTest::benchmarkPackScalar() {
+    const std::vector<Float> src = normalizedData<UnsignedByte>(BenchmarkSize);
+    std::vector<UnsignedByte> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != BenchmarkSize; ++i)
+            dst[i] = Math::pack<UnsignedByte>(src[i]);
+
+    CORRADE_COMPARE(dst[1], 255);
+}
+
+void PackingBatchTest::benchmarkPackBatch() {
+    const std::vector<Float> src = normalizedData<UnsignedByte>(BenchmarkSize);
+    std::vector<UnsignedByte> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        packInto(StridedArrayView<const Float>{src.data(), BenchmarkSize, sizeof(Float)},
+            StridedArrayView<UnsignedByte>{dst.data(), BenchmarkSize, sizeof(UnsignedByte)});
+
+    CORRADE_COMPARE(dst[1], 255);
+}
+
+void PackingBatchTest::benchmarkUnpackHalfScalar() {
+    std::vector<UnsignedShort> src(BenchmarkSize);
+    for(std::size_t i = 0; i != BenchmarkSize; ++i) src[i] = UnsignedShort(i*65);
+    std::vector<Float> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != BenchmarkSize; ++i)
+            dst[i] = Math::unpackHalf(src[i]);
+
+    CORRADE_COMPARE(dst[1], Math::unpackHalf(65));
+}
+
+void PackingBatchTest::benchmarkUnpackHalfBatch() {
+    std::vector<UnsignedShort> src(BenchmarkSize);
+    for(std::size_t i = 0; i != BenchmarkSize; ++i) src[i] = UnsignedShort(i*65);
+    std::vector<Float> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        unpackHalfInto(StridedArrayView<const UnsignedShort>{src.data(), BenchmarkSize, sizeof(UnsignedShort)},
+            StridedArrayView<Float>{dst.data(), BenchmarkSize, sizeof(Float)});
+
+    CORRADE_COMPARE(dst[1], Math::unpackHalf(65));
+}
+
+void PackingBatchTest::benchmarkPackHalfScalar() {
+    std::vector<Float> src(BenchmarkSize);
+    for(std::size_t i = 0; i != BenchmarkSize; ++i) src[i] = Float(i % 1000)*65;
+    std::vector<UnsignedShort> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != BenchmarkSize; ++i)
+            dst[i] = Math::packHalf(src[i]);
+
+    CORRADE_COMPARE(dst[1], Math::packHalf(65.0f));
+}
+
+void PackingBatchTest::benchmarkPackHalfBatch() {
+    std::vector<Float> src(BenchmarkSize);
+    for(std::size_t i = 0; i != BenchmarkSize; ++i) src[i] = Float(i % 1000)*65;
+    std::vector<UnsignedShort> dst(BenchmarkSize);
+
+    CORRADE_BENCHMARK(1)
+        packHalfInto(StridedArrayView<const Float>{src.data(), BenchmarkSize, sizeof(Float)},
+            StridedArrayView<UnsignedShort>{dst.data(), BenchmarkSize, sizeof(UnsignedShort)});
+
+    CORRADE_COMPARE(dst[1], Math::packHalf(65.0f));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchTest)
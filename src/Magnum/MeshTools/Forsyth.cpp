@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Forsyth.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Constants from the original paper */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+/* Valences up to this are taken from a precalculated table */
+constexpr UnsignedInt ValenceTableSize = 32;
+
+constexpr UnsignedInt NotInCache = ~UnsignedInt{};
+constexpr UnsignedInt NoTriangle = ~UnsignedInt{};
+
+}
+
+void forsyth(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(cacheSize > 3,
+        "MeshTools::forsyth(): expected cache size larger than 3 but got" << cacheSize, );
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::forsyth(): index count is not divisible by 3", );
+
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count.
+       Live triangles of each vertex are always kept at the front of its
+       neighbor range. */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify{indices, vertexCount}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Precalculated scores for each cache position and small valences */
+    std::vector<Float> cachePositionScore(cacheSize);
+    for(std::size_t i = 0; i != cacheSize; ++i)
+        cachePositionScore[i] = i < 3 ? LastTriangleScore :
+            std::pow(1.0f - Float(i - 3)/Float(cacheSize - 3), CacheDecayPower);
+    Float valenceScore[ValenceTableSize];
+    for(UnsignedInt i = 1; i != ValenceTableSize; ++i)
+        valenceScore[i] = ValenceBoostScale*std::pow(Float(i), -ValenceBoostPower);
+
+    /* Per-vertex cache position and score, per-triangle score and emitted
+       flag. All scratch memory is allocated upfront. */
+    std::vector<UnsignedInt> cachePosition(vertexCount, NotInCache);
+    std::vector<Float> vertexScore(vertexCount);
+    std::vector<Float> triangleScore(triangleCount);
+    std::vector<UnsignedByte> emitted(triangleCount);
+    auto calculateVertexScore = [&](const UnsignedInt v) -> Float {
+        const UnsignedInt count = liveTriangleCount[v];
+        if(!count) return -1.0f;
+        const Float score = cachePosition[v] == NotInCache ? 0.0f :
+            cachePositionScore[cachePosition[v]];
+        return score + (count < ValenceTableSize ? valenceScore[count] :
+            ValenceBoostScale*std::pow(Float(count), -ValenceBoostPower));
+    };
+
+    for(UnsignedInt v = 0; v != vertexCount; ++v)
+        vertexScore[v] = calculateVertexScore(v);
+    for(std::size_t t = 0; t != triangleCount; ++t)
+        triangleScore[t] = vertexScore[indices[t*3]] +
+                           vertexScore[indices[t*3 + 1]] +
+                           vertexScore[indices[t*3 + 2]];
+
+    /* Simulated LRU cache and its next state. Emitting a triangle pushes at
+       most three new vertices in, which then fall out at the end. */
+    std::vector<UnsignedInt> cache, nextCache;
+    cache.reserve(cacheSize + 3);
+    nextCache.reserve(cacheSize + 3);
+
+    /* Output index buffer */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+
+    /* Next triangle to emit, cursor for finding an arbitrary live triangle on
+       dead-end */
+    UnsignedInt bestTriangle = NoTriangle;
+    std::size_t cursor = 0;
+    for(std::size_t emittedCount = 0; emittedCount != triangleCount; ++emittedCount) {
+        /* On dead-end take next arbitrary triangle that's not emitted yet */
+        if(bestTriangle == NoTriangle) {
+            while(emitted[cursor]) ++cursor;
+            bestTriangle = cursor;
+        }
+
+        const UnsignedInt t = bestTriangle;
+        const UnsignedInt* const triangle = indices.data() + t*3;
+        emitted[t] = true;
+
+        /* Write all vertices of the triangle to output buffer and remove the
+           triangle from live triangles of each vertex by moving it past the
+           end of the live range */
+        for(std::size_t vi = 0; vi != 3; ++vi) {
+            const UnsignedInt v = triangle[vi];
+            outputIndices.push_back(v);
+
+            UnsignedInt* const begin = neighbors.data() + neighborOffset[v];
+            UnsignedInt* const end = begin + liveTriangleCount[v];
+            UnsignedInt* const found = std::find(begin, end, t);
+            CORRADE_INTERNAL_ASSERT(found != end);
+            std::swap(*found, *(end - 1));
+            --liveTriangleCount[v];
+        }
+
+        /* Put the triangle vertices to the front of the cache, followed by
+           the rest of the previous cache contents */
+        nextCache.clear();
+        for(std::size_t vi = 0; vi != 3; ++vi)
+            if(std::find(nextCache.begin(), nextCache.end(), triangle[vi]) == nextCache.end())
+                nextCache.push_back(triangle[vi]);
+        for(const UnsignedInt v: cache)
+            if(v != triangle[0] && v != triangle[1] && v != triangle[2])
+                nextCache.push_back(v);
+
+        /* Update cache positions and scores of all vertices that were
+           affected, including the ones that just fell out of the cache, and
+           propagate the score difference to their live triangles */
+        for(std::size_t i = 0; i != nextCache.size(); ++i) {
+            const UnsignedInt v = nextCache[i];
+            cachePosition[v] = i < cacheSize ? UnsignedInt(i) : NotInCache;
+
+            const Float score = calculateVertexScore(v);
+            const Float difference = score - vertexScore[v];
+            vertexScore[v] = score;
+
+            const UnsignedInt* const begin = neighbors.data() + neighborOffset[v];
+            for(const UnsignedInt* n = begin, *end = begin + liveTriangleCount[v]; n != end; ++n)
+                triangleScore[*n] += difference;
+        }
+
+        if(nextCache.size() > cacheSize) nextCache.resize(cacheSize);
+        std::swap(cache, nextCache);
+
+        /* Pick the best-scoring live triangle of vertices in the cache */
+        bestTriangle = NoTriangle;
+        Float bestScore = -1.0f;
+        for(const UnsignedInt v: cache) {
+            const UnsignedInt* const begin = neighbors.data() + neighborOffset[v];
+            for(const UnsignedInt* n = begin, *end = begin + liveTriangleCount[v]; n != end; ++n) {
+                if(triangleScore[*n] <= bestScore) continue;
+                bestScore = triangleScore[*n];
+                bestTriangle = *n;
+            }
+        }
+    }
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
@@ -0,0 +1,64 @@
+#ifndef Magnum_MeshTools_Forsyth_h
+#define Magnum_MeshTools_Forsyth_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::forsyth()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for post-transform vertex cache using Forsyth's algorithm
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Size of the simulated LRU vertex cache, expected to
+    be larger than @cpp 3 @ce
+
+Alternative to @ref tipsify(). Greedily emits triangles with the highest
+score, where score of each vertex is given by its position in a simulated LRU
+cache and by count of its not yet emitted triangles, favoring vertices that
+would otherwise be left behind with just a few triangles. Algorithm used:
+*Tom Forsyth --- Linear-Speed Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+Compared to @ref tipsify() the result is usually slightly better for caches of
+the size it was optimized for and degrades more gracefully on caches of
+different sizes, at the cost of being several times slower. Triangle vertex
+order is preserved, only the triangles are reordered. Use
+@ref vertexCacheStatistics() to compare the output of both.
+@see @ref optimizeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT void forsyth(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+}}
+
+#endif
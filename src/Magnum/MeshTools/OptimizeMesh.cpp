@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeMesh.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::vector<UnsignedInt> optimizeVertexFetchRemap(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    constexpr UnsignedInt Unused = ~UnsignedInt{};
+
+    /* New index of each original vertex, original index of each new vertex */
+    std::vector<UnsignedInt> newIndex(vertexCount, Unused);
+    std::vector<UnsignedInt> mapping;
+    mapping.reserve(vertexCount);
+
+    for(UnsignedInt& index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::optimizeVertexFetchRemap(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(newIndex[index] == Unused) {
+            newIndex[index] = mapping.size();
+            mapping.push_back(index);
+        }
+
+        index = newIndex[index];
+    }
+
+    /* Put unreferenced vertices at the end */
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        if(newIndex[i] == Unused) mapping.push_back(i);
+
+    return mapping;
+}
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdraw(): index count is not divisible by 3", );
+
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::optimizeOverdraw(): index" << index << "out of bounds for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Same timestamp-based FIFO cache simulation as in tipsify(). Increasing
+       the time by more than cache size flushes the cache. */
+    UnsignedInt time = cacheSize + 1;
+    Containers::Array<UnsignedInt> timestamp{Containers::ValueInit, positions.size()};
+    auto cacheMisses = [&](const std::size_t triangle) -> UnsignedInt {
+        UnsignedInt misses = 0;
+        for(std::size_t i = triangle*3, end = i + 3; i != end; ++i) {
+            const UnsignedInt v = indices[i];
+            if(time - timestamp[v] <= cacheSize) continue;
+            timestamp[v] = time++;
+            ++misses;
+        }
+        return misses;
+    };
+
+    /* Cache misses of each triangle in the original order, hard cluster
+       boundaries where all three vertices miss the cache */
+    std::vector<UnsignedByte> misses(triangleCount);
+    std::vector<UnsignedInt> hardBoundaries;
+    for(std::size_t t = 0; t != triangleCount; ++t) {
+        misses[t] = cacheMisses(t);
+        if(!t || misses[t] == 3) hardBoundaries.push_back(t);
+    }
+    hardBoundaries.push_back(triangleCount);
+
+    /* Split each hard cluster into smaller ones as soon as their cache miss
+       ratio is not much worse than of the whole hard cluster. Simulating the
+       cache from scratch for each new soft cluster, as there's no guarantee
+       on what will be drawn before. */
+    std::vector<UnsignedInt> clusters;
+    for(std::size_t i = 0; i + 1 < hardBoundaries.size(); ++i) {
+        const std::size_t begin = hardBoundaries[i], end = hardBoundaries[i + 1];
+
+        UnsignedInt hardMisses = 0;
+        for(std::size_t t = begin; t != end; ++t) hardMisses += misses[t];
+        const Float limit = threshold*Float(hardMisses)/Float(end - begin);
+
+        clusters.push_back(begin);
+        time += cacheSize + 1;
+        std::size_t clusterBegin = begin;
+        UnsignedInt clusterMisses = 0;
+        for(std::size_t t = begin; t != end; ++t) {
+            clusterMisses += cacheMisses(t);
+            if(t + 1 != end && Float(clusterMisses) <= limit*Float(t + 1 - clusterBegin)) {
+                clusters.push_back(t + 1);
+                time += cacheSize + 1;
+                clusterBegin = t + 1;
+                clusterMisses = 0;
+            }
+        }
+    }
+    const std::size_t clusterCount = clusters.size();
+    clusters.push_back(triangleCount);
+
+    /* Area-weighted centroid and normal of each cluster and of the whole
+       mesh */
+    std::vector<Vector3> clusterCentroid(clusterCount), clusterNormal(clusterCount);
+    std::vector<Float> clusterArea(clusterCount);
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        for(std::size_t t = clusters[i]; t != clusters[i + 1]; ++t) {
+            const Vector3& a = positions[indices[t*3]];
+            const Vector3& b = positions[indices[t*3 + 1]];
+            const Vector3& c = positions[indices[t*3 + 2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float area = normal.length();
+            clusterCentroid[i] += (a + b + c)*area/3.0f;
+            clusterNormal[i] += normal;
+            clusterArea[i] += area;
+        }
+
+        meshCentroid += clusterCentroid[i];
+        meshArea += clusterArea[i];
+    }
+    if(meshArea != 0.0f) meshCentroid /= meshArea;
+
+    /* Sort the clusters so the ones facing most away from the centroid are
+       drawn first */
+    std::vector<Float> sortKey(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        const Float normalLength = clusterNormal[i].length();
+        if(clusterArea[i] == 0.0f || normalLength == 0.0f) continue;
+        sortKey[i] = Math::dot(clusterCentroid[i]/clusterArea[i] - meshCentroid, clusterNormal[i]/normalLength);
+    }
+    std::vector<UnsignedInt> order(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&sortKey](UnsignedInt a, UnsignedInt b) {
+        return sortKey[a] > sortKey[b];
+    });
+
+    /* Output index buffer */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const UnsignedInt i: order)
+        outputIndices.insert(outputIndices.end(),
+            indices.begin() + clusters[i]*3,
+            indices.begin() + clusters[i + 1]*3);
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+void optimizeMesh(Trade::MeshData3D& meshData, const std::size_t cacheSize) {
+    CORRADE_ASSERT(meshData.isIndexed() && meshData.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::optimizeMesh(): expected an indexed triangle mesh", );
+
+    std::vector<UnsignedInt>& indices = meshData.indices();
+    const UnsignedInt vertexCount = meshData.positions(0).size();
+    tipsify(indices, vertexCount, cacheSize);
+    optimizeOverdraw(indices, meshData.positions(0), cacheSize);
+    const std::vector<UnsignedInt> mapping = optimizeVertexFetchRemap(indices, vertexCount);
+
+    for(UnsignedInt i = 0; i != meshData.positionArrayCount(); ++i)
+        Implementation::reorderVertices(mapping, meshData.positions(i));
+    for(UnsignedInt i = 0; i != meshData.normalArrayCount(); ++i)
+        Implementation::reorderVertices(mapping, meshData.normals(i));
+    for(UnsignedInt i = 0; i != meshData.textureCoords2DArrayCount(); ++i)
+        Implementation::reorderVertices(mapping, meshData.textureCoords2D(i));
+    for(UnsignedInt i = 0; i != meshData.colorArrayCount(); ++i)
+        Implementation::reorderVertices(mapping, meshData.colors(i));
+}
+
+}}
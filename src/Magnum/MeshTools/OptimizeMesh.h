@@ -0,0 +1,131 @@
+#ifndef Magnum_MeshTools_OptimizeMesh_h
+#define Magnum_MeshTools_OptimizeMesh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetchRemap(), @ref Magnum::MeshTools::optimizeVertexFetch(), @ref Magnum::MeshTools::optimizeOverdraw(), @ref Magnum::MeshTools::optimizeMesh()
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize index array for pre-transform vertex fetch
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@return Original index of each vertex in the new order
+
+Renumbers the vertices in order of their first use in @p indices, so vertex
+data are fetched in a linear fashion when drawing the mesh. Vertices not
+referenced by any index are put at the end, in their original order. Vertex
+data can then be reordered by passing the returned array together with each
+attribute array to @ref duplicate(), or alternatively use
+@ref optimizeVertexFetch(std::vector<UnsignedInt>&, std::vector<T>&, std::vector<U>&...)
+which does both at once. Meant to be done after reordering the indices for
+post-transform vertex cache, for example using @ref tipsify().
+@see @ref optimizeMesh()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> optimizeVertexFetchRemap(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+namespace Implementation {
+
+inline void reorderVertices(const std::vector<UnsignedInt>&) {}
+
+template<class T, class ...U> void reorderVertices(const std::vector<UnsignedInt>& mapping, std::vector<T>& first, std::vector<U>&... next) {
+    CORRADE_ASSERT(first.size() == mapping.size(),
+        "MeshTools::optimizeVertexFetch(): expected" << mapping.size() << "items in each attribute array but got" << first.size(), );
+    first = duplicate(mapping, first);
+    reorderVertices(mapping, next...);
+}
+
+}
+
+/**
+@brief Optimize mesh for pre-transform vertex fetch
+@param[in,out] indices  Index array to operate on
+@param[in,out] first    First attribute array
+@param[in,out] next     Other attribute arrays
+
+Calls @ref optimizeVertexFetchRemap() with vertex count taken from size of
+@p first and then reorders all attribute arrays accordingly. All attribute
+arrays are expected to have the same size.
+*/
+template<class T, class ...U> void optimizeVertexFetch(std::vector<UnsignedInt>& indices, std::vector<T>& first, std::vector<U>&... next) {
+    const std::vector<UnsignedInt> mapping = optimizeVertexFetchRemap(indices, first.size());
+    Implementation::reorderVertices(mapping, first, next...);
+}
+
+/**
+@brief Optimize mesh for reduced overdraw
+@param[in,out] indices  Index array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Allowed ratio of the resulting average cache miss ratio
+    compared to the input
+
+Expects that the index array was already optimized for post-transform vertex
+cache using @ref tipsify() or @ref forsyth() with the same @p cacheSize.
+Splits the triangles into clusters at places where the vertex cache gets
+completely flushed and then further splits the clusters into smaller ones
+as long as their average cache miss ratio stays below @p threshold times the
+ratio of the original cluster. The clusters are then sorted so the ones
+facing away from the mesh centroid are drawn first, as these are likely to
+occlude the others. Triangle order inside the clusters is preserved. Algorithm
+used: *Pedro V. Sander, Diego Nehab, and Joshua Barczak --- Fast Triangle
+Reordering for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
+http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref optimizeMesh()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Optimize mesh for rendering
+@param[in,out] meshData     Mesh data to operate on
+@param[in] cacheSize        Post-transform vertex cache size
+
+Chains @ref tipsify(), @ref optimizeOverdraw() and
+@ref optimizeVertexFetchRemap() on the index array, using the first position
+array for overdraw optimization, and then reorders all position, normal,
+texture coordinate and color arrays accordingly. Expects that the mesh is
+indexed and has @ref MeshPrimitive::Triangles. The result can be then
+directly passed to @ref compile():
+
+@snippet MagnumMeshTools.cpp optimizeMesh
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeMesh(Trade::MeshData3D& meshData, std::size_t cacheSize = 24);
+
+}}
+
+#endif
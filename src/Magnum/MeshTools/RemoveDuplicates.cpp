@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RemoveDuplicates.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* FNV-1a-like hash operating on whole 64-bit words with an additional
+   xor-shift after each, so differences in the upper bytes of a word
+   propagate to the lower bits that are used for indexing the table */
+inline std::size_t hashBytes(const char* const data, const std::size_t size) {
+    UnsignedLong hash = 0xcbf29ce484222325ull;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        UnsignedLong word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word)*0x100000001b3ull;
+        hash ^= hash >> 29;
+    }
+    for(; i != size; ++i)
+        hash = (hash ^ UnsignedByte(data[i]))*0x100000001b3ull;
+    return std::size_t(hash ^ (hash >> 32));
+}
+
+}
+
+std::size_t removeDuplicatesExactInto(const Containers::StridedArrayView<char>& data, const std::size_t vertexSize, const Containers::ArrayView<UnsignedInt> indices) {
+    CORRADE_ASSERT(indices.size() == data.size(),
+        "MeshTools::removeDuplicatesExactInto(): output index array has" << indices.size() << "items but expected" << data.size(), {});
+    CORRADE_ASSERT(data.size() < 2 || vertexSize <= std::size_t(data.stride()),
+        "MeshTools::removeDuplicatesExactInto(): vertex size" << vertexSize << "is larger than stride" << data.stride(), {});
+
+    /* Open-addressing table containing index of the unique vertex, sized to
+       a power of two at least twice as large as if each vertex was unique */
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    std::size_t capacity = 1;
+    while(capacity < data.size()*2) capacity <<= 1;
+    const std::size_t mask = capacity - 1;
+    Containers::Array<UnsignedInt> table{Containers::NoInit, capacity};
+    for(UnsignedInt& i: table) i = Empty;
+
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const char* const vertex = &data[i];
+
+        /* Find either the same vertex or an empty slot */
+        std::size_t slot = hashBytes(vertex, vertexSize) & mask;
+        while(table[slot] != Empty && std::memcmp(&data[table[slot]], vertex, vertexSize) != 0)
+            slot = (slot + 1) & mask;
+
+        if(table[slot] != Empty) {
+            indices[i] = table[slot];
+            continue;
+        }
+
+        /* New unique vertex, copy it to new (earlier) position in the array.
+           Unique vertices before this position are never overwritten again,
+           so the table can safely reference them. */
+        if(i != uniqueCount) std::memcpy(&data[uniqueCount], vertex, vertexSize);
+        table[slot] = uniqueCount;
+        indices[i] = uniqueCount++;
+    }
+
+    return uniqueCount;
+}
+
+std::tuple<std::vector<UnsignedInt>, std::size_t> removeDuplicatesExact(const Containers::StridedArrayView<char>& data, const std::size_t vertexSize) {
+    std::vector<UnsignedInt> indices(data.size());
+    const std::size_t uniqueCount = removeDuplicatesExactInto(data, vertexSize, {indices.data(), indices.size()});
+    return std::make_tuple(std::move(indices), uniqueCount);
+}
+
+}}
@@ -26,27 +26,31 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::removeDuplicates()
+ * @brief Function @ref Magnum::MeshTools::removeDuplicates(), @ref Magnum::MeshTools::removeDuplicatesExact(), @ref Magnum::MeshTools::removeDuplicatesExactInto()
  */
 
 #include <limits>
-#include <numeric>
-#include <unordered_map>
+#include <tuple>
 #include <vector>
-#include <Corrade/Utility/MurmurHash2.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    template<std::size_t size> class VectorHash {
-        public:
-            std::size_t operator()(const Math::Vector<size, std::size_t>& data) const {
-                return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
-            }
-    };
+    /* Cheap multiplicative hash of a discretized vector. It's calculated up to
+       3^size times for each unique vertex, so it can't be anything heavy
+       like MurmurHash. The final shift folds the high bits down, as the table
+       is indexed only by the low ones. */
+    template<std::size_t size> inline std::size_t cellHash(const Math::Vector<size, std::size_t>& cell) {
+        std::size_t hash = 0;
+        for(std::size_t i = 0; i != size; ++i)
+            hash = (hash ^ cell[i])*std::size_t(0x9e3779b97f4a7c15ull);
+        return hash ^ (hash >> (sizeof(std::size_t)*4));
+    }
 }
 
 /**
@@ -56,11 +60,19 @@ namespace Implementation {
     melt together
 @return Index array and unique data
 
-Removes duplicate data from the array by collapsing them into buckets of size
-@p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Note that this function is meant to be used for
-floating-point data (or generally with non-zero @p epsilon), for discrete data
-the usual sorting method is much more efficient.
+Removes duplicate data from the array by melting together vectors that are
+less than @p epsilon apart in each component. First occurence of given vector
+is used, other ones are thrown away, no interpolation is done. Note that this
+function is meant to be used for floating-point data (or generally with
+non-zero @p epsilon), for discrete data @ref removeDuplicatesExact() is much
+more efficient.
+
+The data are discretized into a grid of cells of size @p epsilon and the
+unique vectors are put into an open-addressing hash table keyed by the cell.
+Each vector is then compared to the unique vector in its own cell and, if
+there is none, to unique vectors in all @f$ 3^n @f$ neighboring cells, so the
+whole operation is done in a single pass over the data with a single
+allocation for the table.
 
 If you want to remove duplicate data from already indexed array, first remove
 duplicates as if the array wasn't indexed at all and then use @ref duplicate()
@@ -74,8 +86,15 @@ to combine the resulting index arrays to single index array and reorder the
 data accordingly:
 
 @snippet MagnumMeshTools.cpp removeDuplicates2
+
+@see @ref removeDuplicatesExact()
 */
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
+    typedef Math::Vector<Vector::Size, std::size_t> Cell;
+    typedef Math::Vector<Vector::Size, typename Vector::Type> Distance;
+
+    if(data.empty()) return {};
+
     /* Get bounds */
     Vector min = data[0], max = data[0];
     for(const auto& v: data) {
@@ -87,59 +106,134 @@ template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vec
        bounds. */
     epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/~std::size_t{}));
 
-    /* Resulting index array */
+    /* Open-addressing table containing index of the unique vector for each
+       occupied cell. Sized to a power of two at least twice as large as if
+       each vector was unique, so the linear probe sequences stay short. The
+       cells are not stored anywhere, they're recalculated from the unique
+       data when comparing. */
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    std::size_t capacity = 1;
+    while(capacity < data.size()*2) capacity <<= 1;
+    const std::size_t mask = capacity - 1;
+    std::vector<UnsignedInt> table(capacity, Empty);
+
+    /* Returns slot containing unique vector in given cell or an empty slot
+       where it should be inserted */
+    auto find = [&](const Cell& cell) {
+        std::size_t slot = Implementation::cellHash(cell) & mask;
+        while(table[slot] != Empty && Cell((data[table[slot]] - min)/epsilon) != cell)
+            slot = (slot + 1) & mask;
+        return slot;
+    };
+
+    /* Resulting index array, count of unique vectors */
     std::vector<UnsignedInt> resultIndices(data.size());
-    std::iota(resultIndices.begin(), resultIndices.end(), 0);
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::unordered_map<Math::Vector<Vector::Size, std::size_t>, UnsignedInt, Implementation::VectorHash<Vector::Size>> table(data.size());
-
-    /* Index array for each pass, new data array */
-    std::vector<UnsignedInt> indices;
-    indices.reserve(data.size());
-
-    /* First go with original coordinates, then move them by epsilon/2 in each
-       direction. */
-    Vector moved;
-    for(std::size_t moving = 0; moving <= Vector::Size; ++moving) {
-        /* Go through all vectors */
-        for(std::size_t i = 0; i != data.size(); ++i) {
-            /* Try to insert new vertex to the table */
-            const Math::Vector<Vector::Size, std::size_t> v((data[i] + moved - min)/epsilon);
-            const auto result = table.emplace(v, table.size());
-
-            /* Add the (either new or already existing) index to index array */
-            indices.push_back(result.first->second);
-
-            /* If this is new combination, copy the data to new (earlier)
-               possition in the array */
-            if(result.second && i != table.size()-1) data[table.size()-1] = data[i];
-        }
+    UnsignedInt uniqueCount = 0;
 
-        /* Shrink the data array */
-        CORRADE_INTERNAL_ASSERT(data.size() >= table.size());
-        data.resize(table.size());
+    std::size_t neighborCount = 1;
+    for(std::size_t d = 0; d != Vector::Size; ++d) neighborCount *= 3;
 
-        /* Remap the resulting index array */
-        for(auto& i: resultIndices) i = indices[i];
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const Cell cell((data[i] - min)/epsilon);
 
-        /* Finished */
-        if(moving == Vector::Size) continue;
+        /* If there already is a unique vector in the same cell, it's nearer
+           than epsilon, so use it */
+        const std::size_t slot = find(cell);
+        if(table[slot] != Empty) {
+            resultIndices[i] = table[slot];
+            continue;
+        }
 
-        /* Move vertex coordinates by epsilon/2 in next direction */
-        moved = Vector();
-        moved[moving] = epsilon/2;
+        /* Otherwise look for a near enough vector in neighboring cells. Cell
+           coordinates might wrap around on the bounds, but the distance check
+           takes care of such false candidates. */
+        UnsignedInt found = Empty;
+        for(std::size_t n = 0; n != neighborCount && found == Empty; ++n) {
+            /* Skip the center, which was already checked above */
+            if(n == neighborCount/2) continue;
+
+            Cell neighbor = cell;
+            for(std::size_t d = 0, digits = n; d != Vector::Size; ++d, digits /= 3)
+                neighbor[d] += (digits % 3) - 1;
+
+            const UnsignedInt candidate = table[find(neighbor)];
+            if(candidate != Empty && (Math::abs(data[candidate] - data[i]) < Distance(epsilon)).all())
+                found = candidate;
+        }
 
-        /* Clear the structures for next pass */
-        table.clear();
-        indices.clear();
+        if(found != Empty) {
+            resultIndices[i] = found;
+            continue;
+        }
+
+        /* New unique vector, copy the data to new (earlier) position in the
+           array. Unique vectors before this position are never overwritten
+           again, so the table can safely reference them. */
+        if(i != uniqueCount) data[uniqueCount] = data[i];
+        table[slot] = uniqueCount;
+        resultIndices[i] = uniqueCount++;
     }
 
+    /* Shrink the data array */
+    data.resize(uniqueCount);
+
     return resultIndices;
 }
 
+/**
+@brief Remove exact duplicate data from given strided array in-place
+@param[in,out] data     Input data array
+@param[in] vertexSize   Size of each vertex in bytes
+@param[out] indices     Where to put the resulting index array
+@return Count of unique vertices
+
+Treats each item of @p data as an opaque blob of @p vertexSize bytes and
+collapses bitwise equal blobs together. First occurence of given vertex is
+used and the unique vertices are moved to the first items of @p data, in
+order of their first occurence. The @p indices array is expected to have the
+same size as @p data, @p vertexSize is expected to not be larger than stride
+of @p data. Data between @p vertexSize and the stride are not compared nor
+moved, which makes it possible to deduplicate also just a subset of
+interleaved vertex attributes.
+
+Unlike @ref removeDuplicates() this doesn't do any fuzzy comparison and thus
+is meant to be used for discrete data, such as packed colors, integer
+texture coordinates or whole interleaved vertices. Note that for
+floating-point data the bitwise comparison treats @cpp -0.0f @ce and
+@cpp 0.0f @ce as different and NaNs with the same bit pattern as equal. The
+vertices are put into a flat open-addressing hash table, so the operation is
+done in a single pass over the data with a single allocation.
+@see @ref removeDuplicatesExact(std::vector<T>&)
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesExactInto(const Containers::StridedArrayView<char>& data, std::size_t vertexSize, Containers::ArrayView<UnsignedInt> indices);
+
+/**
+@brief Remove exact duplicate data from given strided array in-place
+@param[in,out] data     Input data array
+@param[in] vertexSize   Size of each vertex in bytes
+@return Index array and count of unique vertices
+
+Convenience alternative to @ref removeDuplicatesExactInto() that allocates
+the resulting index array.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::vector<UnsignedInt>, std::size_t> removeDuplicatesExact(const Containers::StridedArrayView<char>& data, std::size_t vertexSize);
+
+/**
+@brief Remove exact duplicate data from given array
+@param[in,out] data Input data array
+@return Index array and unique data
+
+Same contract as @ref removeDuplicates(), but comparing the items bitwise
+using @ref removeDuplicatesExactInto(). The type is expected to not contain
+any padding bytes.
+*/
+template<class T> std::vector<UnsignedInt> removeDuplicatesExact(std::vector<T>& data) {
+    std::vector<UnsignedInt> indices(data.size());
+    const std::size_t uniqueCount = removeDuplicatesExactInto({reinterpret_cast<char*>(data.data()), data.size(), sizeof(T)}, sizeof(T), {indices.data(), indices.size()});
+    data.erase(data.begin() + uniqueCount, data.end());
+    return indices;
+}
+
 }}
 
 #endif
@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeMesh.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeMeshTest: TestSuite::Tester {
+    explicit OptimizeMeshTest();
+
+    void vertexFetchRemap();
+    void vertexFetchRemapOutOfBounds();
+    void vertexFetch();
+    void vertexFetchWrongAttributeSize();
+
+    void overdraw();
+    void overdrawEmpty();
+    void overdrawOutOfBounds();
+
+    void optimizeMesh();
+    void optimizeMeshNotIndexed();
+};
+
+OptimizeMeshTest::OptimizeMeshTest() {
+    addTests({&OptimizeMeshTest::vertexFetchRemap,
+              &OptimizeMeshTest::vertexFetchRemapOutOfBounds,
+              &OptimizeMeshTest::vertexFetch,
+              &OptimizeMeshTest::vertexFetchWrongAttributeSize,
+
+              &OptimizeMeshTest::overdraw,
+              &OptimizeMeshTest::overdrawEmpty,
+              &OptimizeMeshTest::overdrawOutOfBounds,
+
+              &OptimizeMeshTest::optimizeMesh,
+              &OptimizeMeshTest::optimizeMeshNotIndexed});
+}
+
+/* Two quads, both with counterclockwise winding when looking from the -Z
+   direction, so their front faces point towards -Z. The second one is in
+   front of the first when looking from there, so it should be drawn first
+   to occlude the first one. */
+const std::vector<UnsignedInt> QuadIndices{
+    0, 1, 2,
+    2, 1, 3,
+    4, 5, 6,
+    6, 5, 7
+};
+
+const std::vector<Vector3> QuadPositions{
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 1.0f, 1.0f},
+    {1.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+
+    {0.0f, 0.0f, -1.0f},
+    {0.0f, 1.0f, -1.0f},
+    {1.0f, 0.0f, -1.0f},
+    {1.0f, 1.0f, -1.0f}
+};
+
+void OptimizeMeshTest::vertexFetchRemap() {
+    std::vector<UnsignedInt> indices{3, 1, 3, 0, 1, 4};
+    const std::vector<UnsignedInt> mapping = MeshTools::optimizeVertexFetchRemap(indices, 6);
+
+    /* Unreferenced vertices 2 and 5 are put at the end */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2, 1, 3}));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{3, 1, 0, 4, 2, 5}));
+}
+
+void OptimizeMeshTest::vertexFetchRemapOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{3, 1, 6};
+    MeshTools::optimizeVertexFetchRemap(indices, 6);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexFetchRemap(): index 6 out of bounds for 6 vertices\n");
+}
+
+void OptimizeMeshTest::vertexFetch() {
+    std::vector<UnsignedInt> indices{2, 0, 2, 1};
+    std::vector<Vector2> positions{{0.0f, 0.5f}, {1.0f, 0.5f}, {2.0f, 0.5f}};
+    std::vector<UnsignedInt> ids{10, 11, 12};
+    MeshTools::optimizeVertexFetch(indices, positions, ids);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2}));
+    CORRADE_COMPARE(positions, (std::vector<Vector2>{{2.0f, 0.5f}, {0.0f, 0.5f}, {1.0f, 0.5f}}));
+    CORRADE_COMPARE(ids, (std::vector<UnsignedInt>{12, 10, 11}));
+}
+
+void OptimizeMeshTest::vertexFetchWrongAttributeSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{2, 0, 2, 1};
+    std::vector<Vector2> positions{{0.0f, 0.5f}, {1.0f, 0.5f}, {2.0f, 0.5f}};
+    std::vector<UnsignedInt> ids{10, 11};
+    MeshTools::optimizeVertexFetch(indices, positions, ids);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexFetch(): expected 3 items in each attribute array but got 2\n");
+}
+
+void OptimizeMeshTest::overdraw() {
+    std::vector<UnsignedInt> indices = QuadIndices;
+    MeshTools::optimizeOverdraw(indices, QuadPositions, 4);
+
+    /* Each quad is a separate cluster, as the cache gets flushed between
+       them */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        4, 5, 6,
+        6, 5, 7,
+        0, 1, 2,
+        2, 1, 3
+    }));
+}
+
+void OptimizeMeshTest::overdrawEmpty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::optimizeOverdraw(indices, {}, 16);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void OptimizeMeshTest::overdrawOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{0, 1, 8};
+    MeshTools::optimizeOverdraw(indices, QuadPositions, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeOverdraw(): index 8 out of bounds for 8 vertices\n");
+}
+
+void OptimizeMeshTest::optimizeMesh() {
+    std::vector<Vector2> textureCoordinates;
+    for(std::size_t i = 0; i != QuadPositions.size(); ++i)
+        textureCoordinates.push_back(Vector2::xAxis(Float(i)));
+
+    Trade::MeshData3D data{MeshPrimitive::Triangles, QuadIndices, {QuadPositions}, {}, {textureCoordinates}, {}};
+    MeshTools::optimizeMesh(data);
+
+    /* Quads swapped, vertices renumbered by first use */
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{
+        0, 1, 2,
+        2, 1, 3,
+        4, 5, 6,
+        6, 5, 7
+    }));
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector3>{
+        QuadPositions[4], QuadPositions[5], QuadPositions[6], QuadPositions[7],
+        QuadPositions[0], QuadPositions[1], QuadPositions[2], QuadPositions[3]
+    }));
+    CORRADE_COMPARE(data.textureCoords2D(0), (std::vector<Vector2>{
+        {4.0f, 0.0f}, {5.0f, 0.0f}, {6.0f, 0.0f}, {7.0f, 0.0f},
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 0.0f}
+    }));
+}
+
+void OptimizeMeshTest::optimizeMeshNotIndexed() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Trade::MeshData3D data{MeshPrimitive::Triangles, {}, {QuadPositions}, {}, {}, {}};
+    MeshTools::optimizeMesh(data);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeMesh(): expected an indexed triangle mesh\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeMeshTest)
@@ -23,21 +23,40 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
 
+typedef Math::Vector2<UnsignedShort> Vector2us;
+typedef Math::Vector3<UnsignedShort> Vector3us;
+
 struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+    void removeDuplicatesNeighborCell();
+    void removeDuplicatesEmpty();
+
+    void removeDuplicatesExact();
+    void removeDuplicatesExactStrided();
+    void removeDuplicatesExactWrongIndexCount();
+    void removeDuplicatesExactWrongVertexSize();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+              &RemoveDuplicatesTest::removeDuplicatesNeighborCell,
+              &RemoveDuplicatesTest::removeDuplicatesEmpty,
+
+              &RemoveDuplicatesTest::removeDuplicatesExact,
+              &RemoveDuplicatesTest::removeDuplicatesExactStrided,
+              &RemoveDuplicatesTest::removeDuplicatesExactWrongIndexCount,
+              &RemoveDuplicatesTest::removeDuplicatesExactWrongVertexSize});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +78,93 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::removeDuplicatesNeighborCell() {
+    /* The second and third vector fall into neighboring cells, but are still
+       nearer than epsilon, so they should be merged. The last one should be
+       kept. */
+    std::vector<Vector2> data{
+        {0.0f, 0.0f},
+        {0.99f, 0.5f},
+        {1.01f, 0.5f},
+        {3.0f, 0.5f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.1f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 1, 2}));
+    CORRADE_COMPARE(data, (std::vector<Vector2>{
+        {0.0f, 0.0f},
+        {0.99f, 0.5f},
+        {3.0f, 0.5f}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesEmpty() {
+    std::vector<Vector2> data;
+    CORRADE_COMPARE(MeshTools::removeDuplicates(data), std::vector<UnsignedInt>{});
+    CORRADE_VERIFY(data.empty());
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExact() {
+    /* Unlike with removeDuplicates(), nearby values are not merged */
+    std::vector<Color3ub> data{
+        {1, 0, 255},
+        {2, 0, 255},
+        {1, 0, 255},
+        {0, 4, 7},
+        {2, 0, 255},
+        {0, 4, 7}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicatesExact(data);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2, 1, 2}));
+    CORRADE_COMPARE(data, (std::vector<Color3ub>{
+        {1, 0, 255},
+        {2, 0, 255},
+        {0, 4, 7}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExactStrided() {
+    /* Only the first two components of each vertex are compared and moved,
+       the third one should stay untouched */
+    Vector3us data[]{
+        {1, 2, 100},
+        {3, 4, 101},
+        {1, 2, 102},
+        {3, 4, 103},
+        {5, 6, 104}
+    };
+
+    std::vector<UnsignedInt> indices;
+    std::size_t uniqueCount;
+    std::tie(indices, uniqueCount) = MeshTools::removeDuplicatesExact({reinterpret_cast<char*>(data), 5, sizeof(Vector3us)}, sizeof(Vector2us));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 1, 2}));
+    CORRADE_COMPARE(uniqueCount, 3);
+    CORRADE_COMPARE(data[0], (Vector3us{1, 2, 100}));
+    CORRADE_COMPARE(data[1], (Vector3us{3, 4, 101}));
+    CORRADE_COMPARE(data[2], (Vector3us{5, 6, 102}));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExactWrongIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[12]{};
+    UnsignedInt indices[2];
+    MeshTools::removeDuplicatesExactInto({data, 3, 4}, 4, indices);
+    CORRADE_COMPARE(out.str(), "MeshTools::removeDuplicatesExactInto(): output index array has 2 items but expected 3\n");
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExactWrongVertexSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[12]{};
+    UnsignedInt indices[3];
+    MeshTools::removeDuplicatesExactInto({data, 3, 4}, 6, indices);
+    CORRADE_COMPARE(out.str(), "MeshTools::removeDuplicatesExactInto(): vertex size 6 is larger than stride 4\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
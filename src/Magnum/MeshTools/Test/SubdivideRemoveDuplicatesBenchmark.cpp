@@ -40,18 +40,36 @@ struct SubdivideRemoveDuplicatesBenchmark: TestSuite::Tester {
     void subdivide();
     void subdivideAndRemoveDuplicatesAfter();
     void subdivideAndRemoveDuplicatesInBetween();
+
+    void removeDuplicatesLarge();
+    void removeDuplicatesLargeIndexed();
+
+    private:
+        std::vector<UnsignedInt> _largeIndices;
+        std::vector<Vector3> _largePositions;
 };
 
+namespace {
+    static Vector3 interpolator(const Vector3& a, const Vector3& b) {
+        return (a+b).normalized();
+    }
+}
+
 SubdivideRemoveDuplicatesBenchmark::SubdivideRemoveDuplicatesBenchmark() {
     addBenchmarks({&SubdivideRemoveDuplicatesBenchmark::subdivide,
                    &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesAfter,
                    &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesInBetween}, 4);
-}
 
-namespace {
-    static Vector3 interpolator(const Vector3& a, const Vector3& b) {
-        return (a+b).normalized();
-    }
+    addBenchmarks({&SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLarge,
+                   &SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLargeIndexed}, 2);
+
+    /* An icosphere subdivided 8 times without removing duplicates in
+       between, having 1.3M vertices with each new vertex present twice */
+    Trade::MeshData3D icosphere = Primitives::icosphereSolid(0);
+    _largeIndices = std::move(icosphere.indices());
+    _largePositions = std::move(icosphere.positions(0));
+    for(std::size_t i = 0; i != 8; ++i)
+        MeshTools::subdivide(_largeIndices, _largePositions, interpolator);
 }
 
 void SubdivideRemoveDuplicatesBenchmark::subdivide() {
@@ -89,6 +107,31 @@ void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesInBetween()
     }
 }
 
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLarge() {
+    /* Expanded to a non-indexed triangle soup with 3.9M vertices, each
+       present roughly six times */
+    std::vector<Vector3> positions = MeshTools::duplicate(_largeIndices, _largePositions);
+
+    std::vector<UnsignedInt> indices;
+    CORRADE_BENCHMARK(1)
+        indices = MeshTools::removeDuplicates(positions);
+
+    CORRADE_COMPARE(indices.size(), _largeIndices.size());
+    CORRADE_COMPARE(positions.size(), 655362);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicatesLargeIndexed() {
+    std::vector<Vector3> positions = _largePositions;
+    const std::size_t size = positions.size();
+
+    std::vector<UnsignedInt> indices;
+    CORRADE_BENCHMARK(1)
+        indices = MeshTools::removeDuplicates(positions);
+
+    CORRADE_COMPARE(indices.size(), size);
+    CORRADE_COMPARE(positions.size(), 655362);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <random>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/Forsyth.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/MeshTools/VertexCache.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct VertexCacheBenchmark: TestSuite::Tester {
+    explicit VertexCacheBenchmark();
+
+    void tipsify();
+    void forsyth();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        UnsignedInt _vertexCount;
+        VertexCacheStatistics _original;
+};
+
+constexpr std::size_t CacheSize = 24;
+
+VertexCacheBenchmark::VertexCacheBenchmark() {
+    addBenchmarks({&VertexCacheBenchmark::tipsify,
+                   &VertexCacheBenchmark::forsyth}, 5);
+
+    /* An icosphere with 80k triangles, shuffled to make the cache behave as
+       badly as with an unoptimized imported mesh */
+    Trade::MeshData3D icosphere = Primitives::icosphereSolid(6);
+    _vertexCount = icosphere.positions(0).size();
+    const std::vector<UnsignedInt>& indices = icosphere.indices();
+    std::vector<UnsignedInt> triangles(indices.size()/3);
+    for(std::size_t i = 0; i != triangles.size(); ++i) triangles[i] = i;
+    std::shuffle(triangles.begin(), triangles.end(), std::minstd_rand{});
+    _indices.reserve(indices.size());
+    for(UnsignedInt t: triangles)
+        _indices.insert(_indices.end(), indices.begin() + t*3, indices.begin() + t*3 + 3);
+
+    _original = vertexCacheStatistics(_indices, _vertexCount, CacheSize);
+}
+
+void VertexCacheBenchmark::tipsify() {
+    std::vector<UnsignedInt> indices = _indices;
+    CORRADE_BENCHMARK(1)
+        MeshTools::tipsify(indices, _vertexCount, CacheSize);
+
+    const VertexCacheStatistics optimized = vertexCacheStatistics(indices, _vertexCount, CacheSize);
+    CORRADE_COMPARE(indices.size(), _indices.size());
+    CORRADE_VERIFY(optimized.acmr < _original.acmr);
+    CORRADE_VERIFY(optimized.atvr < _original.atvr);
+}
+
+void VertexCacheBenchmark::forsyth() {
+    std::vector<UnsignedInt> indices = _indices;
+    CORRADE_BENCHMARK(1)
+        MeshTools::forsyth(indices, _vertexCount, CacheSize);
+
+    const VertexCacheStatistics optimized = vertexCacheStatistics(indices, _vertexCount, CacheSize);
+    CORRADE_COMPARE(indices.size(), _indices.size());
+    CORRADE_VERIFY(optimized.acmr < _original.acmr);
+    CORRADE_VERIFY(optimized.atvr < _original.atvr);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::VertexCacheBenchmark)
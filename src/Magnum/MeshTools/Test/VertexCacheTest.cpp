@@ -0,0 +1,140 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/VertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct VertexCacheTest: TestSuite::Tester {
+    explicit VertexCacheTest();
+
+    void optimizeTipsify();
+    void optimizeForsyth();
+
+    void statistics();
+    void statisticsEvicted();
+    void statisticsEmpty();
+    void statisticsOutOfBounds();
+
+    void debugOptimizer();
+};
+
+VertexCacheTest::VertexCacheTest() {
+    addTests({&VertexCacheTest::optimizeTipsify,
+              &VertexCacheTest::optimizeForsyth,
+
+              &VertexCacheTest::statistics,
+              &VertexCacheTest::statisticsEvicted,
+              &VertexCacheTest::statisticsEmpty,
+              &VertexCacheTest::statisticsOutOfBounds,
+
+              &VertexCacheTest::debugOptimizer});
+}
+
+/* Two triangle strips walked in the worst possible order */
+const std::vector<UnsignedInt> Indices{
+    0, 1, 4,
+    2, 3, 6,
+    1, 5, 4,
+    3, 7, 6,
+    1, 2, 5,
+    2, 6, 5
+};
+
+void VertexCacheTest::optimizeTipsify() {
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::optimizeVertexCache(indices, 8, 4, VertexCacheOptimizer::Tipsify);
+
+    CORRADE_COMPARE(indices.size(), Indices.size());
+    CORRADE_VERIFY(vertexCacheStatistics(indices, 8, 4).transformedVertexCount < vertexCacheStatistics(Indices, 8, 4).transformedVertexCount);
+}
+
+void VertexCacheTest::optimizeForsyth() {
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::optimizeVertexCache(indices, 8, 4, VertexCacheOptimizer::Forsyth);
+
+    CORRADE_COMPARE(indices.size(), Indices.size());
+    CORRADE_VERIFY(vertexCacheStatistics(indices, 8, 4).transformedVertexCount < vertexCacheStatistics(Indices, 8, 4).transformedVertexCount);
+}
+
+void VertexCacheTest::statistics() {
+    /* First three vertices miss, then two hits and one miss */
+    const VertexCacheStatistics statistics = vertexCacheStatistics({
+        0, 1, 2,
+        2, 1, 3
+    }, 4, 3);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 4);
+    CORRADE_COMPARE(statistics.acmr, 2.0f);
+    CORRADE_COMPARE(statistics.atvr, 1.0f);
+}
+
+void VertexCacheTest::statisticsEvicted() {
+    /* The first three vertices are evicted by the next three with cache size
+       3, but stay there with cache size 6 */
+    const std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        3, 4, 5,
+        0, 1, 2
+    };
+
+    const VertexCacheStatistics small = vertexCacheStatistics(indices, 6, 3);
+    CORRADE_COMPARE(small.transformedVertexCount, 9);
+    CORRADE_COMPARE(small.acmr, 3.0f);
+    CORRADE_COMPARE(small.atvr, 1.5f);
+
+    const VertexCacheStatistics large = vertexCacheStatistics(indices, 6, 6);
+    CORRADE_COMPARE(large.transformedVertexCount, 6);
+    CORRADE_COMPARE(large.acmr, 2.0f);
+    CORRADE_COMPARE(large.atvr, 1.0f);
+}
+
+void VertexCacheTest::statisticsEmpty() {
+    const VertexCacheStatistics statistics = vertexCacheStatistics({}, 0, 16);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 0);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void VertexCacheTest::statisticsOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    vertexCacheStatistics({0, 1, 2, 2, 1, 3}, 3, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::vertexCacheStatistics(): index 3 out of bounds for 3 vertices\n");
+}
+
+void VertexCacheTest::debugOptimizer() {
+    std::ostringstream out;
+
+    Debug{&out} << VertexCacheOptimizer::Forsyth << VertexCacheOptimizer(0xf0);
+    CORRADE_COMPARE(out.str(), "MeshTools::VertexCacheOptimizer::Forsyth MeshTools::VertexCacheOptimizer(0xf0)\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::VertexCacheTest)
@@ -25,7 +25,7 @@
 
 #include "Tipsify.h"
 
-#include <stack>
+#include <Corrade/Containers/Array.h>
 
 namespace Magnum { namespace MeshTools { namespace Implementation {
 
@@ -36,11 +36,25 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
     /* Global time, per-vertex caching timestamps, per-triangle emmited flag */
     UnsignedInt time = cacheSize+1;
-    std::vector<UnsignedInt> timestamp(vertexCount);
-    std::vector<bool> emitted(indices.size()/3);
-
-    /* Dead-end vertex stack */
-    std::stack<UnsignedInt> deadEndStack;
+    Containers::Array<UnsignedInt> timestamp{Containers::ValueInit, vertexCount};
+    Containers::Array<bool> emitted{Containers::ValueInit, indices.size()/3};
+
+    /* Dead-end vertex stack. Each emitted vertex is pushed there only once,
+       so reserving the whole index count means it never reallocates. */
+    std::vector<UnsignedInt> deadEndStack;
+    deadEndStack.reserve(indices.size());
+
+    /* Array with candidates for next fanning vertex (in 1-ring around fanning
+       vertex). Fanning around a vertex emits at most all its neighboring
+       triangles, so reserving for the largest valence means it never
+       reallocates either. */
+    std::vector<UnsignedInt> candidates;
+    {
+        UnsignedInt maxValence = 0;
+        for(UnsignedInt count: liveTriangleCount)
+            if(count > maxValence) maxValence = count;
+        candidates.reserve(maxValence*3);
+    }
 
     /* Output index buffer */
     std::vector<UnsignedInt> outputIndices;
@@ -50,12 +64,12 @@ void Tipsify::operator()(std::size_t cacheSize) {
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
-        /* Array with candidates for next fanning vertex (in 1-ring around
-           fanning vertex) */
-        std::vector<UnsignedInt> candidates;
+        candidates.clear();
 
         /* For all neighbors of fanning vertex */
-        for(UnsignedInt ti = neighborPosition[fanningVertex], t = neighbors[ti]; ti != neighborPosition[fanningVertex+1]; t = neighbors[++ti]) {
+        for(UnsignedInt ti = neighborPosition[fanningVertex], end = neighborPosition[fanningVertex+1]; ti != end; ++ti) {
+            const UnsignedInt t = neighbors[ti];
+
             /* Continue if already emitted */
             if(emitted[t]) continue;
             emitted[t] = true;
@@ -68,7 +82,7 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
                 /* Add to dead end stack and candidates array */
                 /** @todo Limit size of dead end stack to cache size */
-                deadEndStack.push(v);
+                deadEndStack.push_back(v);
                 candidates.push_back(v);
 
                 /* Decrease live triangle count */
@@ -105,8 +119,8 @@ void Tipsify::operator()(std::size_t cacheSize) {
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
             while(!deadEndStack.empty()) {
-                unsigned int d = deadEndStack.top();
-                deadEndStack.pop();
+                const UnsignedInt d = deadEndStack.back();
+                deadEndStack.pop_back();
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -0,0 +1,87 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VertexCache.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/MeshTools/Forsyth.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+Debug& operator<<(Debug& debug, const VertexCacheOptimizer value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case VertexCacheOptimizer::value: return debug << "MeshTools::VertexCacheOptimizer::" #value;
+        _c(Tipsify)
+        _c(Forsyth)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "MeshTools::VertexCacheOptimizer(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+void optimizeVertexCache(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, const VertexCacheOptimizer optimizer) {
+    switch(optimizer) {
+        case VertexCacheOptimizer::Tipsify:
+            tipsify(indices, vertexCount, cacheSize);
+            return;
+        case VertexCacheOptimizer::Forsyth:
+            forsyth(indices, vertexCount, cacheSize);
+            return;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+VertexCacheStatistics vertexCacheStatistics(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::vertexCacheStatistics(): index count is not divisible by 3", {});
+
+    /* Same timestamp-based FIFO cache simulation as in tipsify(). Vertex is
+       in the cache if there was less than cacheSize misses since it got
+       there. */
+    UnsignedInt time = cacheSize + 1;
+    Containers::Array<UnsignedInt> timestamp{Containers::ValueInit, vertexCount};
+    UnsignedInt transformedVertexCount = 0;
+    for(const UnsignedInt v: indices) {
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::vertexCacheStatistics(): index" << v << "out of bounds for" << vertexCount << "vertices", {});
+        if(time - timestamp[v] <= cacheSize) continue;
+
+        timestamp[v] = time++;
+        ++transformedVertexCount;
+    }
+
+    return VertexCacheStatistics{transformedVertexCount,
+        indices.empty() ? 0.0f : Float(transformedVertexCount)/Float(indices.size()/3),
+        vertexCount ? Float(transformedVertexCount)/Float(vertexCount) : 0.0f};
+}
+
+}}
@@ -0,0 +1,116 @@
+#ifndef Magnum_MeshTools_VertexCache_h
+#define Magnum_MeshTools_VertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::MeshTools::VertexCacheOptimizer, struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::optimizeVertexCache(), @ref Magnum::MeshTools::vertexCacheStatistics()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex cache optimizer
+
+@see @ref optimizeVertexCache()
+*/
+enum class VertexCacheOptimizer: UnsignedByte {
+    /** @ref tipsify() */
+    Tipsify,
+
+    /** @ref forsyth() */
+    Forsyth
+};
+
+/** @debugoperatorenum{VertexCacheOptimizer} */
+MAGNUM_MESHTOOLS_EXPORT Debug& operator<<(Debug& debug, VertexCacheOptimizer value);
+
+/**
+@brief Optimize the mesh for post-transform vertex cache
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] optimizer    Algorithm to use
+
+Delegates to either @ref tipsify() or @ref forsyth(). Use
+@ref vertexCacheStatistics() to measure the result.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCache(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, VertexCacheOptimizer optimizer = VertexCacheOptimizer::Tipsify);
+
+/**
+@brief Vertex cache statistics
+
+@see @ref vertexCacheStatistics()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Transformed vertex count
+     *
+     * Count of vertices that were not found in the cache.
+     */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Transformed vertex count divided by triangle count. Lies between
+     * @cpp 0.5f @ce for an ideal mesh and @cpp 3.0f @ce when each vertex
+     * of each triangle misses the cache.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transformed vertex ratio
+     *
+     * Transformed vertex count divided by vertex count. The ideal value is
+     * @cpp 1.0f @ce, which means each vertex is transformed exactly once.
+     * Unlike @ref acmr, it doesn't depend on the mesh topology, so it's
+     * better suited for comparing results on different meshes.
+     */
+    Float atvr;
+};
+
+/**
+@brief Measure post-transform vertex cache efficiency
+@param indices      Index array
+@param vertexCount  Vertex count
+@param cacheSize    Size of the simulated FIFO vertex cache
+
+Simulates a FIFO post-transform vertex cache of given size and counts vertex
+cache misses when drawing the mesh in given index order. Useful for comparing
+output of @ref tipsify() and @ref forsyth().
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics vertexCacheStatistics(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
@@ -41,12 +41,20 @@ namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
         Dirty = 1 << 0,
         Visited = 1 << 1,
-        Joint = 1 << 2
+        Joint = 1 << 2,
+        Flat = 1 << 3,
+        FlatDirty = 1 << 4
     };
 
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
 
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
+
+    /* Calls function(state, i) for all i in [0, count) distributed across
+       threadCount threads (0 meaning hardware concurrency), the calling
+       thread included. Serial if the library is built without threading
+       support. Non-templated to avoid pulling <thread> into the headers. */
+    MAGNUM_SCENEGRAPH_EXPORT void parallelFor(std::size_t count, UnsignedInt threadCount, void(*function)(void*, std::size_t), void* state);
 }
 
 /**
@@ -258,7 +266,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Transformations of given group of objects relative to this object
          *
          * All transformations can be premultiplied with @p initialTransformation,
-         * if specified.
+         * if specified. If this is a @ref Scene with the flat transformation
+         * cache enabled, the cache is updated and the transformations are
+         * taken from it, see @ref Scene::setFlatTransformationCache() for
+         * more information.
          * @see @ref transformationMatrices()
          */
         /* `objects` passed by copy intentionally (to allow move from
@@ -288,6 +299,31 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* `objects` passed by copy intentionally (to avoid copy internally) */
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
+        /**
+         * @brief Clean absolute transformations of given set of objects in parallel
+         * @param objects       Objects to clean
+         * @param threadCount   Count of threads to use. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         *
+         * Equivalent to @ref setClean(std::vector<std::reference_wrapper<Object<Transformation>>>),
+         * but the objects are partitioned by the top-level subtree (i.e.,
+         * the direct child of the scene) they belong to and absolute
+         * transformations of each subtree are calculated on a separate
+         * thread. The @ref AbstractFeature::clean() and
+         * @ref AbstractFeature::cleanInverted() callbacks are then called
+         * afterwards from the calling thread, in the same order as
+         * @ref setClean(std::vector<std::reference_wrapper<Object<Transformation>>>)
+         * would call them, so the features don't need to be thread-safe.
+         *
+         * Useful for large scenes with many independent subtrees, such as
+         * crowds or particle emitters. A scene with just a single top-level
+         * object won't benefit from this. If Magnum is not built with
+         * @ref MAGNUM_BUILD_MULTITHREADED, the calculation is done serially.
+         * Expects that all objects are part of the same scene.
+         */
+        /* `objects` passed by copy intentionally (to avoid copy internally) */
+        static void setCleanParallel(std::vector<std::reference_wrapper<Object<Transformation>>> objects, UnsignedInt threadCount = 0);
+
         /** @copydoc AbstractObject::isDirty() */
         bool isDirty() const { return !!(flags & Flag::Dirty); }
 
@@ -322,6 +358,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
         friend Containers::LinkedList<Object<Transformation>>;
         friend Containers::LinkedListItem<Object<Transformation>, Object<Transformation>>;
+        friend Scene<Transformation>;
         #endif
 
         Object<Transformation>* doScene() override final;
@@ -346,11 +383,21 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
 
+        static void MAGNUM_SCENEGRAPH_LOCAL collectDirtyObjects(std::vector<std::reference_wrapper<Object<Transformation>>>& objects);
+
+        void MAGNUM_SCENEGRAPH_LOCAL setDirtyInternal();
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
 
+        void MAGNUM_SCENEGRAPH_LOCAL setFlatDirty();
+        void MAGNUM_SCENEGRAPH_LOCAL invalidateFlatTransformationCache();
+        std::vector<typename Transformation::DataType> MAGNUM_SCENEGRAPH_LOCAL flatTransformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation) const;
+
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
+        /* Index in the flat transformation cache of the scene, valid only if
+           Flag::Flat is set */
+        UnsignedInt flatIndex;
         Flags flags;
 };
 
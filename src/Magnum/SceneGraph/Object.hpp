@@ -43,11 +43,124 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flatIndex(0xFFFFFFFFu), flags(Flag::Dirty) {
     setParent(parent);
 }
 
-template<class Transformation> Object<Transformation>::~Object() = default;
+template<class Transformation> Object<Transformation>::~Object() {
+    /* If the object is part of a flat transformation cache, the cache needs
+       to be rebuilt. Do it here while the hierarchy is still intact and
+       remove the mark from the whole subtree so the children (which are
+       destroyed after this) don't need to walk up through partially destroyed
+       parents again. */
+    if(flags & Flag::Flat) {
+        invalidateFlatTransformationCache();
+
+        std::vector<Object<Transformation>*> objects{this};
+        while(!objects.empty()) {
+            Object<Transformation>* o = objects.back();
+            objects.pop_back();
+            o->flags &= ~(Flag::Flat|Flag::FlatDirty);
+            for(Object<Transformation>& child: o->children())
+                if(child.flags & Flag::Flat) objects.push_back(&child);
+        }
+    }
+}
+
+template<class Transformation> Scene<Transformation>::~Scene() {
+    /* Remove the flat transformation cache marks from all objects so they
+       don't try to access the cache while being destroyed */
+    setFlatTransformationCache(false);
+}
+
+template<class Transformation> Scene<Transformation>& Scene<Transformation>::setFlatTransformationCache(const bool enabled) {
+    if(enabled == !!_flatTransformationCache) return *this;
+
+    /* The cache gets populated on first use */
+    if(enabled) {
+        _flatTransformationCache.reset(new Implementation::FlatTransformationCache<Transformation>);
+        return *this;
+    }
+
+    /* The object list in the cache might be stale, so walk the actual
+       hierarchy to remove the marks */
+    std::vector<Object<Transformation>*> objects{this};
+    while(!objects.empty()) {
+        Object<Transformation>* o = objects.back();
+        objects.pop_back();
+        o->flags &= ~(Object<Transformation>::Flag::Flat|Object<Transformation>::Flag::FlatDirty);
+        for(Object<Transformation>& child: o->children())
+            objects.push_back(&child);
+    }
+
+    _flatTransformationCache.reset();
+    return *this;
+}
+
+template<class Transformation> void Scene<Transformation>::updateFlatTransformationCache() {
+    typedef typename Object<Transformation>::Flag Flag;
+    Implementation::FlatTransformationCache<Transformation>& cache = *_flatTransformationCache;
+
+    /* Hierarchy changed, rebuild the whole cache */
+    if(cache.structureDirty) {
+        cache.objects.clear();
+        cache.parents.clear();
+        cache.dirty.clear();
+
+        /* Depth-first pre-order traversal. Children are pushed in reverse so
+           they end up in the original order. */
+        std::vector<std::pair<Object<Transformation>*, UnsignedInt>> stack{{this, 0xFFFFFFFFu}};
+        while(!stack.empty()) {
+            Object<Transformation>* const o = stack.back().first;
+            const UnsignedInt parent = stack.back().second;
+            stack.pop_back();
+
+            const UnsignedInt index = cache.objects.size();
+            o->flatIndex = index;
+            o->flags |= Flag::Flat;
+            o->flags &= ~Flag::FlatDirty;
+            cache.objects.push_back(o);
+            cache.parents.push_back(parent);
+
+            for(Object<Transformation>* child = o->children().last(); child; child = child->previousSibling())
+                stack.emplace_back(child, index);
+        }
+
+        /* Calculate subtree ranges bottom-up, children are always after their
+           parents */
+        const std::size_t count = cache.objects.size();
+        cache.subtreeEnds.resize(count);
+        for(std::size_t i = 0; i != count; ++i)
+            cache.subtreeEnds[i] = i + 1;
+        for(std::size_t i = count - 1; i != 0; --i)
+            cache.subtreeEnds[cache.parents[i]] = std::max(cache.subtreeEnds[cache.parents[i]], cache.subtreeEnds[i]);
+
+        /* Calculate all transformations. The scene has always identity
+           transformation. */
+        cache.absoluteTransformations.resize(count);
+        cache.absoluteTransformations[0] = typename Transformation::DataType{};
+        for(std::size_t i = 1; i != count; ++i)
+            cache.absoluteTransformations[i] = Implementation::Transformation<Transformation>::compose(cache.absoluteTransformations[cache.parents[i]], cache.objects[i]->transformation());
+
+        cache.structureDirty = false;
+        return;
+    }
+
+    /* Otherwise recalculate only the dirty subtrees. Going in order, so
+       subtrees nested in already recalculated ones are skipped and the parent
+       of each subtree root is always up-to-date. */
+    std::sort(cache.dirty.begin(), cache.dirty.end());
+    UnsignedInt updatedEnd = 0;
+    for(const UnsignedInt root: cache.dirty) {
+        cache.objects[root]->flags &= ~Flag::FlatDirty;
+        if(root < updatedEnd) continue;
+
+        updatedEnd = cache.subtreeEnds[root];
+        for(UnsignedInt i = std::max(root, 1u); i < updatedEnd; ++i)
+            cache.absoluteTransformations[i] = Implementation::Transformation<Transformation>::compose(cache.absoluteTransformations[cache.parents[i]], cache.objects[i]->transformation());
+    }
+    cache.dirty.clear();
+}
 
 template<class Transformation> Scene<Transformation>* Object<Transformation>::scene() {
     Object<Transformation>* p(this);
@@ -90,12 +203,20 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
         p = p->parent();
     }
 
+    /* The object was part of a flat transformation cache, which now needs to
+       be rebuilt */
+    if(flags & Flag::Flat) invalidateFlatTransformationCache();
+
     /* Remove the object from old parent children list */
     if(this->parent()) this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
 
     /* Add the object to list of new parent */
     if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
 
+    /* The new parent is part of a flat transformation cache, which now needs
+       to be rebuilt */
+    if(parent && (parent->flags & Flag::Flat)) invalidateFlatTransformationCache();
+
     setDirty();
     return *this;
 }
@@ -117,6 +238,14 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
 }
 
 template<class Transformation> void Object<Transformation>::setDirty() {
+    /* Schedule recalculation of the whole subtree in the flat transformation
+       cache. This is independent of the feature caching below. */
+    if((flags & Flag::Flat) && !(flags & Flag::FlatDirty)) setFlatDirty();
+
+    setDirtyInternal();
+}
+
+template<class Transformation> void Object<Transformation>::setDirtyInternal() {
     /* The transformation of this object (and all children) is already dirty,
        nothing to do */
     if(flags & Flag::Dirty) return;
@@ -125,14 +254,39 @@ template<class Transformation> void Object<Transformation>::setDirty() {
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features())
         feature.markDirty();
 
-    /* Make all children dirty */
+    /* Make all children dirty. The flat transformation cache has the whole
+       subtree already scheduled for recalculation, so not going through
+       setDirty(). */
     for(Object<Transformation>& child: children())
-        child.setDirty();
+        child.setDirtyInternal();
 
     /* Mark object as dirty */
     flags |= Flag::Dirty;
 }
 
+template<class Transformation> void Object<Transformation>::setFlatDirty() {
+    /* The object might have been moved away from the scene with the cache or
+       the cache might have been disabled since */
+    Scene<Transformation>* const scene = this->scene();
+    if(!scene || !scene->_flatTransformationCache) {
+        flags &= ~Flag::Flat;
+        return;
+    }
+
+    /* If the cache is going to be rebuilt, there's nothing to do */
+    Implementation::FlatTransformationCache<Transformation>& cache = *scene->_flatTransformationCache;
+    if(cache.structureDirty) return;
+
+    flags |= Flag::FlatDirty;
+    cache.dirty.push_back(flatIndex);
+}
+
+template<class Transformation> void Object<Transformation>::invalidateFlatTransformationCache() {
+    Scene<Transformation>* const scene = this->scene();
+    if(scene && scene->_flatTransformationCache)
+        scene->_flatTransformationCache->structureDirty = true;
+}
+
 template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
@@ -203,7 +357,17 @@ computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    /* Scene object */
+    const Scene<Transformation>* scene = this->scene();
+    #endif
+
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+
+    /* The scene has a flat transformation cache, use it */
+    if(isScene() && static_cast<const Scene<Transformation>*>(this)->_flatTransformationCache)
+        return flatTransformations(objects, initialTransformation);
 
     /* Remember object count for later */
     std::size_t objectCount = objects.size();
@@ -213,60 +377,51 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     for(std::size_t i = 0; i != objects.size(); ++i) {
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(objects[i].get().counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
+        objects[i].get().counter = UnsignedInt(i);
         objects[i].get().flags |= Flag::Joint;
     }
     std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
-    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
-    #endif
+    /* Mark all objects up the hierarchy as visited. Each object goes up until
+       it reaches the root or an object that's either a joint or was already
+       visited from another object -- which then becomes a joint. */
+    for(Object<Transformation>& object: objects) {
+        Object<Transformation>* o = &object;
 
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
-
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+        /* Already visited, continue to next (duplicate occurence) */
+        if(o->flags & Flag::Visited) continue;
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-        Object<Transformation>* parent = it->get().parent();
+            Object<Transformation>* parent = o->parent();
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is an joint or already visited, done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                /* If not already marked as joint, mark it as such and add it
+                   to list of joint objects */
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                    parent->counter = UnsignedInt(jointObjects.size());
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
     /* Array of absolute transformations in joints */
@@ -287,9 +442,9 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     for(auto i: jointObjects) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
+        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFFFFFu || i.get().flags & Flag::Joint);
         i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        i.get().counter = 0xFFFFFFFFu;
     }
 
     /* Shrink the array to contain only transformations of requested objects and return */
@@ -334,6 +489,24 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     }
 }
 
+template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::flatTransformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation) const {
+    /* The function is const only because the API is, the cache updates the
+       object flags */
+    Scene<Transformation>& scene = const_cast<Scene<Transformation>&>(static_cast<const Scene<Transformation>&>(*this));
+    scene.updateFlatTransformationCache();
+    const Implementation::FlatTransformationCache<Transformation>& cache = *scene._flatTransformationCache;
+
+    std::vector<typename Transformation::DataType> transformations;
+    transformations.reserve(objects.size());
+    for(const Object<Transformation>& o: objects) {
+        CORRADE_ASSERT(o.flatIndex < cache.objects.size() && cache.objects[o.flatIndex] == &o,
+            "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+        transformations.push_back(Implementation::Transformation<Transformation>::compose(initialTransformation, cache.absoluteTransformations[o.flatIndex]));
+    }
+
+    return transformations;
+}
+
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
     std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
     castObjects.reserve(objects.size());
@@ -343,7 +516,7 @@ template<class Transformation> void Object<Transformation>::doSetClean(const std
     setClean(std::move(castObjects));
 }
 
-template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects) {
+template<class Transformation> void Object<Transformation>::collectDirtyObjects(std::vector<std::reference_wrapper<Object<Transformation>>>& objects) {
     /* Remove all clean objects from the list */
     auto firstClean = std::remove_if(objects.begin(), objects.end(), [](Object<Transformation>& o) { return !o.isDirty(); });
     objects.erase(firstClean, objects.end());
@@ -366,6 +539,12 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
 
     /* Cleanup all marks */
     for(auto o: objects) o.get().flags &= ~Flag::Visited;
+}
+
+template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects) {
+    /* Remove clean objects, add dirty parents. No dirty objects left, done. */
+    collectDirtyObjects(objects);
+    if(objects.empty()) return;
 
     /* Compute absolute transformations */
     Scene<Transformation>* scene = objects[0].get().scene();
@@ -382,6 +561,126 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     }
 }
 
+namespace Implementation {
+
+template<class Transformation> struct ParallelCleanState {
+    const std::vector<std::reference_wrapper<Object<Transformation>>>& objects;
+    const Scene<Transformation>& scene;
+    /* Object indices sorted by subtree and depth, and offsets of each
+       subtree in it */
+    const std::vector<std::size_t>& order;
+    const std::vector<std::size_t>& subtreeOffsets;
+    std::vector<typename Transformation::DataType>& transformations;
+};
+
+}
+
+template<class Transformation> void Object<Transformation>::setCleanParallel(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const UnsignedInt threadCount) {
+    /* Remove clean objects, add dirty parents. No dirty objects left, done. */
+    collectDirtyObjects(objects);
+    if(objects.empty()) return;
+
+    Scene<Transformation>* const scene = objects[0].get().scene();
+    CORRADE_ASSERT(scene, "SceneGraph::Object::setCleanParallel(): objects must be part of some scene", );
+
+    /* Find the top-level object (i.e., the direct child of the scene) and
+       depth of each object. The scene itself, if it's dirty, is treated as
+       a separate subtree. */
+    std::vector<Object<Transformation>*> topLevel(objects.size());
+    std::vector<UnsignedInt> depths(objects.size());
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        Object<Transformation>* o = &objects[i].get();
+        UnsignedInt depth = 0;
+        while(o != scene && o->parent() != scene) {
+            CORRADE_ASSERT(o->parent(), "SceneGraph::Object::setCleanParallel(): the objects are not part of the same scene", );
+            o = o->parent();
+            ++depth;
+        }
+
+        topLevel[i] = o;
+        depths[i] = depth;
+    }
+
+    /* Assign subtree IDs, the scene being subtree 0. The IDs are temporarily
+       stored in the counter of the top-level objects. */
+    std::vector<UnsignedInt> subtrees(objects.size());
+    std::vector<Object<Transformation>*> topLevelObjects{scene};
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        Object<Transformation>* const o = topLevel[i];
+        if(o == scene) continue;
+
+        if(o->counter == 0xFFFFFFFFu) {
+            o->counter = UnsignedInt(topLevelObjects.size());
+            topLevelObjects.push_back(o);
+        }
+        subtrees[i] = o->counter;
+    }
+    for(std::size_t i = 1; i != topLevelObjects.size(); ++i)
+        topLevelObjects[i]->counter = 0xFFFFFFFFu;
+
+    /* Sort the objects by subtree and then by depth, so parents are always
+       calculated before their children. Including the index in the
+       comparison makes the order deterministic. */
+    std::vector<std::size_t> order(objects.size());
+    for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&subtrees, &depths](std::size_t a, std::size_t b) {
+        if(subtrees[a] != subtrees[b]) return subtrees[a] < subtrees[b];
+        if(depths[a] != depths[b]) return depths[a] < depths[b];
+        return a < b;
+    });
+    std::vector<std::size_t> subtreeOffsets(topLevelObjects.size() + 1);
+    for(std::size_t i = 0, subtree = 0; subtree != subtreeOffsets.size(); ++subtree) {
+        while(i != order.size() && subtrees[order[i]] < subtree) ++i;
+        subtreeOffsets[subtree] = i;
+    }
+
+    /* Save index of each object so children can find the transformation of
+       their dirty parent. Duplicates get the last index, which doesn't
+       matter as all of them are calculated before any children. */
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        objects[i].get().counter = UnsignedInt(i);
+
+    /* Calculate absolute transformations of each subtree on a separate
+       thread. The threads are only reading the hierarchy and each of them is
+       writing to a different part of the output. The scene is a root, so its
+       absolute transformation is its own transformation. */
+    std::vector<typename Transformation::DataType> transformations(objects.size());
+    Implementation::ParallelCleanState<Transformation> state{objects, *scene, order, subtreeOffsets, transformations};
+    Implementation::parallelFor(topLevelObjects.size(), threadCount, [](void* statePointer, std::size_t subtree) {
+        auto& state = *static_cast<Implementation::ParallelCleanState<Transformation>*>(statePointer);
+        for(std::size_t i = state.subtreeOffsets[subtree], end = state.subtreeOffsets[subtree + 1]; i != end; ++i) {
+            const std::size_t index = state.order[i];
+            const Object<Transformation>& o = state.objects[index];
+            const Object<Transformation>* const parent = o.parent();
+
+            typename Transformation::DataType parentTransformation;
+            if(!parent) {}
+            else if(parent == &state.scene)
+                parentTransformation = state.scene.transformation();
+            else if(parent->isDirty())
+                parentTransformation = state.transformations[parent->counter];
+            else
+                parentTransformation = parent->absoluteTransformation();
+
+            state.transformations[index] = Implementation::Transformation<Transformation>::compose(parentTransformation, o.transformation());
+        }
+    }, &state);
+
+    /* Cleanup the indices */
+    for(Object<Transformation>& o: objects) o.counter = 0xFFFFFFFFu;
+
+    /* Clean all objects from the calling thread in the same order as
+       setClean() does */
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        /* The object might be duplicated in the list, don't clean it more
+           than once */
+        if(!objects[i].get().isDirty()) continue;
+
+        objects[i].get().setCleanInternal(transformations[i]);
+        CORRADE_ASSERT(!objects[i].get().isDirty(), "SceneGraph::Object::setCleanParallel(): original implementation was not called", );
+    }
+}
+
 template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
     /* "Lazy storage" for transformation matrix and inverted transformation matrix */
     CachedTransformations cached;
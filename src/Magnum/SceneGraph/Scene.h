@@ -29,10 +29,31 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <memory>
+
 #include "Magnum/SceneGraph/Object.h"
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    template<class Transformation> struct FlatTransformationCache {
+        /* Objects in depth-first pre-order, so each subtree is a contiguous
+           range [i, subtreeEnds[i]) and each parent precedes its children.
+           The scene is always at index 0. */
+        std::vector<Object<Transformation>*> objects;
+        std::vector<UnsignedInt> parents;
+        std::vector<UnsignedInt> subtreeEnds;
+        std::vector<typename Transformation::DataType> absoluteTransformations;
+
+        /* Roots of subtrees that need their absolute transformations
+           recalculated */
+        std::vector<UnsignedInt> dirty;
+
+        /* Set if the hierarchy changed, the whole cache is then rebuilt */
+        bool structureDirty{true};
+    };
+}
+
 /**
 @brief Scene
 
@@ -46,13 +67,63 @@ e.g.:
 @snippet MagnumSceneGraph.cpp Object-typedef
 
 See @ref scenegraph for an introduction.
+
+@section SceneGraph-Scene-flat-transformation-cache Flat transformation cache
+
+By default, @ref transformations() and everything that's based on it (such as
+@ref Camera::draw()) walks the hierarchy up from each passed object on every
+call. For large scenes with many moving objects it's possible to enable a
+flat transformation cache using @ref setFlatTransformationCache(). The scene
+then keeps all its objects in a contiguous array sorted in depth-first order
+together with parent indices and absolute transformations. Changing object
+transformation marks its subtree for an update and the next call to
+@ref transformations() recalculates only the changed subtrees in a single
+linear pass. Changing the hierarchy (adding, removing or reparenting objects)
+causes the whole cache to be rebuilt on next use, so the cache is best suited
+for scenes with a mostly static hierarchy.
+
+@snippet MagnumSceneGraph.cpp Scene-setFlatTransformationCache
+
+@section SceneGraph-Scene-explicit-specializations Explicit template specializations
+
+The same specializations as listed in
+@ref SceneGraph-Object-explicit-specializations "Object" class documentation
+are explicitly compiled into the @ref SceneGraph library. For other
+specializations you have to use the @ref Object.hpp implementation file.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
     public:
         explicit Scene() = default;
 
+        ~Scene();
+
+        /**
+         * @brief Whether the flat transformation cache is enabled
+         *
+         * @see @ref setFlatTransformationCache()
+         */
+        bool hasFlatTransformationCache() const { return !!_flatTransformationCache; }
+
+        /**
+         * @brief Enable or disable the flat transformation cache
+         * @return Reference to self (for method chaining)
+         *
+         * Disabled by default. See
+         * @ref SceneGraph-Scene-flat-transformation-cache for more
+         * information.
+         */
+        Scene<Transformation>& setFlatTransformationCache(bool enabled);
+
     private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend Object<Transformation>;
+        #endif
+
         bool isScene() const override final { return true; }
+
+        void MAGNUM_SCENEGRAPH_LOCAL updateFlatTransformationCache();
+
+        std::unique_ptr<Implementation::FlatTransformationCache<Transformation>> _flatTransformationCache;
 };
 
 }}
@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void setClean();
+    void setCleanParallelOneThread();
+    void setCleanParallel();
+
+    private:
+        /* Marks the whole scene as dirty, included in the measurement */
+        void setDirty();
+
+        Scene3D _scene;
+        std::vector<std::reference_wrapper<Object3D>> _topLevelObjects;
+        std::vector<std::reference_wrapper<Object3D>> _objects;
+};
+
+/* 100 independent subtrees, each having 27 children with 36 children each,
+   resulting in 100k objects in total */
+constexpr std::size_t TopLevelCount = 100;
+constexpr std::size_t ChildCount = 27;
+constexpr std::size_t GrandchildCount = 36;
+
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Matrix4 cleanedAbsoluteTransformation;
+
+    private:
+        void clean(const Matrix4& absoluteTransformation) override {
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+};
+
+ObjectBenchmark::ObjectBenchmark() {
+    addBenchmarks({&ObjectBenchmark::setClean,
+                   &ObjectBenchmark::setCleanParallelOneThread,
+                   &ObjectBenchmark::setCleanParallel}, 5);
+
+    _objects.reserve(TopLevelCount*(1 + ChildCount*(1 + GrandchildCount)));
+    for(std::size_t i = 0; i != TopLevelCount; ++i) {
+        Object3D& topLevel = _scene.addChild<Object3D>();
+        topLevel.translate(Vector3::xAxis(Float(i)));
+        topLevel.addFeature<CachingFeature>();
+        _topLevelObjects.push_back(topLevel);
+        _objects.push_back(topLevel);
+
+        for(std::size_t j = 0; j != ChildCount; ++j) {
+            Object3D& child = topLevel.addChild<Object3D>();
+            child.rotateY(Deg(Float(j)));
+            child.addFeature<CachingFeature>();
+            _objects.push_back(child);
+
+            for(std::size_t k = 0; k != GrandchildCount; ++k) {
+                Object3D& grandchild = child.addChild<Object3D>();
+                grandchild.translate(Vector3::yAxis(Float(k)));
+                grandchild.addFeature<CachingFeature>();
+                _objects.push_back(grandchild);
+            }
+        }
+    }
+
+    CORRADE_COMPARE(_objects.size(), 100000);
+}
+
+void ObjectBenchmark::setDirty() {
+    for(Object3D& o: _topLevelObjects) o.setDirty();
+}
+
+void ObjectBenchmark::setClean() {
+    CORRADE_BENCHMARK(1) {
+        setDirty();
+        Object3D::setClean(_objects);
+    }
+
+    CORRADE_VERIFY(!_objects.back().get().isDirty());
+}
+
+void ObjectBenchmark::setCleanParallelOneThread() {
+    CORRADE_BENCHMARK(1) {
+        setDirty();
+        Object3D::setCleanParallel(_objects, 1);
+    }
+
+    CORRADE_VERIFY(!_objects.back().get().isDirty());
+}
+
+void ObjectBenchmark::setCleanParallel() {
+    CORRADE_BENCHMARK(1) {
+        setDirty();
+        Object3D::setCleanParallel(_objects);
+    }
+
+    CORRADE_VERIFY(!_objects.back().get().isDirty());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
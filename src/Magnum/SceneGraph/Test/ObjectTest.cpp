@@ -46,9 +46,13 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsLarge();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
+    void setCleanParallel();
+    void setCleanParallelOrder();
+    void setCleanParallelNotSameScene();
 
     void rangeBasedForChildren();
     void rangeBasedForFeatures();
@@ -83,9 +87,13 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsLarge,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
+              &ObjectTest::setCleanParallel,
+              &ObjectTest::setCleanParallelOrder,
+              &ObjectTest::setCleanParallelNotSameScene,
 
               &ObjectTest::rangeBasedForChildren,
               &ObjectTest::rangeBasedForFeatures});
@@ -309,6 +317,26 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsLarge() {
+    /* There used to be a limit of 65k objects */
+    Scene3D s;
+    Object3D first(&s);
+    first.translate(Vector3::yAxis(2.0f));
+    std::vector<std::unique_ptr<Object3D>> objects;
+    std::vector<std::reference_wrapper<Object3D>> objectReferences;
+    for(std::size_t i = 0; i != 70000; ++i) {
+        objects.emplace_back(new Object3D{&first});
+        objects.back()->translate(Vector3::xAxis(Float(i)));
+        objectReferences.push_back(*objects.back());
+    }
+
+    std::vector<Matrix4> transformations = s.transformations(objectReferences);
+    CORRADE_COMPARE(transformations.size(), 70000);
+    CORRADE_COMPARE(transformations[0], Matrix4::translation({0.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[65535], Matrix4::translation({65535.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation({69999.0f, 2.0f, 0.0f}));
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -489,6 +517,114 @@ void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
 }
 
+void ObjectTest::setCleanParallel() {
+    /* Verify it doesn't crash when passed empty list */
+    Object3D::setCleanParallel({});
+
+    Scene3D scene;
+    CachingObject a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    CachingObject b{&a};
+    b.scale(Vector3{2.0f});
+    CachingObject c{&b};
+    c.translate(Vector3::yAxis(3.0f));
+    CachingObject d{&scene};
+    d.rotateZ(Deg(90.0f));
+    CachingObject e{&d};
+    e.translate(Vector3::zAxis(-1.0f));
+    CachingObject f{&scene};
+    f.translate(Vector3::zAxis(5.0f));
+
+    /* Clean a part of the hierarchy first to verify clean parents in the
+       middle of the hierarchy are handled properly */
+    b.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+
+    /* Only the leafs are passed, dirty parents get cleaned too. Duplicates
+       shouldn't cause any problems. */
+    Object3D::setCleanParallel({c, e, c, f}, 4);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_VERIFY(!e.isDirty());
+    CORRADE_VERIFY(!f.isDirty());
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f})*Matrix4::translation(Vector3::yAxis(3.0f)));
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::rotationZ(Deg(90.0f)));
+    CORRADE_COMPARE(e.cleanedAbsoluteTransformation, Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::zAxis(-1.0f)));
+    CORRADE_COMPARE(f.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(5.0f)));
+
+    /* Change a subtree and clean everything again, the result should be the
+       same as from the serial version */
+    a.translate(Vector3::xAxis(1.0f));
+    d.rotateZ(Deg(90.0f));
+    Object3D::setCleanParallel({a, b, c, d, e, f});
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, b.absoluteTransformationMatrix());
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, c.absoluteTransformationMatrix());
+    CORRADE_COMPARE(e.cleanedAbsoluteTransformation, e.absoluteTransformationMatrix());
+    CORRADE_COMPARE(e.cleanedAbsoluteTransformation, Matrix4::rotationZ(Deg(180.0f))*Matrix4::translation(Vector3::zAxis(-1.0f)));
+}
+
+void ObjectTest::setCleanParallelOrder() {
+    class OrderFeature: public AbstractFeature3D {
+        public:
+            explicit OrderFeature(AbstractObject3D& object, std::vector<Int>& order, Int id): AbstractFeature3D{object}, _order(order), _id{id} {
+                setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+        private:
+            void clean(const Matrix4&) override {
+                _order.push_back(_id);
+            }
+
+            std::vector<Int>& _order;
+            Int _id;
+    };
+
+    /* Two identical scenes, one cleaned serially and one in parallel */
+    Scene3D serialScene, parallelScene;
+    std::vector<Int> serialOrder, parallelOrder;
+    std::vector<std::reference_wrapper<Object3D>> serialObjects, parallelObjects;
+    for(Int i = 0; i != 5; ++i) {
+        Object3D& serial = serialScene.addChild<Object3D>();
+        Object3D& parallel = parallelScene.addChild<Object3D>();
+        serial.addFeature<OrderFeature>(serialOrder, i*10);
+        parallel.addFeature<OrderFeature>(parallelOrder, i*10);
+
+        for(Int j = 1; j != 4; ++j) {
+            Object3D& serialChild = serial.addChild<Object3D>();
+            Object3D& parallelChild = parallel.addChild<Object3D>();
+            serialChild.addFeature<OrderFeature>(serialOrder, i*10 + j);
+            parallelChild.addFeature<OrderFeature>(parallelOrder, i*10 + j);
+            serialObjects.insert(serialObjects.begin(), serialChild);
+            parallelObjects.insert(parallelObjects.begin(), parallelChild);
+        }
+    }
+
+    Object3D::setClean(serialObjects);
+    Object3D::setCleanParallel(parallelObjects, 3);
+    CORRADE_COMPARE(parallelOrder.size(), 20);
+    CORRADE_COMPARE(parallelOrder, serialOrder);
+}
+
+void ObjectTest::setCleanParallelNotSameScene() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Object3D orphan;
+    Scene3D scene;
+    Object3D a{&scene};
+    Scene3D another;
+    Object3D b{&another};
+
+    Object3D::setCleanParallel({orphan});
+    Object3D::setCleanParallel({a, b});
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::setCleanParallel(): objects must be part of some scene\n"
+        "SceneGraph::Object::setCleanParallel(): the objects are not part of the same scene\n");
+}
+
 void ObjectTest::rangeBasedForChildren() {
     Scene3D scene;
     Object3D a(&scene);
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <memory>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
@@ -35,6 +37,12 @@ struct SceneTest: TestSuite::Tester {
 
     void transformation();
     void parent();
+
+    void flatTransformationCache();
+    void flatTransformationCacheHierarchyChange();
+    void flatTransformationCacheDestruction();
+    void flatTransformationCacheDisable();
+    void flatTransformationCacheOrphan();
 };
 
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
@@ -42,7 +50,13 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
 SceneTest::SceneTest() {
     addTests({&SceneTest::transformation,
-              &SceneTest::parent});
+              &SceneTest::parent,
+
+              &SceneTest::flatTransformationCache,
+              &SceneTest::flatTransformationCacheHierarchyChange,
+              &SceneTest::flatTransformationCacheDestruction,
+              &SceneTest::flatTransformationCacheDisable,
+              &SceneTest::flatTransformationCacheOrphan});
 }
 
 void SceneTest::transformation() {
@@ -65,6 +79,182 @@ void SceneTest::parent() {
     CORRADE_VERIFY(object.children().isEmpty());
 }
 
+void SceneTest::flatTransformationCache() {
+    Scene3D scene;
+    CORRADE_VERIFY(!scene.hasFlatTransformationCache());
+    scene.setFlatTransformationCache(true);
+    CORRADE_VERIFY(scene.hasFlatTransformationCache());
+
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    Object3D b{&a};
+    b.rotateZ(Deg(90.0f));
+    Object3D c{&b};
+    c.translate(Vector3::yAxis(2.0f));
+    Object3D d{&a};
+    d.scale(Vector3{3.0f});
+    Object3D e{&scene};
+    e.translate(Vector3::zAxis(-1.0f));
+
+    /* Initial population of the cache, premultiplied with initial
+       transformation */
+    const Matrix4 initial = Matrix4::translation(Vector3::zAxis(10.0f));
+    CORRADE_COMPARE(scene.transformations({c, scene, e, a, d, b, c}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(2.0f)),
+        initial,
+        initial*Matrix4::translation(Vector3::zAxis(-1.0f)),
+        initial*Matrix4::translation(Vector3::xAxis(1.0f)),
+        initial*Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{3.0f}),
+        initial*Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f)),
+        initial*Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(2.0f))
+    }));
+
+    /* Changing a transformation updates the whole subtree */
+    b.setTransformation(Matrix4::scaling(Vector3{0.5f}));
+    CORRADE_COMPARE(scene.transformations({c, b, d}), (std::vector<Matrix4>{
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{0.5f})*Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{0.5f}),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{3.0f})
+    }));
+
+    /* Nested and repeated changes */
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(-1.0f)));
+    c.translate(Vector3::yAxis(1.0f));
+    c.translate(Vector3::yAxis(1.0f));
+    e.setTransformation({});
+    CORRADE_COMPARE(scene.transformations({c, d, e}), (std::vector<Matrix4>{
+        Matrix4::translation(Vector3::xAxis(-1.0f))*Matrix4::scaling(Vector3{0.5f})*Matrix4::translation(Vector3::yAxis(4.0f)),
+        Matrix4::translation(Vector3::xAxis(-1.0f))*Matrix4::scaling(Vector3{3.0f}),
+        Matrix4{}
+    }));
+
+    /* The result should be the same as without the cache */
+    scene.setFlatTransformationCache(false);
+    CORRADE_COMPARE(scene.transformations({c, d, e}), (std::vector<Matrix4>{
+        Matrix4::translation(Vector3::xAxis(-1.0f))*Matrix4::scaling(Vector3{0.5f})*Matrix4::translation(Vector3::yAxis(4.0f)),
+        Matrix4::translation(Vector3::xAxis(-1.0f))*Matrix4::scaling(Vector3{3.0f}),
+        Matrix4{}
+    }));
+}
+
+void SceneTest::flatTransformationCacheHierarchyChange() {
+    Scene3D scene;
+    scene.setFlatTransformationCache(true);
+
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    Object3D b{&scene};
+    b.translate(Vector3::yAxis(2.0f));
+    Object3D c{&a};
+    c.translate(Vector3::zAxis(3.0f));
+    CORRADE_COMPARE(scene.transformations({c}), std::vector<Matrix4>{
+        Matrix4::translation({1.0f, 0.0f, 3.0f})
+    });
+
+    /* Reparenting */
+    c.setParent(&b);
+    CORRADE_COMPARE(scene.transformations({c}), std::vector<Matrix4>{
+        Matrix4::translation({0.0f, 2.0f, 3.0f})
+    });
+
+    /* Adding a new object */
+    Object3D d{&c};
+    d.translate(Vector3::xAxis(4.0f));
+    CORRADE_COMPARE(scene.transformations({d, a}), (std::vector<Matrix4>{
+        Matrix4::translation({4.0f, 2.0f, 3.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})
+    }));
+
+    /* Removing an object from the scene and changing it after */
+    d.setParent(nullptr);
+    d.translate(Vector3::xAxis(1.0f));
+    c.translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(scene.transformations({c}), std::vector<Matrix4>{
+        Matrix4::translation({1.0f, 2.0f, 3.0f})
+    });
+
+    /* Putting it back */
+    d.setParent(&a);
+    CORRADE_COMPARE(scene.transformations({d, c}), (std::vector<Matrix4>{
+        Matrix4::translation({6.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 3.0f})
+    }));
+}
+
+void SceneTest::flatTransformationCacheDestruction() {
+    Scene3D scene;
+    scene.setFlatTransformationCache(true);
+
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    std::unique_ptr<Object3D> b{new Object3D{&a}};
+    b->translate(Vector3::yAxis(2.0f));
+    Object3D* c = new Object3D{b.get()};
+    c->translate(Vector3::zAxis(3.0f));
+    Object3D d{&a};
+    d.translate(Vector3::zAxis(4.0f));
+    CORRADE_COMPARE(scene.transformations({*c, d}), (std::vector<Matrix4>{
+        Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        Matrix4::translation({1.0f, 0.0f, 4.0f})
+    }));
+
+    /* Deletes also c */
+    b = nullptr;
+    d.translate(Vector3::zAxis(1.0f));
+    CORRADE_COMPARE(scene.transformations({d, a}), (std::vector<Matrix4>{
+        Matrix4::translation({1.0f, 0.0f, 5.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})
+    }));
+
+    /* Destroying the scene with populated cache should be fine also */
+    Scene3D* another = new Scene3D;
+    another->setFlatTransformationCache(true);
+    (new Object3D{another})->addChild<Object3D>().translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(another->transformations({*another}), std::vector<Matrix4>{Matrix4{}});
+    delete another;
+}
+
+void SceneTest::flatTransformationCacheDisable() {
+    Scene3D scene;
+    scene.setFlatTransformationCache(true);
+
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(scene.transformations({a}), std::vector<Matrix4>{
+        Matrix4::translation(Vector3::xAxis(1.0f))
+    });
+
+    /* Changes done while disabled are picked up after enabling again */
+    scene.setFlatTransformationCache(false);
+    CORRADE_VERIFY(!scene.hasFlatTransformationCache());
+    a.translate(Vector3::xAxis(1.0f));
+    Object3D b{&a};
+    b.translate(Vector3::yAxis(1.0f));
+    scene.setFlatTransformationCache(true);
+    CORRADE_COMPARE(scene.transformations({b}), std::vector<Matrix4>{
+        Matrix4::translation({2.0f, 1.0f, 0.0f})
+    });
+}
+
+void SceneTest::flatTransformationCacheOrphan() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Scene3D scene;
+    scene.setFlatTransformationCache(true);
+    Scene3D another;
+    another.setFlatTransformationCache(true);
+    Object3D orphan;
+    Object3D foreign{&another};
+    CORRADE_COMPARE(another.transformations({foreign}), std::vector<Matrix4>{Matrix4{}});
+
+    CORRADE_COMPARE(scene.transformations({orphan}), std::vector<Matrix4>());
+    CORRADE_COMPARE(scene.transformations({foreign}), std::vector<Matrix4>());
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::transformations(): the objects are not part of the same tree\n"
+        "SceneGraph::Object::transformations(): the objects are not part of the same tree\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SceneTest)
@@ -81,6 +81,18 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicTranslationRotationScali
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicTranslationRotationScalingTransformation3D<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<2, Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<3, Float>>;
+
+/* Scene has no extern template declarations, so it's exported directly */
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicDualComplexTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicRigidMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicRigidMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicTranslationRotationScalingTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<BasicTranslationRotationScalingTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<TranslationTransformation<2, Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT Scene<TranslationTransformation<3, Float>>;
 #endif
 
 }}
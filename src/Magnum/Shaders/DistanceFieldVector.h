@@ -29,7 +29,10 @@
  * @brief Class @ref Magnum::Shaders::DistanceFieldVector, typedef @ref Magnum::Shaders::DistanceFieldVector2D, @ref Magnum::Shaders::DistanceFieldVector3D
  */
 
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -70,8 +73,35 @@ Common rendering setup:
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector: public AbstractVector<dimensions> {
     public:
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         *
+         * Compared to @ref DistanceFieldVector() only submits the shader for
+         * compilation and linking without waiting for the result. Poll @ref
+         * isLinkFinished() on the returned state and then pass it to @ref
+         * DistanceFieldVector(CompileState&&). See @ref shaders-async for more
+         * information.
+         */
+        static CompileState compile();
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to calling @ref DistanceFieldVector(CompileState&&) with
+         * the result of @ref compile().
+         */
         explicit DistanceFieldVector();
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit DistanceFieldVector(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -183,6 +213,10 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector
         #endif
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit DistanceFieldVector(Containers::NoInitT) {}
+
         Int _transformationProjectionMatrixUniform{0},
             _colorUniform{1},
             _outlineColorUniform{2},
@@ -190,6 +224,23 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector
             _smoothnessUniform{4};
 };
 
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref DistanceFieldVector::compile(), see @ref shaders-async for
+more information.
+*/
+template<UnsignedInt dimensions> class DistanceFieldVector<dimensions>::CompileState: public DistanceFieldVector<dimensions> {
+    /* Everything deliberately private except for the inheritance */
+    friend DistanceFieldVector;
+
+    explicit CompileState(DistanceFieldVector<dimensions>&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version, std::string&& cacheKey): DistanceFieldVector<dimensions>{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)}, _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    GL::Version _version;
+    std::string _cacheKey;
+};
+
 /** @brief Two-dimensional distance field vector shader */
 typedef DistanceFieldVector<2> DistanceFieldVector2D;
 
@@ -31,6 +31,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
 #include "Magnum/GL/Texture.h"
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
@@ -45,7 +46,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "Flat3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _flags(flags) {
+template<UnsignedInt dimensions> typename Flat<dimensions>::CompileState Flat<dimensions>::compile(const Flags flags) {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -63,15 +64,29 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _fla
     GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
 
     vert.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        #endif
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
         .addSource(flags & Flag::AlphaMask ? "#define ALPHA_MASK\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
         .addSource(rs.get("Flat.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+    Flat<dimensions> out{Containers::NoInit};
+    out._flags = flags;
 
-    attachShaders({vert, frag});
+    std::string cacheKey;
+    if(GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey))
+        return CompileState{std::move(out), GL::Shader{NoCreate}, GL::Shader{NoCreate}, version, {}};
+
+    /* Only submit the compilation and linking, the status is checked in the
+       constructor */
+    GL::Shader::submitCompile({vert, frag});
+
+    out.attachShaders({vert, frag});
 
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
@@ -79,33 +94,52 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _fla
     if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
-        if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        out.bindAttributeLocation(Position::Location, "position");
+        if(flags & Flag::Textured) out.bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        if(flags & Flag::VertexColor) out.bindAttributeLocation(Color4::Location, "vertexColor");
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::InstancedTransformation) out.bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+        #endif
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    out.submitLink();
+
+    return CompileState{std::move(out), std::move(vert), std::move(frag), version, std::move(cacheKey)};
+}
+
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): Flat{compile(flags)} {}
+
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(CompileState&& state): Flat{static_cast<Flat<dimensions>&&>(std::move(state))} {
+    /* If not loaded from a cache, check the result and save the binary */
+    if(state._vert.id()) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, state._frag}));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink());
+
+        GL::ShaderProgramCache::saveCurrent(*this, state._cacheKey);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
+    const GL::Version version = state._version;
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
     #endif
     {
         _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
         _colorUniform = uniformLocation("color");
-        if(flags & Flag::AlphaMask) _alphaMaskUniform = uniformLocation("alphaMask");
+        if(_flags & Flag::AlphaMask) _alphaMaskUniform = uniformLocation("alphaMask");
     }
 
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
     #endif
     {
-        if(flags & Flag::Textured) setUniform(uniformLocation("textureData"), TextureLayer);
+        if(_flags & Flag::Textured) setUniform(uniformLocation("textureData"), TextureLayer);
     }
 
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
     setTransformationProjectionMatrix({});
-    setColor(Color4{1.0f});
-    if(flags & Flag::AlphaMask) setAlphaMask(0.5f);
+    setColor(Magnum::Color4{1.0f});
+    if(_flags & Flag::AlphaMask) setAlphaMask(0.5f);
     #endif
 }
 
@@ -134,6 +168,10 @@ Debug& operator<<(Debug& debug, const FlatFlag value) {
         #define _c(v) case FlatFlag::v: return debug << "Shaders::Flat::Flag::" #v;
         _c(Textured)
         _c(AlphaMask)
+        _c(VertexColor)
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(InstancedTransformation)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -144,7 +182,12 @@ Debug& operator<<(Debug& debug, const FlatFlag value) {
 Debug& operator<<(Debug& debug, const FlatFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::Flat::Flags{}", {
         FlatFlag::Textured,
-        FlatFlag::AlphaMask});
+        FlatFlag::AlphaMask,
+        FlatFlag::VertexColor,
+        #ifndef MAGNUM_TARGET_GLES2
+        FlatFlag::InstancedTransformation
+        #endif
+        });
 }
 
 }
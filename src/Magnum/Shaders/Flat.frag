@@ -60,6 +60,10 @@ uniform lowp float alphaMask
 in mediump vec2 interpolatedTextureCoordinates;
 #endif
 
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
+
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
@@ -69,6 +73,9 @@ void main() {
         #ifdef TEXTURED
         texture(textureData, interpolatedTextureCoordinates)*
         #endif
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
         color;
 
     #ifdef ALPHA_MASK
@@ -29,8 +29,11 @@
  * @brief Class @ref Magnum::Shaders::Flat, typedef @ref Magnum::Shaders::Flat2D, @ref Magnum::Shaders::Flat3D
  */
 
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -42,7 +45,11 @@ namespace Magnum { namespace Shaders {
 namespace Implementation {
     enum class FlatFlag: UnsignedByte {
         Textured = 1 << 0,
-        AlphaMask = 1 << 1
+        AlphaMask = 1 << 1,
+        VertexColor = 1 << 2,
+        #ifndef MAGNUM_TARGET_GLES2
+        InstancedTransformation = 1 << 3
+        #endif
     };
     typedef Containers::EnumSet<FlatFlag> FlatFlags;
 }
@@ -87,6 +94,17 @@ Common rendering setup:
 
 @snippet MagnumShaders.cpp Flat-usage-textured2
 
+@subsection Shaders-Flat-usage-instancing Instanced rendering
+
+Enabling @ref Flag::InstancedTransformation will make the shader accept a
+per-instance transformation in the @ref TransformationMatrix attribute, which
+is applied before the matrix set in @ref setTransformationProjectionMatrix().
+Together with @ref Flag::VertexColor and a @ref Color4 attribute added with a
+non-zero divisor it's possible to draw many differently placed and colored
+copies of a mesh in a single draw call:
+
+@snippet MagnumShaders.cpp Flat-usage-instancing
+
 @subsection Shaders-Flat-usage-alpha Alpha blending and masking
 
 Enable @ref Flag::AlphaMask and tune @ref setAlphaMask() for simple
@@ -118,6 +136,37 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Three-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color3. Use
+         * either this or the @ref Color4 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color3 Color3;
+
+        /**
+         * @brief Four-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4. Use
+         * either this or the @ref Color3 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color4 Color4;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Instanced transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Matrix3 "Matrix3" in 2D, @ref Magnum::Matrix4 "Matrix4"
+         * in 3D. Used only if @ref Flag::InstancedTransformation is set.
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_webgl20 Not available in WebGL 1.0.
+         */
+        typedef typename Generic<dimensions>::TransformationMatrix TransformationMatrix;
+        #endif
+
         #ifdef DOXYGEN_GENERATING_OUTPUT
         /**
          * @brief Flag
@@ -142,7 +191,29 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
              * with proper depth sorting and blending you'll usually get much
              * better performance and output quality.
              */
-            AlphaMask = 1 << 1
+            AlphaMask = 1 << 1,
+
+            /**
+             * Multiply color with a per-vertex color coming from the
+             * @ref Color3 or @ref Color4 attribute. If the attribute is added
+             * with @ref GL::Mesh::addVertexBufferInstanced(), the color is
+             * per-instance instead.
+             * @see @ref setColor()
+             */
+            VertexColor = 1 << 2,
+
+            /**
+             * Transform each instance with a matrix coming from the
+             * @ref TransformationMatrix attribute. The matrix is applied
+             * before the matrix set in
+             * @ref setTransformationProjectionMatrix(). See
+             * @ref Shaders-Flat-usage-instancing for more information.
+             * @requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+             *      for drawing the instances.
+             * @requires_gles30 Not available in OpenGL ES 2.0.
+             * @requires_webgl20 Not available in WebGL 1.0.
+             */
+            InstancedTransformation = 1 << 3
         };
 
         /**
@@ -158,12 +229,37 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
         typedef Implementation::FlatFlags Flags;
         #endif
 
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         * @param flags     Flags
+         *
+         * Compared to @ref Flat(Flags) only submits the shader for compilation
+         * and linking without waiting for the result. Poll
+         * @ref isLinkFinished() on the returned state and then pass it to
+         * @ref Flat(CompileState&&). See @ref shaders-async for more
+         * information.
+         */
+        static CompileState compile(Flags flags = {});
+
         /**
          * @brief Constructor
          * @param flags     Flags
+         *
+         * Equivalent to calling @ref Flat(CompileState&&) with the result of
+         * @ref compile().
          */
         explicit Flat(Flags flags = {});
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit Flat(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -195,7 +291,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          * @brief Set transformation and projection matrix
          * @return Reference to self (for method chaining)
          *
-         * Initial value is an identity matrix.
+         * Initial value is an identity matrix. If
+         * @ref Flag::InstancedTransformation is set, the per-instance
+         * transformation is applied first.
          */
         Flat<dimensions>& setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix) {
             setUniform(_transformationProjectionMatrixUniform, matrix);
@@ -208,10 +306,11 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          *
          * If @ref Flag::Textured is set, initial value is
          * @cpp 0xffffffff_rgbaf @ce and the color will be multiplied with
-         * texture.
+         * texture. If @ref Flag::VertexColor is set, the color is multiplied
+         * with the per-vertex color.
          * @see @ref bindTexture()
          */
-        Flat<dimensions>& setColor(const Color4& color){
+        Flat<dimensions>& setColor(const Magnum::Color4& color){
             setUniform(_colorUniform, color);
             return *this;
         }
@@ -247,12 +346,32 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
         #endif
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit Flat(Containers::NoInitT) {}
+
         Flags _flags;
         Int _transformationProjectionMatrixUniform{0},
             _colorUniform{1},
             _alphaMaskUniform{2};
 };
 
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref Flat::compile(), see @ref shaders-async for more information.
+*/
+template<UnsignedInt dimensions> class Flat<dimensions>::CompileState: public Flat<dimensions> {
+    /* Everything deliberately private except for the inheritance */
+    friend Flat;
+
+    explicit CompileState(Flat<dimensions>&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version, std::string&& cacheKey): Flat<dimensions>{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)}, _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    GL::Version _version;
+    std::string _cacheKey;
+};
+
 /** @brief 2D flat shader */
 typedef Flat<2> Flat2D;
 
@@ -81,6 +81,20 @@ template<UnsignedInt dimensions> struct Generic {
      */
     typedef GL::Attribute<3, Magnum::Color4> Color4;
 
+    /**
+     * @brief Instanced transformation matrix
+     *
+     * @ref Magnum::Matrix3 "Matrix3" in 2D and @ref Magnum::Matrix4 "Matrix4"
+     * in 3D. Occupies three or four consecutive locations, starting at
+     * location @cpp 8 @ce. Meant to be used with
+     * @ref GL::Mesh::addVertexBufferInstanced().
+     * @requires_gles30 Not defined in OpenGL ES 2.0 builds, as ES 2.0
+     *      guarantees only eight vertex attributes.
+     * @requires_webgl20 Not defined in WebGL 1.0 builds, as WebGL 1.0
+     *      guarantees only eight vertex attributes.
+     */
+    typedef GL::Attribute<8, T> TransformationMatrix;
+
     #ifdef MAGNUM_BUILD_DEPRECATED
     /**
      * @brief Vertex color
@@ -129,11 +143,17 @@ struct BaseGeneric {
 
 template<> struct Generic<2>: BaseGeneric {
     typedef GL::Attribute<0, Vector2> Position;
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef GL::Attribute<8, Matrix3> TransformationMatrix;
+    #endif
 };
 
 template<> struct Generic<3>: BaseGeneric {
     typedef GL::Attribute<0, Vector3> Position;
     typedef GL::Attribute<2, Vector3> Normal;
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef GL::Attribute<8, Matrix4> TransformationMatrix;
+    #endif
 };
 #endif
 
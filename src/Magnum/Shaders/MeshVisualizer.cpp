@@ -32,12 +32,13 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
 
 namespace Magnum { namespace Shaders {
 
-MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
+MeshVisualizer::CompileState MeshVisualizer::compile(const Flags flags) {
     #ifndef MAGNUM_TARGET_GLES2
     if(flags & Flag::Wireframe && !(flags & Flag::NoGeometryShader)) {
         #ifndef MAGNUM_TARGET_GLES
@@ -48,7 +49,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
         #endif
     }
     #else
-    if(_flags & Flag::Wireframe)
+    if(flags & Flag::Wireframe)
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::OES::standard_derivatives);
     #endif
 
@@ -94,15 +95,35 @@ MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
     }
     #endif
 
+    MeshVisualizer out{Containers::NoInit};
+    out._flags = flags;
+
+    std::string cacheKey;
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
-    if(geom) CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, *geom, frag}));
+    const bool cached = geom ?
+        GL::ShaderProgramCache::loadCurrent(out, {vert, *geom, frag}, cacheKey) :
+        GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey);
+    #else
+    const bool cached = GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey);
+    #endif
+    if(cached) return CompileState{std::move(out),
+        GL::Shader{NoCreate}, GL::Shader{NoCreate},
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        Containers::NullOpt,
+        #endif
+        version, {}};
+
+    /* Only submit the compilation and linking, the status is checked in the
+       constructor */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(geom) GL::Shader::submitCompile({vert, *geom, frag});
     else
     #endif
-        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+        GL::Shader::submitCompile({vert, frag});
 
-    attachShaders({vert, frag});
+    out.attachShaders({vert, frag});
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
-    if(geom) attachShader(*geom);
+    if(geom) out.attachShader(*geom);
     #endif
 
     #ifndef MAGNUM_TARGET_GLES
@@ -111,31 +132,53 @@ MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
     if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
+        out.bindAttributeLocation(Position::Location, "position");
 
         #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
         #ifndef MAGNUM_TARGET_GLES
         if(!GL::Context::current().isVersionSupported(GL::Version::GL310))
         #endif
         {
-            bindAttributeLocation(VertexIndex::Location, "vertexIndex");
+            out.bindAttributeLocation(VertexIndex::Location, "vertexIndex");
         }
         #endif
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    out.submitLink();
+
+    return CompileState{std::move(out), std::move(vert), std::move(frag),
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        std::move(geom),
+        #endif
+        version, std::move(cacheKey)};
+}
+
+MeshVisualizer::MeshVisualizer(const Flags flags): MeshVisualizer{compile(flags)} {}
+
+MeshVisualizer::MeshVisualizer(CompileState&& state): MeshVisualizer{static_cast<MeshVisualizer&&>(std::move(state))} {
+    /* If not loaded from a cache, check the result and save the binary */
+    if(state._vert.id()) {
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(state._geom) CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, *state._geom, state._frag}));
+        else
+        #endif
+            CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, state._frag}));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink());
+
+        GL::ShaderProgramCache::saveCurrent(*this, state._cacheKey);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(state._version))
     #endif
     {
         _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
         _colorUniform = uniformLocation("color");
-        if(flags & Flag::Wireframe) {
+        if(_flags & Flag::Wireframe) {
             _wireframeColorUniform = uniformLocation("wireframeColor");
             _wireframeWidthUniform = uniformLocation("wireframeWidth");
             _smoothnessUniform = uniformLocation("smoothness");
-            if(!(flags & Flag::NoGeometryShader))
+            if(!(_flags & Flag::NoGeometryShader))
                 _viewportSizeUniform = uniformLocation("viewportSize");
         }
     }
@@ -29,7 +29,11 @@
  * @brief Class @ref Magnum::Shaders::MeshVisualizer
  */
 
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/visibility.h"
@@ -155,12 +159,37 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public GL::AbstractShaderProgram {
         /** @brief Flags */
         typedef Containers::EnumSet<Flag> Flags;
 
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         * @param flags     Flags
+         *
+         * Compared to @ref MeshVisualizer(Flags) only submits the shader for
+         * compilation and linking without waiting for the result. Poll
+         * @ref isLinkFinished() on the returned state and then pass it to
+         * @ref MeshVisualizer(CompileState&&). See @ref shaders-async for
+         * more information.
+         */
+        static CompileState compile(Flags flags = {});
+
         /**
          * @brief Constructor
          * @param flags     Flags
+         *
+         * Equivalent to calling @ref MeshVisualizer(CompileState&&) with the
+         * result of @ref compile().
          */
         explicit MeshVisualizer(Flags flags = {});
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit MeshVisualizer(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -257,6 +286,10 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public GL::AbstractShaderProgram {
         MeshVisualizer& setSmoothness(Float smoothness);
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit MeshVisualizer(Containers::NoInitT) {}
+
         Flags _flags;
         Int _transformationProjectionMatrixUniform{0},
             _viewportSizeUniform{1},
@@ -266,6 +299,34 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public GL::AbstractShaderProgram {
             _smoothnessUniform{5};
 };
 
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref MeshVisualizer::compile(), see @ref shaders-async for more
+information.
+*/
+class MeshVisualizer::CompileState: public MeshVisualizer {
+    /* Everything deliberately private except for the inheritance */
+    friend MeshVisualizer;
+
+    explicit CompileState(MeshVisualizer&& shader, GL::Shader&& vert, GL::Shader&& frag,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        Containers::Optional<GL::Shader>&& geom,
+        #endif
+        GL::Version version, std::string&& cacheKey): MeshVisualizer{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)},
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        _geom{std::move(geom)},
+        #endif
+        _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    Containers::Optional<GL::Shader> _geom;
+    #endif
+    GL::Version _version;
+    std::string _cacheKey;
+};
+
 /** @debugoperatorclassenum{MeshVisualizer,MeshVisualizer::Flag} */
 MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, MeshVisualizer::Flag value);
 
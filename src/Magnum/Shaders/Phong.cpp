@@ -35,6 +35,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
 #include "Magnum/GL/Texture.h"
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
@@ -49,7 +50,7 @@ namespace {
     };
 }
 
-Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _lightCount{lightCount}, _lightColorsUniform{9 + Int(lightCount)} {
+Phong::CompileState Phong::compile(const Flags flags, const UnsignedInt lightCount) {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -102,9 +103,20 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
         #endif
         .addSource(rs.get("Phong.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+    Phong out{Containers::NoInit};
+    out._flags = flags;
+    out._lightCount = lightCount;
+    out._lightColorsUniform = 9 + Int(lightCount);
 
-    attachShaders({vert, frag});
+    std::string cacheKey;
+    if(GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey))
+        return CompileState{std::move(out), GL::Shader{NoCreate}, GL::Shader{NoCreate}, version, {}};
+
+    /* Only submit the compilation and linking, the status is checked in the
+       constructor */
+    GL::Shader::submitCompile({vert, frag});
+
+    out.attachShaders({vert, frag});
 
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
@@ -112,16 +124,30 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
     if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
-        bindAttributeLocation(Normal::Location, "normal");
+        out.bindAttributeLocation(Position::Location, "position");
+        out.bindAttributeLocation(Normal::Location, "normal");
         if(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture))
-            bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+            out.bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    out.submitLink();
+
+    return CompileState{std::move(out), std::move(vert), std::move(frag), version, std::move(cacheKey)};
+}
+
+Phong::Phong(const Flags flags, const UnsignedInt lightCount): Phong{compile(flags, lightCount)} {}
+
+Phong::Phong(CompileState&& state): Phong{static_cast<Phong&&>(std::move(state))} {
+    /* If not loaded from a cache, check the result and save the binary */
+    if(state._vert.id()) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, state._frag}));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink());
+
+        GL::ShaderProgramCache::saveCurrent(*this, state._cacheKey);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(state._version))
     #endif
     {
         _transformationMatrixUniform = uniformLocation("transformationMatrix");
@@ -131,30 +157,30 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
         _diffuseColorUniform = uniformLocation("diffuseColor");
         _specularColorUniform = uniformLocation("specularColor");
         _shininessUniform = uniformLocation("shininess");
-        if(flags & Flag::AlphaMask) _alphaMaskUniform = uniformLocation("alphaMask");
+        if(_flags & Flag::AlphaMask) _alphaMaskUniform = uniformLocation("alphaMask");
         _lightPositionsUniform = uniformLocation("lightPositions");
         _lightColorsUniform = uniformLocation("lightColors");
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    if(_flags && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(state._version))
     #endif
     {
-        if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
-        if(flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"), DiffuseTextureLayer);
-        if(flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"), SpecularTextureLayer);
+        if(_flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
+        if(_flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"), DiffuseTextureLayer);
+        if(_flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"), SpecularTextureLayer);
     }
 
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
     /* Default to fully opaque white so we can see the textures */
-    if(flags & Flag::AmbientTexture) setAmbientColor(Color4{1.0f});
+    if(_flags & Flag::AmbientTexture) setAmbientColor(Color4{1.0f});
     else setAmbientColor(Color4{0.0f});
     setDiffuseColor(Color4{1.0f});
     setSpecularColor(Color4{1.0f});
     setShininess(80.0f);
-    if(flags & Flag::AlphaMask) setAlphaMask(0.5f);
-    setLightColors(Containers::Array<Color4>{Containers::DirectInit, lightCount, Color4{1.0f}});
+    if(_flags & Flag::AlphaMask) setAlphaMask(0.5f);
+    setLightColors(Containers::Array<Color4>{Containers::DirectInit, _lightCount, Color4{1.0f}});
 
     setTransformationMatrix({});
     setProjectionMatrix({});
@@ -29,7 +29,10 @@
  * @brief Class @ref Magnum::Shaders::Phong
  */
 
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/Generic.h"
@@ -170,13 +173,39 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          */
         typedef Containers::EnumSet<Flag> Flags;
 
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         * @param flags         Flags
+         * @param lightCount    Count of light sources
+         *
+         * Compared to @ref Phong(Flags, UnsignedInt) only submits the shader
+         * for compilation and linking without waiting for the result. Poll
+         * @ref isLinkFinished() on the returned state and then pass it to
+         * @ref Phong(CompileState&&). See @ref shaders-async for more
+         * information.
+         */
+        static CompileState compile(Flags flags = {}, UnsignedInt lightCount = 1);
+
         /**
          * @brief Constructor
          * @param flags         Flags
          * @param lightCount    Count of light sources
+         *
+         * Equivalent to calling @ref Phong(CompileState&&) with the result of
+         * @ref compile().
          */
         explicit Phong(Flags flags = {}, UnsignedInt lightCount = 1);
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit Phong(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -468,6 +497,10 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
         }
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit Phong(Containers::NoInitT) {}
+
         Flags _flags;
         UnsignedInt _lightCount;
         Int _transformationMatrixUniform{0},
@@ -479,7 +512,23 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
             _shininessUniform{7},
             _alphaMaskUniform{8},
             _lightPositionsUniform{9},
-            _lightColorsUniform; /* 9 + lightCount, set in the constructor */
+            _lightColorsUniform; /* 9 + lightCount, set in compile() */
+};
+
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref Phong::compile(), see @ref shaders-async for more information.
+*/
+class Phong::CompileState: public Phong {
+    /* Everything deliberately private except for the inheritance */
+    friend Phong;
+
+    explicit CompileState(Phong&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version, std::string&& cacheKey): Phong{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)}, _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    GL::Version _version;
+    std::string _cacheKey;
 };
 
 /** @debugoperatorclassenum{Phong,Phong::Flag} */
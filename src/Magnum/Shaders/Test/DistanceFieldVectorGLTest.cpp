@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Utility/System.h>
+
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/Shaders/DistanceFieldVector.h"
 
@@ -33,6 +35,8 @@ struct DistanceFieldVectorGLTest: GL::OpenGLTester {
 
     void construct2D();
     void construct3D();
+    void constructAsync2D();
+    void constructAsync3D();
 
     void constructMove2D();
     void constructMove3D();
@@ -41,6 +45,8 @@ struct DistanceFieldVectorGLTest: GL::OpenGLTester {
 DistanceFieldVectorGLTest::DistanceFieldVectorGLTest() {
     addTests({&DistanceFieldVectorGLTest::construct2D,
               &DistanceFieldVectorGLTest::construct3D,
+              &DistanceFieldVectorGLTest::constructAsync2D,
+              &DistanceFieldVectorGLTest::constructAsync3D,
 
               &DistanceFieldVectorGLTest::constructMove2D,
               &DistanceFieldVectorGLTest::constructMove3D});
@@ -68,6 +74,40 @@ void DistanceFieldVectorGLTest::construct3D() {
     }
 }
 
+void DistanceFieldVectorGLTest::constructAsync2D() {
+    DistanceFieldVector2D::CompileState state = DistanceFieldVector2D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    DistanceFieldVector2D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void DistanceFieldVectorGLTest::constructAsync3D() {
+    DistanceFieldVector3D::CompileState state = DistanceFieldVector3D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    DistanceFieldVector3D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void DistanceFieldVectorGLTest::constructMove2D() {
     DistanceFieldVector2D a;
     const GLuint id = a.id();
@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/System.h>
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
@@ -39,6 +40,7 @@ struct FlatGLTest: GL::OpenGLTester {
     explicit FlatGLTest();
 
     template<UnsignedInt dimensions> void construct();
+    template<UnsignedInt dimensions> void constructAsync();
 
     template<UnsignedInt dimensions> void constructMove();
 
@@ -54,13 +56,20 @@ constexpr struct {
     Flat2D::Flags flags;
 } ConstructData[]{
     {"", {}},
-    {"textured", Flat2D::Flag::Textured}
+    {"textured", Flat2D::Flag::Textured},
+    {"vertex color", Flat2D::Flag::VertexColor},
+    #ifndef MAGNUM_TARGET_GLES2
+    {"instanced transformation", Flat2D::Flag::InstancedTransformation},
+    {"vertex color + instanced transformation", Flat2D::Flag::VertexColor|Flat2D::Flag::InstancedTransformation}
+    #endif
 };
 
 FlatGLTest::FlatGLTest() {
     addInstancedTests<FlatGLTest>({
         &FlatGLTest::construct<2>,
-        &FlatGLTest::construct<3>},
+        &FlatGLTest::construct<3>,
+        &FlatGLTest::constructAsync<2>,
+        &FlatGLTest::constructAsync<3>},
         Containers::arraySize(ConstructData));
 
     addTests<FlatGLTest>({
@@ -95,6 +104,31 @@ template<UnsignedInt dimensions> void FlatGLTest::construct() {
     }
 }
 
+template<UnsignedInt dimensions> void FlatGLTest::constructAsync() {
+    setTestCaseName(Utility::formatString("constructAsync<{}>", dimensions));
+
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    typename Flat<dimensions>::CompileState state = Flat<dimensions>::compile(data.flags);
+    CORRADE_COMPARE(state.flags(), data.flags);
+
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    Flat<dimensions> shader{std::move(state)};
+    CORRADE_COMPARE(shader.flags(), data.flags);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 template<UnsignedInt dimensions> void FlatGLTest::constructMove() {
     setTestCaseName(Utility::formatString("constructMove<{}>", dimensions));
 
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Utility/System.h>
+
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
@@ -38,6 +40,7 @@ struct MeshVisualizerGLTest: GL::OpenGLTester {
     void constructWireframeGeometryShader();
     #endif
     void constructWireframeNoGeometryShader();
+    void constructAsync();
 
     void constructMove();
 };
@@ -48,6 +51,7 @@ MeshVisualizerGLTest::MeshVisualizerGLTest() {
               &MeshVisualizerGLTest::constructWireframeGeometryShader,
               #endif
               &MeshVisualizerGLTest::constructWireframeNoGeometryShader,
+              &MeshVisualizerGLTest::constructAsync,
 
               &MeshVisualizerGLTest::constructMove});
 }
@@ -103,6 +107,26 @@ void MeshVisualizerGLTest::constructWireframeNoGeometryShader() {
     }
 }
 
+void MeshVisualizerGLTest::constructAsync() {
+    MeshVisualizer::CompileState state = MeshVisualizer::compile(MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader);
+    CORRADE_COMPARE(state.flags(), MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader);
+
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    MeshVisualizer shader{std::move(state)};
+    CORRADE_COMPARE(shader.flags(), MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void MeshVisualizerGLTest::constructMove() {
     MeshVisualizer a{MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader};
     const GLuint id = a.id();
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Utility/System.h>
+
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/Shaders/Vector.h"
 
@@ -33,6 +35,8 @@ struct VectorGLTest: GL::OpenGLTester {
 
     void construct2D();
     void construct3D();
+    void constructAsync2D();
+    void constructAsync3D();
 
     void constructMove2D();
     void constructMove3D();
@@ -41,6 +45,8 @@ struct VectorGLTest: GL::OpenGLTester {
 VectorGLTest::VectorGLTest() {
     addTests({&VectorGLTest::construct2D,
               &VectorGLTest::construct3D,
+              &VectorGLTest::constructAsync2D,
+              &VectorGLTest::constructAsync3D,
 
               &VectorGLTest::constructMove2D,
               &VectorGLTest::constructMove3D});
@@ -68,6 +74,40 @@ void VectorGLTest::construct3D() {
     }
 }
 
+void VectorGLTest::constructAsync2D() {
+    Vector2D::CompileState state = Vector2D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    Vector2D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void VectorGLTest::constructAsync3D() {
+    Vector3D::CompileState state = Vector3D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    Vector3D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void VectorGLTest::constructMove2D() {
     Vector2D a;
     const GLuint id = a.id();
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Utility/System.h>
+
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/Shaders/VertexColor.h"
 
@@ -33,6 +35,8 @@ struct VertexColorGLTest: GL::OpenGLTester {
 
     void construct2D();
     void construct3D();
+    void constructAsync2D();
+    void constructAsync3D();
 
     void constructMove2D();
     void constructMove3D();
@@ -41,6 +45,8 @@ struct VertexColorGLTest: GL::OpenGLTester {
 VertexColorGLTest::VertexColorGLTest() {
     addTests({&VertexColorGLTest::construct2D,
               &VertexColorGLTest::construct3D,
+              &VertexColorGLTest::constructAsync2D,
+              &VertexColorGLTest::constructAsync3D,
 
               &VertexColorGLTest::constructMove2D,
               &VertexColorGLTest::constructMove3D});
@@ -68,6 +74,40 @@ void VertexColorGLTest::construct3D() {
     }
 }
 
+void VertexColorGLTest::constructAsync2D() {
+    VertexColor2D::CompileState state = VertexColor2D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    VertexColor2D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void VertexColorGLTest::constructAsync3D() {
+    VertexColor3D::CompileState state = VertexColor3D::compile();
+    while(!state.isLinkFinished())
+        Utility::System::sleep(1);
+
+    VertexColor3D shader{std::move(state)};
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void VertexColorGLTest::constructMove2D() {
     VertexColor2D a;
     const GLuint id = a.id();
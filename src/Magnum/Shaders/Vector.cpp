@@ -30,6 +30,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
 
@@ -41,7 +42,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
+template<UnsignedInt dimensions> typename Vector<dimensions>::CompileState Vector<dimensions>::compile() {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -62,9 +63,17 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(rs.get("Vector.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+    Vector<dimensions> out{Containers::NoInit};
 
-    GL::AbstractShaderProgram::attachShaders({vert,  frag});
+    std::string cacheKey;
+    if(GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey))
+        return CompileState{std::move(out), GL::Shader{NoCreate}, GL::Shader{NoCreate}, version, {}};
+
+    /* Only submit the compilation and linking, the status is checked in the
+       constructor */
+    GL::Shader::submitCompile({vert, frag});
+
+    out.attachShaders({vert, frag});
 
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
@@ -72,14 +81,28 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
     if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
     #endif
     {
-        GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
-        GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        out.bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
+        out.bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::AbstractShaderProgram::link());
+    out.submitLink();
+
+    return CompileState{std::move(out), std::move(vert), std::move(frag), version, std::move(cacheKey)};
+}
+
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(): Vector{compile()} {}
+
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(CompileState&& state): Vector{static_cast<Vector<dimensions>&&>(std::move(state))} {
+    /* If not loaded from a cache, check the result and save the binary */
+    if(state._vert.id()) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, state._frag}));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::AbstractShaderProgram::checkLink());
+
+        GL::ShaderProgramCache::saveCurrent(*this, state._cacheKey);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(state._version))
     #endif
     {
         _transformationProjectionMatrixUniform = GL::AbstractShaderProgram::uniformLocation("transformationProjectionMatrix");
@@ -88,7 +111,7 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(state._version))
     #endif
     {
         GL::AbstractShaderProgram::setUniform(GL::AbstractShaderProgram::uniformLocation("vectorTexture"), AbstractVector<dimensions>::VectorTextureLayer);
@@ -29,7 +29,10 @@
  * @brief Class @ref Magnum::Shaders::Vector, typedef @ref Magnum::Shaders::Vector2D, @ref Magnum::Shaders::Vector3D
  */
 
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -66,8 +69,34 @@ Common rendering setup:
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         *
+         * Compared to @ref Vector() only submits the shader for compilation and
+         * linking without waiting for the result. Poll @ref isLinkFinished() on
+         * the returned state and then pass it to @ref Vector(CompileState&&).
+         * See @ref shaders-async for more information.
+         */
+        static CompileState compile();
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to calling @ref Vector(CompileState&&) with the result of
+         * @ref compile().
+         */
         explicit Vector();
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit Vector(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -146,11 +175,32 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public Abst
         #endif
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit Vector(Containers::NoInitT) {}
+
         Int _transformationProjectionMatrixUniform{0},
             _backgroundColorUniform{1},
             _colorUniform{2};
 };
 
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref Vector::compile(), see @ref shaders-async for more
+information.
+*/
+template<UnsignedInt dimensions> class Vector<dimensions>::CompileState: public Vector<dimensions> {
+    /* Everything deliberately private except for the inheritance */
+    friend Vector;
+
+    explicit CompileState(Vector<dimensions>&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version, std::string&& cacheKey): Vector<dimensions>{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)}, _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    GL::Version _version;
+    std::string _cacheKey;
+};
+
 /** @brief Two-dimensional vector shader */
 typedef Vector<2> Vector2D;
 
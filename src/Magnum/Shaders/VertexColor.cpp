@@ -30,6 +30,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderProgramCache.h"
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
 
@@ -41,7 +42,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "VertexColor3D.vert"; }
 }
 
-template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor() {
+template<UnsignedInt dimensions> typename VertexColor<dimensions>::CompileState VertexColor<dimensions>::compile() {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -62,9 +63,17 @@ template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor() {
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(rs.get("VertexColor.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+    VertexColor<dimensions> out{Containers::NoInit};
 
-    attachShaders({vert, frag});
+    std::string cacheKey;
+    if(GL::ShaderProgramCache::loadCurrent(out, {vert, frag}, cacheKey))
+        return CompileState{std::move(out), GL::Shader{NoCreate}, GL::Shader{NoCreate}, version, {}};
+
+    /* Only submit the compilation and linking, the status is checked in the
+       constructor */
+    GL::Shader::submitCompile({vert, frag});
+
+    out.attachShaders({vert, frag});
 
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
@@ -72,14 +81,28 @@ template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor() {
     if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
-        bindAttributeLocation(Color3::Location, "color"); /* Color4 is the same */
+        out.bindAttributeLocation(Position::Location, "position");
+        out.bindAttributeLocation(Color3::Location, "color"); /* Color4 is the same */
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    out.submitLink();
+
+    return CompileState{std::move(out), std::move(vert), std::move(frag), version, std::move(cacheKey)};
+}
+
+template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(): VertexColor{compile()} {}
+
+template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(CompileState&& state): VertexColor{static_cast<VertexColor<dimensions>&&>(std::move(state))} {
+    /* If not loaded from a cache, check the result and save the binary */
+    if(state._vert.id()) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({state._vert, state._frag}));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink());
+
+        GL::ShaderProgramCache::saveCurrent(*this, state._cacheKey);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(state._version))
     #endif
     {
         _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
@@ -29,8 +29,11 @@
  * @brief Class @ref Magnum::Shaders::VertexColor
  */
 
+#include <Corrade/Containers/Tags.h>
+
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Shader.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -97,8 +100,35 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT VertexColor: public
         typedef CORRADE_DEPRECATED("use Color3 or Color4 instead") typename Generic<dimensions>::Color Color;
         #endif
 
+        class CompileState;
+
+        /**
+         * @brief Compile asynchronously
+         *
+         * Compared to @ref VertexColor() only submits the shader for
+         * compilation and linking without waiting for the result. Poll
+         * @ref isLinkFinished() on the returned state and then pass it to
+         * @ref VertexColor(CompileState&&). See @ref shaders-async for more
+         * information.
+         */
+        static CompileState compile();
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to calling @ref VertexColor(CompileState&&) with the
+         * result of @ref compile().
+         */
         explicit VertexColor();
 
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes a state returned by @ref compile() and creates a ready-to-use
+         * shader from it. Blocks if the linking isn't finished yet.
+         */
+        explicit VertexColor(CompileState&& state);
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -135,9 +165,30 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT VertexColor: public
         }
 
     private:
+        /* Creates the GL object but doesn't do anything else, used by
+           compile() */
+        explicit VertexColor(Containers::NoInitT) {}
+
         Int _transformationProjectionMatrixUniform{0};
 };
 
+/**
+@brief Asynchronous compilation state
+
+Returned by @ref VertexColor::compile(), see @ref shaders-async for more
+information.
+*/
+template<UnsignedInt dimensions> class VertexColor<dimensions>::CompileState: public VertexColor<dimensions> {
+    /* Everything deliberately private except for the inheritance */
+    friend VertexColor;
+
+    explicit CompileState(VertexColor<dimensions>&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version, std::string&& cacheKey): VertexColor<dimensions>{std::move(shader)}, _vert{std::move(vert)}, _frag{std::move(frag)}, _version{version}, _cacheKey{std::move(cacheKey)} {}
+
+    GL::Shader _vert, _frag;
+    GL::Version _version;
+    std::string _cacheKey;
+};
+
 /** @brief 2D vertex color shader */
 typedef VertexColor<2> VertexColor2D;
 
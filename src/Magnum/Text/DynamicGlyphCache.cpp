@@ -0,0 +1,252 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DynamicGlyphCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+    /* Slot states, stored in place of glyph ID */
+    constexpr UnsignedInt FreeSlot = ~UnsignedInt{};
+    constexpr UnsignedInt ReservedSlot = ~UnsignedInt{} - 1;
+
+    /* Slot index of glyphs that have zero size */
+    constexpr UnsignedInt NoSlot = ~UnsignedInt{};
+}
+
+DynamicGlyphCache::DynamicGlyphCache(const Vector2i& size, const Vector2i& slotSize, const Vector2i& padding): GlyphCache{size, padding}, _slotSize{slotSize}, _image{Containers::ValueInit, std::size_t(size.product())} {
+    CORRADE_ASSERT((slotSize > Vector2i{0}).all() && (slotSize <= size).all(),
+        "Text::DynamicGlyphCache: expected positive slot size not larger than" << size << "but got" << slotSize, );
+
+    const Vector2i slotCount = size/slotSize;
+    _slotsPerRow = slotCount.x();
+    _slots.resize(slotCount.product());
+    for(std::size_t i = 0; i != _slots.size(); ++i) {
+        _slots[i].glyph = FreeSlot;
+        _slots[i].frame = 0;
+        _slots[i].lru = _lru.insert(_lru.begin(), i);
+    }
+}
+
+DynamicGlyphCache::~DynamicGlyphCache() = default;
+
+DynamicGlyphCache& DynamicGlyphCache::resetStatistics() {
+    _hits = _misses = _evictions = 0;
+    return *this;
+}
+
+Range2Di DynamicGlyphCache::slotRange(const UnsignedInt slot) const {
+    return Range2Di::fromSize(
+        Vector2i{Int(slot)%_slotsPerRow, Int(slot)/_slotsPerRow}*_slotSize,
+        _slotSize);
+}
+
+void DynamicGlyphCache::use(const UnsignedInt slot) {
+    _slots[slot].frame = _frame;
+    _lru.splice(_lru.begin(), _lru, _slots[slot].lru);
+}
+
+void DynamicGlyphCache::release(const UnsignedInt slot) {
+    _slots[slot].glyph = FreeSlot;
+    _slots[slot].frame = 0;
+    _lru.splice(_lru.end(), _lru, _slots[slot].lru);
+    --_usedSlotCount;
+}
+
+void DynamicGlyphCache::releaseReserved() {
+    /* Give back slots that the font reserved but didn't fill */
+    for(const UnsignedInt slot: _reserved)
+        if(_slots[slot].glyph == ReservedSlot) release(slot);
+    _reserved.clear();
+}
+
+bool DynamicGlyphCache::request(AbstractFont& font, const std::string& text) {
+    _missingGlyphs.clear();
+    _missingCharacters.clear();
+
+    for(std::size_t i = 0; i < text.size(); ) {
+        const std::size_t begin = i;
+        char32_t character;
+        std::tie(character, i) = Utility::Unicode::nextChar(text, i);
+
+        /* The "Not Found" glyph is always in the cache */
+        const UnsignedInt glyph = font.glyphId(character);
+        if(!glyph) continue;
+
+        auto found = _glyphSlots.find(glyph);
+        if(found != _glyphSlots.end()) {
+            ++_hits;
+            if(found->second != NoSlot) use(found->second);
+            continue;
+        }
+
+        if(std::find(_missingGlyphs.begin(), _missingGlyphs.end(), glyph) != _missingGlyphs.end())
+            continue;
+
+        _missingGlyphs.push_back(glyph);
+        _missingCharacters.append(text, begin, i - begin);
+    }
+
+    if(_missingGlyphs.empty()) return true;
+
+    _misses += _missingGlyphs.size();
+    font.fillGlyphCache(*this, _missingCharacters);
+
+    releaseReserved();
+
+    for(const UnsignedInt glyph: _missingGlyphs)
+        if(_glyphSlots.find(glyph) == _glyphSlots.end()) return false;
+
+    return true;
+}
+
+DynamicGlyphCache& DynamicGlyphCache::flush() {
+    /* In case fillGlyphCache() was called directly and not via request() */
+    releaseReserved();
+
+    if(_dirtyEnd > _dirtyBegin) {
+        /* Upload whole rows so the data can be taken directly from the CPU
+           copy without needing row length and skip pixel storage */
+        const Int width = textureSize().x();
+        texture().setSubImage(0, {0, _dirtyBegin}, ImageView2D{
+            PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm,
+            {width, _dirtyEnd - _dirtyBegin},
+            _image.slice(_dirtyBegin*width, _dirtyEnd*width)});
+        _dirtyBegin = _dirtyEnd = 0;
+    }
+
+    ++_frame;
+    return *this;
+}
+
+std::vector<Range2Di> DynamicGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
+    /* Check that all glyphs fit into a slot and count slots needed */
+    std::size_t needed = 0;
+    for(const Vector2i& size: sizes) {
+        if((size + padding()*2 > _slotSize).any()) return {};
+        if(size.product()) ++needed;
+    }
+
+    /* Check that there's enough slots that are either free or weren't used
+       in this frame. Free slots are at the end of the LRU list, followed by
+       the least recently used ones. */
+    std::size_t available = 0;
+    for(auto it = _lru.rbegin(); available != needed && it != _lru.rend() && _slots[*it].frame != _frame; ++it)
+        ++available;
+    if(available != needed) return {};
+
+    std::vector<Range2Di> out;
+    out.reserve(sizes.size());
+    for(const Vector2i& size: sizes) {
+        if(!size.product()) {
+            out.emplace_back();
+            continue;
+        }
+
+        const UnsignedInt slot = _lru.back();
+        Slot& s = _slots[slot];
+        if(s.glyph == FreeSlot) ++_usedSlotCount;
+        else {
+            erase(s.glyph);
+            _glyphSlots.erase(s.glyph);
+            ++_evictions;
+        }
+        s.glyph = ReservedSlot;
+        use(slot);
+        _reserved.push_back(slot);
+
+        /* Clear the slot so there are no leftovers from the previous glyph
+           in the padding */
+        const Range2Di range = slotRange(slot);
+        const Int width = textureSize().x();
+        for(Int y = range.min().y(); y != range.max().y(); ++y)
+            std::memset(_image.data() + y*width + range.min().x(), 0, range.sizeX());
+        if(_dirtyEnd == _dirtyBegin) {
+            _dirtyBegin = range.min().y();
+            _dirtyEnd = range.max().y();
+        } else {
+            _dirtyBegin = std::min(_dirtyBegin, range.min().y());
+            _dirtyEnd = std::max(_dirtyEnd, range.max().y());
+        }
+
+        out.push_back(Range2Di::fromSize(range.min() + padding(), size));
+    }
+
+    return out;
+}
+
+void DynamicGlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
+    /* Glyphs with zero size don't occupy any slot */
+    UnsignedInt slot = NoSlot;
+    if(rectangle.size().product()) {
+        const Vector2i slotPosition = (rectangle.min() - padding())/_slotSize;
+        slot = slotPosition.y()*_slotsPerRow + slotPosition.x();
+        CORRADE_ASSERT(slot < _slots.size() && _slots[slot].glyph == ReservedSlot && rectangle.min() - padding() == slotRange(slot).min(),
+            "Text::DynamicGlyphCache::insert(): rectangle" << rectangle << "was not reserved with reserve()", );
+    }
+
+    /* Overwriting the "Not Found" glyph, give back its previous slot */
+    auto found = _glyphSlots.find(glyph);
+    if(found != _glyphSlots.end() && found->second != NoSlot)
+        release(found->second);
+
+    GlyphCache::insert(glyph, position, rectangle);
+    _glyphSlots[glyph] = slot;
+    if(slot != NoSlot) _slots[slot].glyph = glyph;
+}
+
+void DynamicGlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
+    CORRADE_ASSERT(image.format() == PixelFormat::R8Unorm,
+        "Text::DynamicGlyphCache::setImage(): expected" << PixelFormat::R8Unorm << "but got" << image.format(), );
+
+    const std::pair<Math::Vector2<std::size_t>, Math::Vector2<std::size_t>> properties = image.dataProperties();
+    const char* const data = image.data<char>() + properties.first.sum();
+    const std::size_t stride = properties.second.x();
+    const Int width = textureSize().x();
+
+    /* Copy only the reserved slots, the font may upload the whole cache
+       image with other glyphs left empty */
+    const Range2Di imageRange = Range2Di::fromSize(offset, image.size());
+    for(const UnsignedInt slot: _reserved) {
+        const Range2Di range = Math::intersect(imageRange, slotRange(slot));
+        if(!range.size().product()) continue;
+
+        for(Int y = range.min().y(); y != range.max().y(); ++y)
+            std::memcpy(_image.data() + y*width + range.min().x(),
+                data + (y - offset.y())*stride + (range.min().x() - offset.x()),
+                range.sizeX());
+    }
+}
+
+}}
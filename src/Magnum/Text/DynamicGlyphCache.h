@@ -0,0 +1,237 @@
+#ifndef Magnum_Text_DynamicGlyphCache_h
+#define Magnum_Text_DynamicGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::DynamicGlyphCache
+ */
+
+#include <list>
+#include <string>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Text.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Dynamic glyph cache
+
+Glyph cache that rasterizes glyphs on demand, evicts least recently used
+glyphs when full and uploads the changes to the texture in one batch per
+frame. Useful for scripts with large character sets such as CJK, where filling
+the cache with all glyphs upfront using @ref AbstractFont::fillGlyphCache()
+would need a prohibitively large texture.
+
+@section Text-DynamicGlyphCache-usage Usage
+
+Call @ref request() with all texts that are going to be drawn in given frame.
+Glyphs that are not in the cache yet get rasterized by the font using
+@ref AbstractFont::fillGlyphCache(), then call @ref flush() before drawing to
+upload them to the texture:
+
+@snippet MagnumText.cpp DynamicGlyphCache-usage
+
+The cache texture is divided into a grid of equally-sized slots, each holding
+one glyph including its padding. Glyphs with zero size, such as spaces, don't
+occupy any slot. When there are no free slots left, glyphs that were not
+requested in the current frame are evicted, starting with the least recently
+used. Glyphs requested since the last @ref flush() are never evicted, so a
+single frame can use at most @ref slotCount() distinct glyphs.
+
+An evicted glyph can have its texture region reused by a different glyph, so
+vertex data of texts laid out earlier may become invalid. Render the text
+again after calling @ref request() for it, and if you use a @ref LayoutCache,
+clear it when @ref evictions() changes.
+
+The font is expected to support @ref AbstractFont::fillGlyphCache() and
+to use @ref reserve() for all non-empty glyphs, one cache should be used only
+with one font. The cache texture has single-channel format, see
+@ref GlyphCache::GlyphCache(const Vector2i&, const Vector2i&) for details.
+The @ref occupancy() of this cache is always zero, use @ref usedSlotCount()
+instead.
+@see @ref Renderer
+*/
+class MAGNUM_TEXT_EXPORT DynamicGlyphCache: public GlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Glyph cache texture size
+         * @param slotSize  Size of a slot for one glyph, including padding
+         * @param padding   Padding around every glyph
+         *
+         * Expects that @p slotSize is positive and not larger than @p size.
+         * The slots fill the texture in a grid, the space left over if
+         * @p size is not a multiple of @p slotSize is unused.
+         */
+        explicit DynamicGlyphCache(const Vector2i& size, const Vector2i& slotSize, const Vector2i& padding = {});
+
+        ~DynamicGlyphCache();
+
+        /** @brief Size of a slot for one glyph, including padding */
+        Vector2i slotSize() const { return _slotSize; }
+
+        /** @brief Count of glyph slots in the cache texture */
+        std::size_t slotCount() const { return _slots.size(); }
+
+        /** @brief Count of glyph slots that are currently used */
+        std::size_t usedSlotCount() const { return _usedSlotCount; }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of characters passed to @ref request() that had their glyph
+         * already in the cache, since construction or since the last call to
+         * @ref resetStatistics().
+         * @see @ref misses(), @ref evictions()
+         */
+        std::size_t hits() const { return _hits; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of distinct glyphs that were not in the cache and had to be
+         * rasterized in @ref request(), since construction or since the last
+         * call to @ref resetStatistics().
+         * @see @ref hits(), @ref evictions()
+         */
+        std::size_t misses() const { return _misses; }
+
+        /**
+         * @brief Count of evicted glyphs
+         *
+         * Count of glyphs that were removed from the cache to make space for
+         * new ones, since construction or since the last call to
+         * @ref resetStatistics().
+         * @see @ref hits(), @ref misses()
+         */
+        std::size_t evictions() const { return _evictions; }
+
+        /**
+         * @brief Reset hit, miss and eviction counters
+         * @return Reference to self (for method chaining)
+         */
+        DynamicGlyphCache& resetStatistics();
+
+        /**
+         * @brief Make sure glyphs for given text are in the cache
+         *
+         * Marks glyphs of all characters in @p text as used in the current
+         * frame and calls @ref AbstractFont::fillGlyphCache() with characters
+         * whose glyphs are not in the cache yet. Characters not present in
+         * the font are mapped to glyph @cpp 0 @ce and are skipped. Returns
+         * @cpp false @ce if some glyphs couldn't be added, either because they
+         * are larger than @ref slotSize() or because there's not enough slots
+         * that weren't used in the current frame, @cpp true @ce otherwise.
+         *
+         * The new glyphs are not uploaded to the texture until @ref flush()
+         * is called.
+         */
+        bool request(AbstractFont& font, const std::string& text);
+
+        /**
+         * @brief Upload glyph changes and begin a new frame
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads glyphs added since the last call in a single
+         * @ref GL::Texture2D::setSubImage() call covering all changed rows of
+         * the texture. Glyphs requested before this call can be evicted by
+         * subsequent calls to @ref request().
+         */
+        DynamicGlyphCache& flush();
+
+        /**
+         * @brief Reserve slots for given glyph sizes
+         *
+         * Reuses free slots first, then slots of least recently used glyphs
+         * that were not requested in the current frame. The glyphs that
+         * occupied the reused slots are removed from the cache. Glyphs with
+         * zero size don't occupy any slot and get a zero region. If any of
+         * the glyphs is larger than @ref slotSize() including padding or if
+         * there's not enough slots, an empty vector is returned and no slot
+         * is reserved.
+         */
+        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes) override;
+
+        /**
+         * @brief Insert glyph to cache
+         *
+         * Expects that non-empty @p rectangle was returned from
+         * @ref reserve() and wasn't used for another glyph yet.
+         */
+        void insert(UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) override;
+
+        /**
+         * @brief Set cache image
+         *
+         * Copies parts of @p image that overlap slots reserved with
+         * @ref reserve() in the current @ref request() to a
+         * CPU-side copy of the texture, the rest of the image is ignored.
+         * The texture is updated in @ref flush(). Expects that the image is
+         * @ref PixelFormat::R8Unorm.
+         */
+        void setImage(const Vector2i& offset, const ImageView2D& image) override;
+
+    private:
+        struct Slot {
+            UnsignedInt glyph;
+            /* Frame in which the slot was used last, 0 if free */
+            UnsignedInt frame;
+            std::list<UnsignedInt>::iterator lru;
+        };
+
+        void MAGNUM_TEXT_LOCAL use(UnsignedInt slot);
+        void MAGNUM_TEXT_LOCAL release(UnsignedInt slot);
+        void MAGNUM_TEXT_LOCAL releaseReserved();
+        Range2Di MAGNUM_TEXT_LOCAL slotRange(UnsignedInt slot) const;
+
+        Vector2i _slotSize;
+        Int _slotsPerRow;
+        UnsignedInt _frame{1};
+        std::size_t _usedSlotCount{}, _hits{}, _misses{}, _evictions{};
+
+        std::vector<Slot> _slots;
+        /* Slot indices, most recently used first, free slots at the end */
+        std::list<UnsignedInt> _lru;
+        /* Glyph ID to slot index */
+        std::unordered_map<UnsignedInt, UnsignedInt> _glyphSlots;
+
+        /* Slots reserved during the current request() or since the last
+           flush() */
+        std::vector<UnsignedInt> _reserved;
+        std::vector<UnsignedInt> _missingGlyphs;
+        std::string _missingCharacters;
+
+        /* CPU-side copy of the texture and range of rows changed since the
+           last flush() */
+        Containers::Array<char> _image;
+        Int _dirtyBegin{}, _dirtyEnd{};
+};
+
+}}
+
+#endif
@@ -29,19 +29,18 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/TextureFormat.h"
-#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
 GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
     #endif
@@ -70,15 +69,19 @@ void GlyphCache::initialize(const GL::TextureFormat internalFormat, const Vector
 }
 
 std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
+    CORRADE_ASSERT(!_unmanagedGlyphs,
+        "Text::GlyphCache::reserve(): can't reserve space in a cache filled without reserve()", {});
     glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    return _packer.add(sizes);
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
     const std::pair<Vector2i, Range2Di> glyphData = {position-_padding, rectangle.padded(_padding)};
 
+    /* The glyph occupies space the packer doesn't know about, so it's not
+       possible to reserve more space later */
+    if(!_packer.count() && rectangle.size().product()) _unmanagedGlyphs = true;
+
     /* Overwriting "Not Found" glyph */
     if(glyph == 0) glyphs[0] = glyphData;
 
@@ -86,6 +89,11 @@ void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const
     else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
 }
 
+void GlyphCache::erase(const UnsignedInt glyph) {
+    if(glyph == 0) glyphs[0] = {};
+    else glyphs.erase(glyph);
+}
+
 void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
     /** @todo some internalformat/format checking also here (if querying internal format is not slow) */
     _texture.setSubImage(0, offset, image);
@@ -35,6 +35,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -113,6 +114,16 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /** @brief Count of glyphs in the cache */
         std::size_t glyphCount() const { return glyphs.size(); }
 
+        /**
+         * @brief Cache texture occupancy
+         *
+         * Ratio of the space reserved using @ref reserve() to the total
+         * cache texture area, in range @f$ [0, 1] @f$. Doesn't include
+         * glyph padding.
+         * @see @ref TextureTools::AtlasPacker::occupancy()
+         */
+        Float occupancy() const { return _packer.occupancy(); }
+
         /** @brief Cache texture */
         GL::Texture2D& texture() { return _texture; }
 
@@ -148,18 +159,26 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
+         * Returns non-overlapping regions in cache texture to store glyphs,
+         * use @ref insert() to store actual glyph on given position and
+         * @ref setImage() to upload glyph image.
          *
-         * Glyph @p sizes are expected to be without padding.
+         * The space is allocated using @ref TextureTools::AtlasPacker, which
+         * remembers the occupied space, so it's possible to call this function
+         * repeatedly to add more glyphs to an already filled cache without
+         * affecting the glyphs that are already there. That's however not
+         * possible if the cache was filled with glyphs without calling this
+         * function first, e.g. when importing a prerendered cache.
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
-         * @see @ref padding()
+         * Glyph @p sizes are expected to be without padding. If the glyphs
+         * don't fit into the remaining space, an empty vector is returned and
+         * no space is reserved.
+         *
+         * Subclasses can override this function to manage the texture space
+         * on their own, see @ref DynamicGlyphCache for an example.
+         * @see @ref padding(), @ref occupancy()
          */
-        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
+        virtual std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
 
         /**
          * @brief Insert glyph to cache
@@ -176,7 +195,7 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * See also @ref setImage() to upload glyph image.
          * @see @ref padding()
          */
-        void insert(UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle);
+        virtual void insert(UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle);
 
         /**
          * @brief Set cache image
@@ -186,11 +205,24 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         virtual void setImage(const Vector2i& offset, const ImageView2D& image);
 
+    protected:
+        /**
+         * @brief Remove glyph from the cache
+         *
+         * Meant to be used by subclasses that reuse texture space of glyphs
+         * that are no longer needed. Removing glyph @cpp 0 @ce resets it to
+         * zero position and zero region in texture atlas. Doesn't free the
+         * space reserved with @ref reserve().
+         */
+        void erase(UnsignedInt glyph);
+
     private:
         void MAGNUM_LOCAL initialize(GL::TextureFormat internalFormat, const Vector2i& size);
 
         Vector2i _size, _padding;
         GL::Texture2D _texture;
+        TextureTools::AtlasPacker _packer;
+        bool _unmanagedGlyphs{};
 
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
 };
@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LayoutCache.h"
+
+#include <functional>
+#include <iterator>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Text/Alignment.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+inline void hashCombine(std::size_t& seed, const std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+std::size_t hashKey(const AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment, const std::string& text) {
+    std::size_t hash = std::hash<std::string>{}(text);
+    hashCombine(hash, std::hash<const void*>{}(&font));
+    hashCombine(hash, std::hash<const void*>{}(&cache));
+    hashCombine(hash, std::hash<Float>{}(size));
+    hashCombine(hash, std::size_t(alignment));
+    return hash;
+}
+
+}
+
+LayoutCache::LayoutCache(const std::size_t capacity): _capacity{capacity} {
+    CORRADE_ASSERT(capacity, "Text::LayoutCache: capacity can't be zero", );
+    _lookup.reserve(capacity);
+}
+
+LayoutCache::~LayoutCache() = default;
+
+LayoutCache& LayoutCache::resetStatistics() {
+    _hits = _misses = 0;
+    return *this;
+}
+
+LayoutCache& LayoutCache::clear() {
+    _entries.clear();
+    _lookup.clear();
+    return *this;
+}
+
+auto LayoutCache::find(const AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment, const std::string& text) -> const Entry* {
+    const std::size_t hash = hashKey(font, cache, size, alignment, text);
+    const auto found = _lookup.find(hash);
+
+    /* The hash can collide, verify the whole key */
+    if(found == _lookup.end() ||
+       found->second->font != &font ||
+       found->second->cache != &cache ||
+       found->second->size != size ||
+       found->second->alignment != alignment ||
+       found->second->text != text)
+    {
+        ++_misses;
+        return nullptr;
+    }
+
+    /* Mark as most recently used */
+    _entries.splice(_entries.begin(), _entries, found->second);
+
+    ++_hits;
+    return &*found->second;
+}
+
+auto LayoutCache::insert(const AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment, const std::string& text) -> Entry& {
+    const std::size_t hash = hashKey(font, cache, size, alignment, text);
+
+    /* If there's an entry with the same hash already (i.e., a collision),
+       reuse it. Otherwise reuse the least recently used entry if the cache is
+       full, so its memory can be recycled, or add a new one. */
+    std::list<Entry>::iterator entry;
+    const auto found = _lookup.find(hash);
+    if(found != _lookup.end()) {
+        entry = found->second;
+        _entries.splice(_entries.begin(), _entries, entry);
+    } else {
+        if(_entries.size() == _capacity) {
+            entry = std::prev(_entries.end());
+            _lookup.erase(entry->hash);
+            _entries.splice(_entries.begin(), _entries, entry);
+        } else {
+            _entries.emplace_front();
+            entry = _entries.begin();
+        }
+
+        _lookup.emplace(hash, entry);
+    }
+
+    entry->hash = hash;
+    entry->font = &font;
+    entry->cache = &cache;
+    entry->size = size;
+    entry->alignment = alignment;
+    entry->text.assign(text);
+    entry->vertices.clear();
+    entry->rectangle = {};
+    return *entry;
+}
+
+}}
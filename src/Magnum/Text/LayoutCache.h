@@ -0,0 +1,164 @@
+#ifndef Magnum_Text_LayoutCache_h
+#define Magnum_Text_LayoutCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::LayoutCache
+ */
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Text layout cache
+
+Remembers vertex data of texts laid out by @ref AbstractRenderer::render(const std::string&),
+so rendering the same text again with the same font, glyph cache, size and
+alignment doesn't need to go through @ref AbstractFont::layout() again, only
+copies the vertex data into the vertex buffer. Useful for example for a HUD
+where a lot of labels are updated every frame, but their contents change only
+occasionally or cycle through a small set of values.
+
+@section Text-LayoutCache-usage Usage
+
+Create the cache and attach it to one or more renderers using
+@ref AbstractRenderer::setLayoutCache(). The cache has a fixed capacity and
+when it's full, the least recently used text is evicted. Hit and miss counts
+can be queried using @ref hits() and @ref misses():
+
+@snippet MagnumText.cpp LayoutCache-usage
+
+The texts are identified by font and glyph cache address, size, alignment and
+the text itself. The cache has no way to know when a font or a glyph cache
+changes or gets destroyed, call @ref clear() in that case to avoid getting
+stale data.
+@see @ref Renderer
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Max count of texts kept in the cache
+         *
+         * Expects that @p capacity is not zero.
+         */
+        explicit LayoutCache(std::size_t capacity = 1024);
+
+        /** @brief Copying is not allowed */
+        LayoutCache(const LayoutCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        LayoutCache(LayoutCache&&) = delete;
+
+        ~LayoutCache();
+
+        /** @brief Copying is not allowed */
+        LayoutCache& operator=(const LayoutCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        LayoutCache& operator=(LayoutCache&&) = delete;
+
+        /** @brief Max count of texts kept in the cache */
+        std::size_t capacity() const { return _capacity; }
+
+        /** @brief Count of texts currently in the cache */
+        std::size_t size() const { return _entries.size(); }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of texts that were found in the cache since construction or
+         * since the last call to @ref resetStatistics().
+         * @see @ref misses()
+         */
+        std::size_t hits() const { return _hits; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of texts that were not found in the cache and had to be laid
+         * out since construction or since the last call to
+         * @ref resetStatistics().
+         * @see @ref hits()
+         */
+        std::size_t misses() const { return _misses; }
+
+        /**
+         * @brief Reset hit and miss counters
+         * @return Reference to self (for method chaining)
+         */
+        LayoutCache& resetStatistics();
+
+        /**
+         * @brief Remove all texts from the cache
+         * @return Reference to self (for method chaining)
+         *
+         * Doesn't reset hit and miss counters, use @ref resetStatistics() for
+         * that.
+         */
+        LayoutCache& clear();
+
+    private:
+        friend AbstractRenderer;
+
+        struct Entry {
+            std::size_t hash;
+            const AbstractFont* font;
+            const GlyphCache* cache;
+            Float size;
+            Alignment alignment;
+            std::string text;
+            /* Interleaved position and texture coordinates, four vertices
+               for each glyph */
+            std::vector<Vector2> vertices;
+            Range2D rectangle;
+        };
+
+        /* Returns a null pointer on a miss */
+        MAGNUM_TEXT_LOCAL const Entry* find(const AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment, const std::string& text);
+
+        /* Returns an entry with everything except vertices and rectangle
+           filled. If there's no space, the least recently used entry is
+           reused. */
+        MAGNUM_TEXT_LOCAL Entry& insert(const AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment, const std::string& text);
+
+        std::size_t _capacity, _hits{}, _misses{};
+        /* Most recently used first */
+        std::list<Entry> _entries;
+        std::unordered_map<std::size_t, std::list<Entry>::iterator> _lookup;
+};
+
+}}
+
+#endif
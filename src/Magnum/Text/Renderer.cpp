@@ -31,9 +31,11 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/StreamingBuffer.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/LayoutCache.h"
 
 namespace Magnum { namespace Text {
 
@@ -63,18 +65,20 @@ struct Vertex {
     Vector2 position, textureCoordinates;
 };
 
-std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
-    /* Output data, reserve memory as when the text would be ASCII-only. In
-       reality the actual vertex count will be smaller, but allocating more at
-       once is better than reallocating many times later. */
-    std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
+/* The layout cache stores the vertices as interleaved Vector2s */
+static_assert(sizeof(Vertex) == 2*sizeof(Vector2), "unexpected vertex layout");
 
-    /* Total rendered bounds, intial line position, line increment, last+1
-       vertex on previous line */
+/* Lays out the text into given vertex view, returning glyph count and
+   rectangle spanning the rendered text. If the view is too small, the glyphs
+   that don't fit are only counted. The line buffer is passed from outside so
+   it can be reused across calls. */
+std::pair<UnsignedInt, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment, std::string& line, const Containers::ArrayView<Vertex> vertices) {
+    /* Total rendered bounds, intial line position, line increment, current
+       vertex count, last+1 vertex on previous line */
     Range2D rectangle;
     Vector2 linePosition;
     const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
+    std::size_t vertexCount = 0;
     std::size_t lastLineLastVertex = 0;
 
     /* Temp buffer so we don't allocate for each new line */
@@ -82,7 +86,6 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
      * @todo C++1z: use std::string_view to avoid the one allocation and all
      *      the copying altogether
      */
-    std::string line;
     line.reserve(text.size());
 
     /* Render each line separately and align it horizontally */
@@ -97,12 +100,6 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
         /* Layout the line */
         const auto layouter = font.layout(cache, size, line);
 
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
-
         /* Bounds of rendered line */
         Range2D lineRectangle;
 
@@ -118,12 +115,14 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
                |   |
                1---3 */
 
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
+            /* Glyphs that don't fit are only counted */
+            if(vertexCount + 4 <= vertices.size()) {
+                vertices[vertexCount + 0] = {quadPosition.topLeft(), textureCoordinates.topLeft()};
+                vertices[vertexCount + 1] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
+                vertices[vertexCount + 2] = {quadPosition.topRight(), textureCoordinates.topRight()};
+                vertices[vertexCount + 3] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
+            }
+            vertexCount += 4;
         }
 
         /** @todo What about top-down text? */
@@ -141,8 +140,8 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
         /* Align positions and bounds on current line */
         lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
+        for(std::size_t i = lastLineLastVertex, end = Math::min(vertexCount, vertices.size()); i < end; ++i)
+            vertices[i].position.x() += alignmentOffsetX;
 
         /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
         if(!rectangle.size().isZero()) {
@@ -153,7 +152,7 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     /* Move to next line */
     } while(prevPos = pos+1,
             linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
+            lastLineLastVertex = vertexCount,
             pos != std::string::npos);
 
     /* Vertically align the rendered text */
@@ -169,7 +168,28 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
     /* Align positions and bounds */
     rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
+    for(std::size_t i = 0, end = Math::min(vertexCount, vertices.size()); i != end; ++i)
+        vertices[i].position.y() += alignmentOffsetY;
+
+    return {UnsignedInt(vertexCount/4), rectangle};
+}
+
+std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
+    /* Output data, allocate memory as when the text would be ASCII-only. In
+       reality the actual vertex count will be smaller, but allocating more at
+       once is better than reallocating many times later. */
+    std::vector<Vertex> vertices(text.size()*4);
+    std::string line;
+
+    UnsignedInt glyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, rectangle) = renderVerticesInternal(font, cache, size, text, alignment, line, {vertices.data(), vertices.size()});
+
+    /* Verify that everything fit. The only problem might arise when the
+       layouter decides to compose one character from more than one glyph
+       (i.e. accents). Will remove the assert when this issue arises. */
+    CORRADE_INTERNAL_ASSERT(glyphCount*4 <= vertices.size());
+    vertices.resize(glyphCount*4);
 
     return std::make_tuple(std::move(vertices), rectangle);
 }
@@ -223,6 +243,51 @@ std::tuple<GL::Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCach
     return std::make_tuple(std::move(mesh), rectangle);
 }
 
+std::tuple<GL::Mesh, Range2D, GLintptr> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, GL::StreamingBuffer& vertexBuffer, GL::StreamingBuffer& indexBuffer, Alignment alignment) {
+    /* Allocate the vertices as when the text would be ASCII-only and render
+       them directly to the vertex buffer. The unused rest of the allocation
+       stays wasted until the next frame, but it saves a temporary copy. */
+    const std::pair<GLintptr, Containers::ArrayView<char>> vertexData = vertexBuffer.allocate(text.size()*4*sizeof(Vertex));
+    std::string line;
+    UnsignedInt glyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, rectangle) = renderVerticesInternal(font, cache, size, text, alignment, line, {reinterpret_cast<Vertex*>(vertexData.second.data()), text.size()*4});
+
+    /* Same as in the std::vector variant above */
+    CORRADE_INTERNAL_ASSERT(glyphCount <= text.size());
+    vertexBuffer.flush();
+
+    const UnsignedInt vertexCount = glyphCount*4;
+    const UnsignedInt indexCount = glyphCount*6;
+
+    /* Render indices directly to the index buffer */
+    MeshIndexType indexType;
+    std::pair<GLintptr, Containers::ArrayView<char>> indexData;
+    if(vertexCount <= 256) {
+        indexType = MeshIndexType::UnsignedByte;
+        indexData = indexBuffer.allocate(indexCount*sizeof(UnsignedByte));
+        createIndices<UnsignedByte>(indexData.second, glyphCount);
+    } else if(vertexCount <= 65536) {
+        indexType = MeshIndexType::UnsignedShort;
+        indexData = indexBuffer.allocate(indexCount*sizeof(UnsignedShort));
+        createIndices<UnsignedShort>(indexData.second, glyphCount);
+    } else {
+        indexType = MeshIndexType::UnsignedInt;
+        indexData = indexBuffer.allocate(indexCount*sizeof(UnsignedInt));
+        createIndices<UnsignedInt>(indexData.second, glyphCount);
+    }
+    indexBuffer.flush();
+
+    /* Configure mesh except for vertex buffer (depends on dimension count, done
+       in subclass) */
+    GL::Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(indexCount)
+        .setIndexBuffer(indexBuffer.buffer(), indexData.first, indexType, 0, vertexCount);
+
+    return std::make_tuple(std::move(mesh), rectangle, vertexData.first);
+}
+
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
@@ -259,6 +324,19 @@ template<UnsignedInt dimensions> std::tuple<GL::Mesh, Range2D> Renderer<dimensio
     return r;
 }
 
+template<UnsignedInt dimensions> std::tuple<GL::Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, GL::StreamingBuffer& vertexBuffer, GL::StreamingBuffer& indexBuffer, Alignment alignment) {
+    /* Finalize mesh configuration and return the result */
+    GL::Mesh mesh{NoCreate};
+    Range2D rectangle;
+    GLintptr vertexOffset;
+    std::tie(mesh, rectangle, vertexOffset) = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, alignment);
+    mesh.addVertexBuffer(vertexBuffer.buffer(), vertexOffset,
+            typename Shaders::AbstractVector<dimensions>::Position(
+                Shaders::AbstractVector<dimensions>::Position::Components::Two),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
+    return std::make_tuple(std::move(mesh), rectangle);
+}
+
 #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
 AbstractRenderer::BufferMapImplementation AbstractRenderer::bufferMapImplementation = &AbstractRenderer::bufferMapImplementationFull;
 AbstractRenderer::BufferUnmapImplementation AbstractRenderer::bufferUnmapImplementation = &AbstractRenderer::bufferUnmapImplementationDefault;
@@ -295,7 +373,7 @@ void AbstractRenderer::bufferUnmapImplementationDefault(GL::Buffer& buffer)
     #endif
 }
 
-AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
+AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0), _layoutCache{} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::map_buffer_range);
     #elif defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -315,6 +393,11 @@ AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache,
 
 AbstractRenderer::~AbstractRenderer() = default;
 
+AbstractRenderer& AbstractRenderer::setLayoutCache(LayoutCache* const layoutCache) {
+    _layoutCache = layoutCache;
+    return *this;
+}
+
 template<UnsignedInt dimensions> Renderer<dimensions>::Renderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): AbstractRenderer(font, cache, size, alignment) {
     /* Finalize mesh configuration */
     _mesh.addVertexBuffer(_vertexBuffer, 0,
@@ -334,6 +417,11 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const GL::BufferUsage
     #endif
     _mesh.setCount(0);
 
+    /* Allocate memory for laying out the text, so render() doesn't need to
+       allocate anything */
+    if(_layoutVertices.size() != vertexCount*2)
+        _layoutVertices = Containers::Array<Vector2>{vertexCount*2};
+
     /* Render indices */
     Containers::Array<char> indexData;
     MeshIndexType indexType;
@@ -356,23 +444,43 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const GL::BufferUsage
 }
 
 void AbstractRenderer::render(const std::string& text) {
-    /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    /* Try to find the text in the layout cache first */
+    const LayoutCache::Entry* const cached = _layoutCache ?
+        _layoutCache->find(font, cache, size, _alignment, text) : nullptr;
+
+    /* Either take the vertex data from the cache or lay them out into memory
+       allocated in reserve() */
+    const Vertex* vertexData;
+    UnsignedInt glyphCount;
+    if(cached) {
+        vertexData = reinterpret_cast<const Vertex*>(cached->vertices.data());
+        glyphCount = cached->vertices.size()/8;
+        _rectangle = cached->rectangle;
+    } else {
+        const Containers::ArrayView<Vertex> layoutVertices{reinterpret_cast<Vertex*>(_layoutVertices.data()), _layoutVertices.size()/2};
+        std::tie(glyphCount, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment, _line, layoutVertices);
+        vertexData = layoutVertices.data();
+    }
 
-    const UnsignedInt glyphCount = vertexData.size()/4;
     const UnsignedInt vertexCount = glyphCount*4;
     const UnsignedInt indexCount = glyphCount*6;
 
     CORRADE_ASSERT(glyphCount <= _capacity,
         "Text::Renderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
-    /* Interleave the data into mapped buffer*/
+    /* Remember the laid out text for next time */
+    if(_layoutCache && !cached) {
+        LayoutCache::Entry& entry = _layoutCache->insert(font, cache, size, _alignment, text);
+        const Vector2* const data = reinterpret_cast<const Vector2*>(vertexData);
+        entry.vertices.assign(data, data + vertexCount*2);
+        entry.rectangle = _rectangle;
+    }
+
+    /* Copy the data into mapped buffer */
     Containers::ArrayView<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
         vertexCount*sizeof(Vertex))), vertexCount);
     CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
-    std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
+    std::copy(vertexData, vertexData + vertexCount, vertices.begin());
     bufferUnmapImplementation(_vertexBuffer);
 
     /* Update index count */
@@ -32,6 +32,7 @@
 #include <string>
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Range.h"
@@ -41,10 +42,6 @@
 #include "Magnum/Text/Alignment.h"
 #include "Magnum/Text/visibility.h"
 
-#ifdef CORRADE_TARGET_EMSCRIPTEN
-#include <Corrade/Containers/Array.h>
-#endif
-
 namespace Magnum { namespace Text {
 
 /**
@@ -87,11 +84,31 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /** @brief Mesh */
         GL::Mesh& mesh() { return _mesh; }
 
+        /**
+         * @brief Layout cache
+         *
+         * @see @ref setLayoutCache()
+         */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         * @return Reference to self (for method chaining)
+         *
+         * If set, @ref render(const std::string&) looks up the text in
+         * @p layoutCache first and only lays it out if it's not there. The
+         * cache can be shared among any number of renderers and has to be
+         * kept alive for as long as it's set. Pass @cpp nullptr @ce to stop
+         * using the cache. Initially no cache is set.
+         */
+        AbstractRenderer& setLayoutCache(LayoutCache* layoutCache);
+
         /**
          * @brief Reserve capacity for rendered glyphs
          *
          * Reallocates memory in buffers to hold @p glyphCount glyphs and
-         * prefills index buffer. Consider using appropriate @p vertexBufferUsage
+         * prefills index buffer. Also allocates memory used for laying out
+         * the text in @ref render(const std::string&). Consider using appropriate @p vertexBufferUsage
          * if the text will be changed frequently. Index buffer is changed
          * only by calling this function, thus @p indexBufferUsage generally
          * doesn't need to be so dynamic if the capacity won't be changed much.
@@ -106,7 +123,11 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          *
          * Renders the text to vertex buffer, reusing index buffer already
          * filled with @ref reserve(). Rectangle spanning the rendered text is
-         * available through @ref rectangle().
+         * available through @ref rectangle(). Apart from the layouter
+         * returned by @ref AbstractFont::layout(), no memory is allocated in
+         * the process. If a layout cache is set using @ref setLayoutCache()
+         * and the text is found there, the layout is skipped altogether and
+         * the cached vertex data are copied directly into the vertex buffer.
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -136,6 +157,9 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        LayoutCache* _layoutCache;
+        Containers::Array<Vector2> _layoutVertices;
+        std::string _line;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(GL::Buffer&, GLsizeiptr);
@@ -219,6 +243,31 @@ template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT Renderer: public Abstr
          */
         static std::tuple<GL::Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, GL::Buffer& vertexBuffer, GL::Buffer& indexBuffer, GL::BufferUsage usage, Alignment alignment = Alignment::LineLeft);
 
+        /**
+         * @brief Render text into streaming buffers
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param text          Text to render
+         * @param vertexBuffer  Streaming buffer where to allocate vertices
+         * @param indexBuffer   Streaming buffer where to allocate indices
+         * @param alignment     Text alignment
+         *
+         * Compared to @ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, GL::Buffer&, GL::Buffer&, GL::BufferUsage, Alignment)
+         * the vertex and index data are sub-allocated from the current frame
+         * of given buffers instead of re-specifying their whole storage,
+         * which is suited for text that changes every frame. The returned
+         * mesh is valid only until @ref GL::StreamingBuffer::nextFrame() is
+         * called on either buffer. The vertices are laid out directly into
+         * the vertex buffer without any temporary allocation, for which space
+         * for the worst case of four vertices per byte of @p text is
+         * allocated --- expects that this fits into
+         * @ref GL::StreamingBuffer::availableSize() of the vertex buffer and
+         * the indices of the glyphs actually rendered fit into the index
+         * buffer.
+         */
+        static std::tuple<GL::Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, GL::StreamingBuffer& vertexBuffer, GL::StreamingBuffer& indexBuffer, Alignment alignment = Alignment::LineLeft);
+
         /**
          * @brief Constructor
          * @param font          Font
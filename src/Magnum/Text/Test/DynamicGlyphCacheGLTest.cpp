@@ -0,0 +1,246 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/DynamicGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct DynamicGlyphCacheGLTest: GL::OpenGLTester {
+    explicit DynamicGlyphCacheGLTest();
+
+    void construct();
+    void request();
+    void requestEmptyGlyph();
+    void evict();
+    void evictCurrentFrame();
+    void glyphTooLarge();
+    void flush();
+};
+
+DynamicGlyphCacheGLTest::DynamicGlyphCacheGLTest() {
+    addTests({&DynamicGlyphCacheGLTest::construct,
+              &DynamicGlyphCacheGLTest::request,
+              &DynamicGlyphCacheGLTest::requestEmptyGlyph,
+              &DynamicGlyphCacheGLTest::evict,
+              &DynamicGlyphCacheGLTest::evictCurrentFrame,
+              &DynamicGlyphCacheGLTest::glyphTooLarge,
+              &DynamicGlyphCacheGLTest::flush});
+}
+
+/* Glyph IDs are 1 for 'a', 2 for 'b' etc., space has an empty glyph and
+   everything else is not in the font. Glyph images are filled with the glyph
+   ID. */
+class TestFont: public Text::AbstractFont {
+    public:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t character) override {
+            if(character == U' ') return 100;
+            if(character >= U'a' && character <= U'z') return character - U'a' + 1;
+            return 0;
+        }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override {
+            std::vector<Vector2i> sizes;
+            for(const char32_t c: characters)
+                sizes.push_back(c == U' ' ? Vector2i{} : glyphSize);
+
+            const std::vector<Range2Di> ranges = cache.reserve(sizes);
+            if(ranges.empty()) return;
+
+            for(std::size_t i = 0; i != characters.size(); ++i) {
+                const UnsignedInt glyph = doGlyphId(characters[i]);
+                cache.insert(glyph, {}, ranges[i]);
+                if(!ranges[i].size().product()) continue;
+
+                Containers::Array<char> data{Containers::ValueInit, std::size_t(glyphSize.product())};
+                for(char& c: data) c = char(glyph);
+                cache.setImage(ranges[i].min(), ImageView2D{
+                    PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm,
+                    glyphSize, data});
+            }
+        }
+
+        Vector2i glyphSize{6, 8};
+};
+
+void DynamicGlyphCacheGLTest::construct() {
+    DynamicGlyphCache cache{{68, 32}, {16, 16}, {1, 1}};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(cache.textureSize(), (Vector2i{68, 32}));
+    CORRADE_COMPARE(cache.slotSize(), (Vector2i{16, 16}));
+    CORRADE_COMPARE(cache.padding(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(cache.slotCount(), 8);
+    CORRADE_COMPARE(cache.usedSlotCount(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), (Vector2i{68, 32}));
+    #endif
+}
+
+void DynamicGlyphCacheGLTest::request() {
+    TestFont font;
+    DynamicGlyphCache cache{{64, 16}, {16, 16}, {1, 1}};
+
+    /* Repeated characters and characters not in the font are not rasterized */
+    CORRADE_VERIFY(cache.request(font, "abba?"));
+    CORRADE_COMPARE(cache.misses(), 2);
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.usedSlotCount(), 2);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+    CORRADE_COMPARE(cache[1].second, Range2Di::fromSize({0, 0}, {8, 10}));
+    CORRADE_COMPARE(cache[2].second, Range2Di::fromSize({16, 0}, {8, 10}));
+
+    /* Glyphs already in the cache are not rasterized again */
+    CORRADE_VERIFY(cache.request(font, "ab"));
+    CORRADE_COMPARE(cache.misses(), 2);
+    CORRADE_COMPARE(cache.hits(), 2);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.misses(), 0);
+    CORRADE_COMPARE(cache.hits(), 0);
+}
+
+void DynamicGlyphCacheGLTest::requestEmptyGlyph() {
+    TestFont font;
+    DynamicGlyphCache cache{{64, 16}, {16, 16}};
+
+    /* Empty glyph doesn't occupy any slot */
+    CORRADE_VERIFY(cache.request(font, " a "));
+    CORRADE_COMPARE(cache.misses(), 2);
+    CORRADE_COMPARE(cache.usedSlotCount(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+
+    CORRADE_VERIFY(cache.request(font, " "));
+    CORRADE_COMPARE(cache.hits(), 1);
+}
+
+void DynamicGlyphCacheGLTest::evict() {
+    TestFont font;
+    DynamicGlyphCache cache{{64, 16}, {16, 16}};
+
+    CORRADE_VERIFY(cache.request(font, "abcd"));
+    cache.flush();
+
+    /* Used in this frame, so it's the most recently used one */
+    CORRADE_VERIFY(cache.request(font, "a"));
+
+    /* The least recently used glyphs get evicted and their slots reused */
+    CORRADE_VERIFY(cache.request(font, "ef"));
+    CORRADE_COMPARE(cache.evictions(), 2);
+    CORRADE_COMPARE(cache.usedSlotCount(), 4);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(cache[5].second, Range2Di::fromSize({16, 0}, {6, 8}));
+    CORRADE_COMPARE(cache[6].second, Range2Di::fromSize({32, 0}, {6, 8}));
+
+    /* Evicted glyphs fall back to "Not Found" glyph */
+    CORRADE_COMPARE(cache[2].second, Range2Di{});
+    CORRADE_COMPARE(cache[3].second, Range2Di{});
+    CORRADE_COMPARE(cache[1].second, Range2Di::fromSize({0, 0}, {6, 8}));
+    CORRADE_COMPARE(cache[4].second, Range2Di::fromSize({48, 0}, {6, 8}));
+
+    /* Requesting an evicted glyph again rasterizes it again */
+    cache.flush();
+    CORRADE_VERIFY(cache.request(font, "b"));
+    CORRADE_COMPARE(cache.misses(), 7);
+    CORRADE_COMPARE(cache.evictions(), 3);
+    CORRADE_COMPARE(cache[4].second, Range2Di{});
+}
+
+void DynamicGlyphCacheGLTest::evictCurrentFrame() {
+    TestFont font;
+    DynamicGlyphCache cache{{64, 16}, {16, 16}};
+
+    /* Glyphs used in this frame are not evicted */
+    CORRADE_VERIFY(cache.request(font, "abc"));
+    CORRADE_VERIFY(!cache.request(font, "de"));
+    CORRADE_COMPARE(cache.evictions(), 0);
+    CORRADE_COMPARE(cache.usedSlotCount(), 3);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+
+    /* But in the next frame they can */
+    cache.flush();
+    CORRADE_VERIFY(cache.request(font, "de"));
+    CORRADE_COMPARE(cache.evictions(), 1);
+    CORRADE_COMPARE(cache.usedSlotCount(), 4);
+}
+
+void DynamicGlyphCacheGLTest::glyphTooLarge() {
+    TestFont font;
+    font.glyphSize = {15, 8};
+    DynamicGlyphCache cache{{64, 16}, {16, 16}, {1, 1}};
+
+    CORRADE_VERIFY(!cache.request(font, "a"));
+    CORRADE_COMPARE(cache.usedSlotCount(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+}
+
+void DynamicGlyphCacheGLTest::flush() {
+    TestFont font;
+    DynamicGlyphCache cache{{64, 32}, {16, 16}};
+
+    CORRADE_VERIFY(cache.request(font, "ab"));
+    cache.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = cache.texture().image(0, {PixelFormat::R8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Glyph pixels are filled with the glyph ID, the rest of the slot is
+       cleared */
+    const char* data = image.data();
+    CORRADE_COMPARE(Int(data[0]), 1);
+    CORRADE_COMPARE(Int(data[7*64 + 5]), 1);
+    CORRADE_COMPARE(Int(data[7*64 + 6]), 0);
+    CORRADE_COMPARE(Int(data[8*64]), 0);
+    CORRADE_COMPARE(Int(data[16]), 2);
+    CORRADE_COMPARE(Int(data[7*64 + 21]), 2);
+    #else
+    CORRADE_SKIP("Texture image queries are not available on OpenGL ES.");
+    #endif
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DynamicGlyphCacheGLTest)
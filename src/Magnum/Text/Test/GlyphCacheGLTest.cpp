@@ -36,12 +36,14 @@ struct GlyphCacheGLTest: GL::OpenGLTester {
     void initialize();
     void access();
     void reserve();
+    void reserveIncremental();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -91,6 +93,24 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache{{64, 64}, {1, 1}};
+
+    std::vector<Range2Di> ranges = cache.reserve({{30, 30}, {14, 14}});
+    CORRADE_COMPARE(ranges, (std::vector<Range2Di>{
+        Range2Di::fromSize({1, 1}, {30, 30}),
+        Range2Di::fromSize({33, 1}, {14, 14})}));
+    for(std::size_t i = 0; i != ranges.size(); ++i)
+        cache.insert(i + 1, {}, ranges[i]);
+    CORRADE_COMPARE(cache.occupancy(), 1096.0f/4096.0f);
+
+    /* Reserving more doesn't overlap the already inserted glyphs */
+    CORRADE_COMPARE(cache.reserve({{14, 14}, {30, 30}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({1, 33}, {14, 14}),
+        Range2Di::fromSize({33, 17}, {30, 30})}));
+    CORRADE_COMPARE(cache.occupancy(), 2192.0f/4096.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
@@ -29,7 +29,9 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/StreamingBuffer.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/LayoutCache.h"
 #include "Magnum/Text/Renderer.h"
 
 namespace Magnum { namespace Text { namespace Test { namespace {
@@ -40,7 +42,9 @@ struct RendererGLTest: GL::OpenGLTester {
     void renderData();
     void renderMesh();
     void renderMeshIndexType();
+    void renderMeshStreaming();
     void mutableText();
+    void mutableTextLayoutCache();
 
     void multiline();
 };
@@ -49,7 +53,9 @@ RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderData,
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
+              &RendererGLTest::renderMeshStreaming,
               &RendererGLTest::mutableText,
+              &RendererGLTest::mutableTextLayoutCache,
 
               &RendererGLTest::multiline});
 }
@@ -260,6 +266,46 @@ void RendererGLTest::renderMeshIndexType() {
     #endif
 }
 
+void RendererGLTest::renderMeshStreaming() {
+    TestFont font;
+    GL::StreamingBuffer vertexBuffer{1024, 2, GL::Buffer::TargetHint::Array},
+        indexBuffer{256, 2, GL::Buffer::TargetHint::ElementArray};
+
+    /* Occupy a part of the frame so the data don't start at zero offset */
+    vertexBuffer.allocate(16);
+    indexBuffer.allocate(8);
+
+    GL::Mesh mesh{NoCreate};
+    Range2D bounds;
+    std::tie(mesh, bounds) = Text::Renderer3D::render(font, nullGlyphCache,
+        0.25f, "abc", vertexBuffer, indexBuffer, Alignment::TopCenter);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(mesh.count(), 18);
+    CORRADE_COMPARE(bounds, Range2D({0.0f, -0.5f}, {5.0f, 1.0f}).translated({-2.5f, -1.0f}));
+
+    /* Space for three glyphs (one per byte) with four vertices of four floats
+       each is reserved; 18 8-bit indices */
+    CORRADE_COMPARE(vertexBuffer.usedSize(), 16 + 3*4*4*4);
+    CORRADE_COMPARE(indexBuffer.usedSize(), 8 + 18);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First frame, so the offset is the same in both persistent and
+       orphaning mode */
+    Containers::Array<char> indices = indexBuffer.buffer().subData(8, 18);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(indices),
+        (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+            0,  1,  2,  1,  3,  2,
+            4,  5,  6,  5,  7,  6,
+            8,  9, 10,  9, 11, 10
+        }}), TestSuite::Compare::Container);
+    #endif
+
+    vertexBuffer.nextFrame();
+    indexBuffer.nextFrame();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void RendererGLTest::mutableText() {
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::map_buffer_range>())
@@ -324,6 +370,122 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
+void RendererGLTest::mutableTextLayoutCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::map_buffer_range>())
+        CORRADE_SKIP(GL::Extensions::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::map_buffer_range>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::OES::mapbuffer>())
+        CORRADE_SKIP("No required extension is supported");
+    #endif
+
+    TestFont font;
+    LayoutCache layoutCache{2};
+    CORRADE_COMPARE(layoutCache.capacity(), 2);
+    CORRADE_COMPARE(layoutCache.size(), 0);
+
+    Text::Renderer2D renderer(font, nullGlyphCache, 0.25f);
+    CORRADE_VERIFY(!renderer.layoutCache());
+    renderer.setLayoutCache(&layoutCache)
+        .reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.layoutCache(), &layoutCache);
+
+    /* First render is a miss */
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(layoutCache.hits(), 0);
+    CORRADE_COMPARE(layoutCache.misses(), 1);
+    CORRADE_COMPARE(layoutCache.size(), 1);
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+
+    renderer.render("ab");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(layoutCache.hits(), 0);
+    CORRADE_COMPARE(layoutCache.misses(), 2);
+    CORRADE_COMPARE(layoutCache.size(), 2);
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+
+    /* Second render of the same text is a hit and gives the same result as
+       in mutableText() */
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(layoutCache.hits(), 1);
+    CORRADE_COMPARE(layoutCache.misses(), 2);
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices).prefix(48),
+        (Containers::Array<Float>{Containers::InPlaceInit, {
+            0.0f,  0.5f, 0.0f, 10.0f,
+            0.0f,  0.0f, 0.0f,  0.0f,
+            0.75f, 0.5f, 6.0f, 10.0f,
+            0.75f, 0.0f, 6.0f,  0.0f,
+
+            1.0f,  0.75f,  6.0f, 10.0f,
+            1.0f, -0.25f,  6.0f,  0.0f,
+            2.5f,  0.75f, 12.0f, 10.0f,
+            2.5f, -0.25f, 12.0f,  0.0f,
+
+            2.75f,  1.0f, 12.0f, 10.0f,
+            2.75f, -0.5f, 12.0f,  0.0f,
+            5.0f,   1.0f, 18.0f, 10.0f,
+            5.0f,  -0.5f, 18.0f,  0.0f
+        }}), TestSuite::Compare::Container);
+    #endif
+
+    /* The cache is full, "ab" is least recently used and gets evicted */
+    renderer.render("c");
+    CORRADE_COMPARE(layoutCache.hits(), 1);
+    CORRADE_COMPARE(layoutCache.misses(), 3);
+    CORRADE_COMPARE(layoutCache.size(), 2);
+    renderer.render("abc");
+    CORRADE_COMPARE(layoutCache.hits(), 2);
+    CORRADE_COMPARE(layoutCache.misses(), 3);
+    renderer.render("ab");
+    CORRADE_COMPARE(layoutCache.hits(), 2);
+    CORRADE_COMPARE(layoutCache.misses(), 4);
+    CORRADE_COMPARE(layoutCache.size(), 2);
+
+    /* Different size or alignment is a different text */
+    Text::Renderer2D another(font, nullGlyphCache, 0.5f);
+    another.setLayoutCache(&layoutCache)
+        .reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+    another.render("ab");
+    CORRADE_COMPARE(layoutCache.hits(), 2);
+    CORRADE_COMPARE(layoutCache.misses(), 5);
+    CORRADE_COMPARE(another.rectangle(), Range2D({0.0f, -0.5f}, {5.0f, 1.5f}));
+    Text::Renderer2D aligned(font, nullGlyphCache, 0.25f, Alignment::LineRight);
+    aligned.setLayoutCache(&layoutCache)
+        .reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+    aligned.render("ab");
+    CORRADE_COMPARE(layoutCache.hits(), 2);
+    CORRADE_COMPARE(layoutCache.misses(), 6);
+    CORRADE_COMPARE(aligned.rectangle(), Range2D({-2.5f, -0.25f}, {0.0f, 0.75f}));
+
+    /* Same parameters in a different renderer is a hit */
+    Text::Renderer2D same(font, nullGlyphCache, 0.25f, Alignment::LineRight);
+    same.setLayoutCache(&layoutCache)
+        .reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+    same.render("ab");
+    CORRADE_COMPARE(layoutCache.hits(), 3);
+    CORRADE_COMPARE(layoutCache.misses(), 6);
+    CORRADE_COMPARE(same.rectangle(), Range2D({-2.5f, -0.25f}, {0.0f, 0.75f}));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    layoutCache.clear();
+    CORRADE_COMPARE(layoutCache.size(), 0);
+    CORRADE_COMPARE(layoutCache.hits(), 3);
+    layoutCache.resetStatistics();
+    CORRADE_COMPARE(layoutCache.hits(), 0);
+    CORRADE_COMPARE(layoutCache.misses(), 0);
+}
+
 void RendererGLTest::multiline() {
     class Layouter: public Text::AbstractLayouter {
         public:
@@ -39,7 +39,9 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
+class DynamicGlyphCache;
 class GlyphCache;
+class LayoutCache;
 
 enum class Alignment: UnsignedByte;
 
@@ -25,36 +25,162 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Utility/Debug.h>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding, const AtlasPackerFlags flags): _size{size}, _padding{padding}, _flags{flags} {
+    clear();
+}
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+void AtlasPacker::clear() {
+    _count = 0;
+    _area = 0;
+    _skyline.clear();
+    if(_size.x() > 0) _skyline.push_back({0, 0, _size.x()});
+}
 
-    std::vector<Range2Di> atlas;
+Float AtlasPacker::occupancy() const {
+    const std::size_t total = std::size_t(_size.x())*std::size_t(_size.y());
+    return total ? Float(Double(_area)/Double(total)) : 0.0f;
+}
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
-        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
-                << "textures. Generated atlas will be empty.";
-        return atlas;
+Containers::Optional<Range2Di> AtlasPacker::add(const Vector2i& size) {
+    /* Textures with zero area don't occupy anything */
+    if(!size.product()) {
+        ++_count;
+        return Range2Di::fromSize({}, size);
+    }
+
+    /* Find the position where the top edge of the texture ends up lowest,
+       preferring the leftmost one. The skyline segments are sorted by X and
+       cover the whole atlas width without gaps. */
+    const bool allowRotation = (_flags & AtlasPackerFlag::AllowRotation) && size.x() != size.y();
+    std::size_t bestSegment = ~std::size_t{};
+    Int bestTop{}, bestX{}, bestY{};
+    bool bestRotated = false;
+    for(std::size_t rotated = 0; rotated != (allowRotation ? 2 : 1); ++rotated) {
+        const Int width = (rotated ? size.y() : size.x()) + 2*_padding.x();
+        const Int height = (rotated ? size.x() : size.y()) + 2*_padding.y();
+
+        for(std::size_t i = 0; i != _skyline.size(); ++i) {
+            const Int x = _skyline[i].x;
+            if(x + width > _size.x()) break;
+
+            /* The texture rests on the highest segment it spans */
+            Int y = 0;
+            for(std::size_t j = i; j != _skyline.size() && _skyline[j].x < x + width; ++j)
+                y = Math::max(y, _skyline[j].y);
+
+            const Int top = y + height;
+            if(top > _size.y()) continue;
+            if(bestSegment == ~std::size_t{} || top < bestTop || (top == bestTop && x < bestX)) {
+                bestSegment = i;
+                bestTop = top;
+                bestX = x;
+                bestY = y;
+                bestRotated = rotated;
+            }
+        }
+    }
+
+    if(bestSegment == ~std::size_t{}) return Containers::NullOpt;
+
+    /* Put a new segment on top of the texture and cut away everything it
+       covers */
+    const Int width = (bestRotated ? size.y() : size.x()) + 2*_padding.x();
+    const Int right = bestX + width;
+    _skyline.insert(_skyline.begin() + bestSegment, Segment{bestX, bestTop, width});
+    const std::size_t next = bestSegment + 1;
+    while(next != _skyline.size() && _skyline[next].x < right) {
+        Segment& segment = _skyline[next];
+        if(segment.x + segment.width <= right) {
+            _skyline.erase(_skyline.begin() + next);
+            continue;
+        }
+
+        segment.width -= right - segment.x;
+        segment.x = right;
+        break;
     }
 
-    /** @todo actual magic implementation, not this joke */
+    /* Merge neighbors of the same height so the skyline doesn't grow
+       indefinitely */
+    for(std::size_t i = bestSegment ? bestSegment - 1 : 0; i + 1 < _skyline.size() && i <= bestSegment + 1; ) {
+        if(_skyline[i].y == _skyline[i + 1].y) {
+            _skyline[i].width += _skyline[i + 1].width;
+            _skyline.erase(_skyline.begin() + i + 1);
+        } else ++i;
+    }
+
+    ++_count;
+    _area += std::size_t(size.x())*std::size_t(size.y());
+    return Range2Di::fromSize(Vector2i{bestX, bestY} + _padding,
+        bestRotated ? Vector2i{size.y(), size.x()} : size);
+}
+
+bool AtlasPacker::addInternal(const std::vector<Vector2i>& sizes, std::vector<Range2Di>& out) {
+    /* Sort the textures by height, tallest first. If rotation is allowed,
+       sort by the longer side as that's what the texture will most probably
+       end up being placed with. */
+    const bool allowRotation = !!(_flags & AtlasPackerFlag::AllowRotation);
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        const Vector2i& sa = sizes[a];
+        const Vector2i& sb = sizes[b];
+        const Int ha = allowRotation ? Math::max(sa.x(), sa.y()) : sa.y();
+        const Int hb = allowRotation ? Math::max(sb.x(), sb.y()) : sb.y();
+        if(ha != hb) return ha > hb;
+        const Int wa = allowRotation ? Math::min(sa.x(), sa.y()) : sa.x();
+        const Int wb = allowRotation ? Math::min(sb.x(), sb.y()) : sb.x();
+        return wa > wb;
+    });
+
+    /* Remember the state so it can be restored if some texture doesn't fit */
+    const std::vector<Segment> skyline = _skyline;
+    const std::size_t count = _count;
+    const std::size_t area = _area;
+
+    out.resize(sizes.size());
+    for(const std::size_t i: order) {
+        Containers::Optional<Range2Di> range = add(sizes[i]);
+        if(!range) {
+            _skyline = skyline;
+            _count = count;
+            _area = area;
+            out.clear();
+            return false;
+        }
+
+        out[i] = *range;
+    }
+
+    return true;
+}
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    std::vector<Range2Di> out;
+    if(!addInternal(sizes, out))
+        Error() << "TextureTools::AtlasPacker::add(): can't fit" << sizes.size()
+                << "textures into remaining space of a" << _size << "atlas";
+    return out;
+}
 
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    if(sizes.empty()) return {};
+
+    AtlasPacker packer{atlasSize, padding};
+    std::vector<Range2Di> atlas;
+    if(!packer.addInternal(sizes, atlas))
+        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size()
+                << "textures. Generated atlas will be empty.";
 
     return atlas;
 }
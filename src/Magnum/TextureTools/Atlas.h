@@ -26,10 +26,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, enum @ref Magnum::TextureTools::AtlasPackerFlag, enum set @ref Magnum::TextureTools::AtlasPackerFlags, function @ref Magnum::TextureTools::atlas()
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Optional.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Vector2.h"
@@ -49,9 +51,130 @@ into required size, empty vector is returned.
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
 padding.
+
+Convenience wrapper around @ref AtlasPacker, see its documentation for
+details about the packing algorithm. Use it directly if you need rotation,
+occupancy information or incremental insertion.
 */
 std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
 
+/**
+@brief Atlas packer flag
+
+@see @ref AtlasPackerFlags, @ref AtlasPacker
+*/
+enum class AtlasPackerFlag: UnsignedByte {
+    /**
+     * Allow rotating the textures by 90° if it results in a tighter packing.
+     * A rotated texture is returned with its size flipped compared to the
+     * size that was passed in.
+     */
+    AllowRotation = 1 << 0
+};
+
+/**
+@brief Atlas packer flags
+
+@see @ref AtlasPacker
+*/
+typedef Containers::EnumSet<AtlasPackerFlag> AtlasPackerFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasPackerFlags)
+
+/**
+@brief Incremental texture atlas packer
+
+Packs rectangles of arbitrary sizes into a fixed-size atlas using the skyline
+bottom-left algorithm. The packer remembers the occupied space, so further
+textures can be added to an existing atlas without touching the textures that
+are already placed in it.
+
+@snippet MagnumTextureTools.cpp AtlasPacker
+
+When adding more textures at once using @ref add(const std::vector<Vector2i>&),
+they are sorted by height first, which results in considerably tighter
+packing than adding them one by one in arbitrary order. If
+@ref AtlasPackerFlag::AllowRotation is set, each texture is placed in the
+orientation that leaves the skyline lowest.
+
+Padding is added twice to each size and the textures are laid out so the
+padding doesn't overlap. Returned ranges are without the padding.
+@see @ref atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         * @param flags     Flags
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = {}, AtlasPackerFlags flags = {});
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Flags */
+        AtlasPackerFlags flags() const { return _flags; }
+
+        /** @brief Count of textures added to the atlas */
+        std::size_t count() const { return _count; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of the area covered by all added textures (without padding)
+         * to the total atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add one texture to the atlas
+         *
+         * Returns region where the texture should be placed or
+         * @ref Corrade::Containers::NullOpt if there's no space left for it.
+         * If @ref AtlasPackerFlag::AllowRotation is set, the returned range
+         * size might be flipped compared to @p size. A texture with zero
+         * area is placed at the origin and doesn't occupy any space.
+         */
+        Containers::Optional<Range2Di> add(const Vector2i& size);
+
+        /**
+         * @brief Add multiple textures to the atlas
+         *
+         * Returns regions where the textures should be placed, in the same
+         * order as @p sizes. If not all textures fit, prints a message to
+         * @ref Corrade::Utility::Error "Error", returns an empty vector and
+         * the packer state is left unchanged.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Clear the atlas
+         *
+         * Marks the whole atlas as free again.
+         */
+        void clear();
+
+    private:
+        struct Segment {
+            Int x, y, width;
+        };
+
+        MAGNUM_LOCAL bool addInternal(const std::vector<Vector2i>& sizes, std::vector<Range2Di>& out);
+
+        friend std::vector<Range2Di> atlas(const Vector2i&, const std::vector<Vector2i>&, const Vector2i&);
+
+        Vector2i _size, _padding;
+        AtlasPackerFlags _flags;
+        std::size_t _count;
+        std::size_t _area;
+        std::vector<Segment> _skyline;
+};
+
 }}
 
 #endif
@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ConvertPixelFormat.h"
+
+#include <cstring>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Implementation/pixelRows.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Count of rows processed by a single work item */
+enum: std::size_t { BlockSize = 16 };
+
+}
+
+bool isPixelFormatConvertible(const PixelFormat format) {
+    switch(format) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::RG8Unorm:
+        case PixelFormat::RGB8Unorm:
+        case PixelFormat::RGBA8Unorm:
+        case PixelFormat::R8Snorm:
+        case PixelFormat::RG8Snorm:
+        case PixelFormat::RGB8Snorm:
+        case PixelFormat::RGBA8Snorm:
+        case PixelFormat::R16Unorm:
+        case PixelFormat::RG16Unorm:
+        case PixelFormat::RGB16Unorm:
+        case PixelFormat::RGBA16Unorm:
+        case PixelFormat::R16Snorm:
+        case PixelFormat::RG16Snorm:
+        case PixelFormat::RGB16Snorm:
+        case PixelFormat::RGBA16Snorm:
+        case PixelFormat::R16F:
+        case PixelFormat::RG16F:
+        case PixelFormat::RGB16F:
+        case PixelFormat::RGBA16F:
+        case PixelFormat::R32F:
+        case PixelFormat::RG32F:
+        case PixelFormat::RGB32F:
+        case PixelFormat::RGBA32F:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Image2D convertPixelFormat(const ImageView2D& image, const PixelFormat format, const PixelConversionFlags flags, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isPixelFormatConvertible(image.format()),
+        "TextureTools::convertPixelFormat(): unsupported input format" << image.format(), Image2D{format});
+    CORRADE_ASSERT(isPixelFormatConvertible(format),
+        "TextureTools::convertPixelFormat(): unsupported output format" << format, Image2D{format});
+
+    /* Output with default four-byte row alignment */
+    const Vector2i size = image.size();
+    const std::size_t outputPixelSize = pixelSize(format);
+    const std::size_t outputStride = Implementation::defaultRowStride(size.x(), outputPixelSize);
+    Containers::Array<char> outputData{Containers::ValueInit, outputStride*std::size_t(size.y())};
+    if(!size.product())
+        return Image2D{format, size, std::move(outputData)};
+
+    Math::Vector2<std::size_t> dataOffset, dataSize;
+    std::tie(dataOffset, dataSize) = image.dataProperties();
+    const char* const inputPixels = image.data() + dataOffset.sum();
+    const std::size_t inputStride = dataSize.x();
+
+    /* Same format and nothing to do, just copy the rows */
+    if(image.format() == format && !flags) {
+        for(std::size_t y = 0; y != std::size_t(size.y()); ++y)
+            std::memcpy(outputData + y*outputStride, inputPixels + y*inputStride, size.x()*outputPixelSize);
+        return Image2D{format, size, std::move(outputData)};
+    }
+
+    const std::size_t blockCount = (size.y() + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(blockCount, threadCount, [&](const std::size_t block) {
+        Containers::Array<Float> row{Containers::NoInit, std::size_t(size.x())*4};
+        const std::size_t end = Math::min((block + 1)*BlockSize, std::size_t(size.y()));
+        for(std::size_t y = block*BlockSize; y != end; ++y) {
+            Implementation::unpackPixels(image.format(), inputPixels + y*inputStride, row, size.x());
+            if(flags & PixelConversionFlag::DecodeSrgb)
+                Implementation::srgbToLinear(row, size.x());
+            if(flags & PixelConversionFlag::PremultiplyAlpha)
+                Implementation::premultiplyAlpha(row, size.x());
+            if(flags & PixelConversionFlag::EncodeSrgb)
+                Implementation::linearToSrgb(row, size.x());
+            Implementation::packPixels(format, row, outputData + y*outputStride, size.x());
+        }
+    });
+
+    return Image2D{format, size, std::move(outputData)};
+}
+
+}}
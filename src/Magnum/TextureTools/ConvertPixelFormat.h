@@ -0,0 +1,120 @@
+#ifndef Magnum_TextureTools_ConvertPixelFormat_h
+#define Magnum_TextureTools_ConvertPixelFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::convertPixelFormat(), @ref Magnum::TextureTools::isPixelFormatConvertible(), enum @ref Magnum::TextureTools::PixelConversionFlag, enum set @ref Magnum::TextureTools::PixelConversionFlags
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Pixel conversion flag
+
+@see @ref PixelConversionFlags, @ref convertPixelFormat()
+*/
+enum class PixelConversionFlag: UnsignedByte {
+    /**
+     * Treat RGB channels of the input as sRGB-encoded and convert them to
+     * linear before doing any other operation. Alpha is always treated as
+     * linear.
+     */
+    DecodeSrgb = 1 << 0,
+
+    /**
+     * Encode RGB channels of the output as sRGB. Alpha is always kept
+     * linear.
+     */
+    EncodeSrgb = 1 << 1,
+
+    /**
+     * Multiply RGB channels with alpha. Done in linear space, after
+     * @ref PixelConversionFlag::DecodeSrgb and before
+     * @ref PixelConversionFlag::EncodeSrgb.
+     */
+    PremultiplyAlpha = 1 << 2
+};
+
+/**
+@brief Pixel conversion flags
+
+@see @ref convertPixelFormat()
+*/
+typedef Containers::EnumSet<PixelConversionFlag> PixelConversionFlags;
+
+CORRADE_ENUMSET_OPERATORS(PixelConversionFlags)
+
+/**
+@brief Whether given pixel format can be converted
+
+Returns @cpp true @ce for the normalized (@ref PixelFormat::RGBA8Unorm,
+@ref PixelFormat::RGBA8Snorm, @ref PixelFormat::RGBA16Unorm,
+@ref PixelFormat::RGBA16Snorm and their one-, two- and three-channel
+variants) and floating-point (@ref PixelFormat::RGBA16F,
+@ref PixelFormat::RGBA32F and their variants) formats, i.e. the ones that can
+be losslessly represented as floats, @cpp false @ce otherwise. Only these are
+accepted by @ref convertPixelFormat(), @ref resample() and
+@ref generateMipmaps(), use this function to validate the formats upfront if
+they come from an untrusted source.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT bool isPixelFormatConvertible(PixelFormat format);
+
+/**
+@brief Convert an image to a different pixel format
+@param image        Input image
+@param format       Output pixel format
+@param flags        Conversion flags
+@param threadCount  Thread count. If set to @cpp 0 @ce, the value of
+    @ref std::thread::hardware_concurrency() is used. Has no effect if Magnum
+    is not built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+Both @p image and @p format are expected to be one of the normalized or
+floating-point formats, see @ref isPixelFormatConvertible(). Each pixel is
+converted to a four-component float color, channels missing in the input are
+set to @cpp 0.0f @ce, alpha to @cpp 1.0f @ce, and channels missing in the
+output are dropped. Values are clamped to the representable range and rounded
+to nearest when converting to normalized formats, half-floats are converted
+using @ref Math::packHalf() and @ref Math::unpackHalf().
+
+Conversion between the same formats with no @p flags is a plain copy. The
+output has row alignment following the default @ref PixelStorage. Rows are
+processed in parallel if Magnum is built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+You can also use the `--format` option of the
+@ref magnum-imageconverter "magnum-imageconverter" utility to do the
+conversion on command-line.
+@see @ref resample(), @ref generateMipmaps()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D convertPixelFormat(const ImageView2D& image, PixelFormat format, PixelConversionFlags flags = {}, UnsignedInt threadCount = 0);
+
+}}
+
+#endif
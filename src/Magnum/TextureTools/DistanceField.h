@@ -79,7 +79,9 @@ and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
 @attention This is a GPU-only implementation, so it expects an active GL
-    context.
+    context. See @ref DistanceFieldCpu for an implementation that doesn't
+    need a GL context and produces the same output except for pixels close
+    to the image border.
 
 @note If internal format of @p output texture is not renderable, this function
     prints a message to error output and does nothing. On desktop OpenGL and
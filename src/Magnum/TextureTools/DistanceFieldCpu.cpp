@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DistanceFieldCpu.h"
+
+#include <cmath>
+#include <tuple>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Count of columns / rows processed by a single work item. Large enough for
+   the scratch allocation to not matter, small enough to balance the work
+   across threads. */
+enum: std::size_t { BlockSize = 32 };
+
+/* Lower envelope of parabolas rooted at (q, f(q)), Felzenszwalb &
+   Huttenlocher. Fills `vertices` and `intersections` that are then walked
+   in the row pass. */
+void lowerEnvelope(const UnsignedInt* const f, const Int size, Int* const vertices, Float* const intersections) {
+    std::size_t k = 0;
+    vertices[0] = 0;
+    intersections[0] = -Constants::inf();
+    intersections[1] = Constants::inf();
+    for(Int q = 1; q < size; ++q) {
+        const Float fq = Float(f[q]);
+        Float s;
+        for(;;) {
+            const Int v = vertices[k];
+            /* ((f(q) + q²) - (f(v) + v²))/(2q - 2v), with the difference of
+               squares factored to avoid overflow for wide images. The first
+               intersection is at -infinity so this never goes below zero. */
+            s = (fq - Float(f[v]) + Float(q - v)*Float(q + v))/Float(2*(q - v));
+            if(s > intersections[k]) break;
+            --k;
+        }
+
+        ++k;
+        vertices[k] = q;
+        intersections[k] = s;
+        intersections[k + 1] = Constants::inf();
+    }
+}
+
+}
+
+DistanceFieldCpu::DistanceFieldCpu(const UnsignedInt radius): _radius{radius} {}
+
+Image2D DistanceFieldCpu::operator()(const ImageView2D& input, const Vector2i& outputSize) {
+    CORRADE_ASSERT(input.format() == PixelFormat::R8Unorm ||
+                   input.format() == PixelFormat::RG8Unorm ||
+                   input.format() == PixelFormat::RGB8Unorm ||
+                   input.format() == PixelFormat::RGBA8Unorm,
+        "TextureTools::DistanceFieldCpu: unsupported input format" << input.format(), Image2D{PixelFormat::R8Unorm});
+
+    /* Output with default four-byte row alignment */
+    const std::size_t outputStride = (std::size_t(outputSize.x()) + 3)/4*4;
+    Containers::Array<char> outputData{Containers::ValueInit, outputStride*std::size_t(outputSize.y())};
+    const Vector2i inputSize = input.size();
+    if(!outputSize.product() || !inputSize.product())
+        return Image2D{PixelFormat::R8Unorm, outputSize, std::move(outputData)};
+
+    /* Input pixel access */
+    Math::Vector2<std::size_t> dataOffset, dataSize;
+    std::tie(dataOffset, dataSize) = input.dataProperties();
+    const char* const inputPixels = input.data() + dataOffset.sum();
+    const std::size_t inputStride = dataSize.x();
+    const std::size_t pixelSize = input.pixelSize();
+    auto isInside = [&](const Int x, const Int y) {
+        return UnsignedByte(inputPixels[inputStride*y + pixelSize*x]) >= 128;
+    };
+
+    /* Input pixels corresponding to output pixels, calculated the same way as
+       in the GL implementation */
+    const Vector2 scaling = Vector2{inputSize}/Vector2{outputSize};
+    _inputColumns.resize(outputSize.x());
+    _inputRows.resize(outputSize.y());
+    for(Int x = 0; x != outputSize.x(); ++x)
+        _inputColumns[x] = Math::min(Int(Float(x)*scaling.x()), inputSize.x() - 1);
+    for(Int y = 0; y != outputSize.y(); ++y)
+        _inputRows[y] = Math::min(Int(Float(y)*scaling.y()), inputSize.y() - 1);
+
+    /* Everything farther than radius + 1 is clamped, same as in the GL
+       implementation that looks only at the neighborhood of given radius.
+       Pixels outside of the image are never considered, so the result matches
+       the GL implementation only for pixels farther than radius from the
+       border, see the class docs for details. Clamping already in the column
+       pass is safe, as the clamped parabola never gets below the clamped
+       final value. */
+    const Int maxDistance = Int(_radius) + 1;
+
+    /* Column pass. For each input column and each output row, calculate
+       distance to the nearest pixel of opposite color in the same column --
+       the distance to the nearest pixel of the same color is always zero.
+       Only rows corresponding to output rows are stored. A block of adjacent
+       columns is processed at once to make the input access cache-friendly. */
+    _columnDistances.resize(std::size_t(outputSize.y())*inputSize.x());
+    const std::size_t columnBlockCount = (std::size_t(inputSize.x()) + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(columnBlockCount, _threadCount, [&](const std::size_t block) {
+        const Int begin = Int(block*BlockSize);
+        const Int count = Math::min(Int(BlockSize), inputSize.x() - begin);
+
+        /* Forward scan, remembering the last black (index 0) and white
+           (index 1) pixel in each column */
+        Int last[BlockSize][2];
+        for(Int c = 0; c != count; ++c)
+            last[c][0] = last[c][1] = -maxDistance;
+        for(Int y = 0, outputY = 0; y != inputSize.y(); ++y) {
+            for(Int c = 0; c != count; ++c)
+                last[c][isInside(begin + c, y)] = y;
+
+            for(; outputY != outputSize.y() && _inputRows[outputY] == y; ++outputY) {
+                UnsignedInt* const out = _columnDistances.data() + std::size_t(outputY)*inputSize.x() + begin;
+                for(Int c = 0; c != count; ++c)
+                    out[c] = UnsignedInt(Math::min(y - last[c][!isInside(begin + c, y)], maxDistance));
+            }
+        }
+
+        /* Backward scan, remembering the next black and white pixel in each
+           column, then squaring the final distance */
+        for(Int c = 0; c != count; ++c)
+            last[c][0] = last[c][1] = inputSize.y() - 1 + maxDistance;
+        for(Int y = inputSize.y() - 1, outputY = outputSize.y() - 1; y >= 0; --y) {
+            for(Int c = 0; c != count; ++c)
+                last[c][isInside(begin + c, y)] = y;
+
+            for(; outputY >= 0 && _inputRows[outputY] == y; --outputY) {
+                UnsignedInt* const out = _columnDistances.data() + std::size_t(outputY)*inputSize.x() + begin;
+                for(Int c = 0; c != count; ++c) {
+                    const UnsignedInt distance = Math::min(out[c], UnsignedInt(Math::min(last[c][!isInside(begin + c, y)] - y, maxDistance)));
+                    out[c] = distance*distance;
+                }
+            }
+        }
+    });
+
+    /* Row pass. For each output row, find the lower envelope of parabolas
+       given by the column distances for both colors and evaluate the one of
+       opposite color at output pixels. */
+    const std::size_t rowBlockCount = (std::size_t(outputSize.y()) + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(rowBlockCount, _threadCount, [&](const std::size_t block) {
+        std::vector<UnsignedInt> f[2]{std::vector<UnsignedInt>(inputSize.x()), std::vector<UnsignedInt>(inputSize.x())};
+        std::vector<Int> vertices[2]{std::vector<Int>(inputSize.x()), std::vector<Int>(inputSize.x())};
+        std::vector<Float> intersections[2]{std::vector<Float>(inputSize.x() + 1), std::vector<Float>(inputSize.x() + 1)};
+        const Int end = Math::min(Int((block + 1)*BlockSize), outputSize.y());
+        for(Int y = Int(block*BlockSize); y != end; ++y) {
+            /* Squared distance to nearest black (index 0) and white (index 1)
+               pixel in each column */
+            const Int inputY = _inputRows[y];
+            const UnsignedInt* const distances = _columnDistances.data() + std::size_t(y)*inputSize.x();
+            for(Int x = 0; x != inputSize.x(); ++x) {
+                const bool inside = isInside(x, inputY);
+                f[inside][x] = 0;
+                f[!inside][x] = distances[x];
+            }
+            for(std::size_t i = 0; i != 2; ++i)
+                lowerEnvelope(f[i].data(), inputSize.x(), vertices[i].data(), intersections[i].data());
+
+            /* Output columns are monotonic, so the envelopes can be walked
+               linearly. Inside pixels look for nearest black pixel, outside
+               for nearest white. */
+            std::size_t k[2]{};
+            UnsignedByte* const out = reinterpret_cast<UnsignedByte*>(outputData.data() + std::size_t(y)*outputStride);
+            for(Int x = 0; x != outputSize.x(); ++x) {
+                const Int q = _inputColumns[x];
+                const bool inside = isInside(q, inputY);
+                const std::size_t i = !inside;
+                while(intersections[i][k[i] + 1] < Float(q)) ++k[i];
+                const Int v = vertices[i][k[i]];
+                const UnsignedInt distanceSquared = Math::min(
+                    UnsignedInt((q - v)*(q - v)) + f[i][v],
+                    UnsignedInt(maxDistance*maxDistance));
+
+                /* Normalized from [-radius-1, radius+1] to [0, 1] the same
+                   way as in the shader */
+                const Float distance = std::sqrt(Float(distanceSquared));
+                out[x] = Math::pack<UnsignedByte>((inside ? 0.5f : -0.5f)*distance/Float(maxDistance) + 0.5f);
+            }
+        }
+    });
+
+    return Image2D{PixelFormat::R8Unorm, outputSize, std::move(outputData)};
+}
+
+}}
@@ -0,0 +1,143 @@
+#ifndef Magnum_TextureTools_DistanceFieldCpu_h
+#define Magnum_TextureTools_DistanceFieldCpu_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureTools::DistanceFieldCpu
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Create a signed distance field on the CPU
+
+CPU counterpart to the GL-based @ref DistanceField, not requiring any GL
+context. Converts a binary black/white image (stored
+in the first channel of @p input) to a signed distance field stored in a
+@ref PixelFormat::R8Unorm image. Value of @cpp 1.0 @ce means that the pixel was
+originally colored white and nearest black pixel is farther than @ref radius(),
+value of @cpp 0.0 @ce means that the pixel was originally black and nearest
+white pixel is farther than @ref radius(). Values around @cpp 0.5 @ce are
+around edges. See @ref DistanceField for more information about the output.
+
+You can also use the @ref magnum-distancefieldconverter "magnum-distancefieldconverter"
+utility with the `--cpu` option to do the conversion on command-line without
+a GL context.
+
+@section TextureTools-DistanceFieldCpu-algorithm The algorithm
+
+Instead of searching the neighborhood of each output pixel like the GL
+implementation does, the distances are calculated using an exact Euclidean
+distance transform separated into a column and a row pass, in time linear to
+the input size and independent on the radius. The column pass calculates,
+for each pixel, the distance to the nearest pixel of opposite color in the
+same column. The row pass then finds the lower envelope of parabolas given by
+the column distances, but only for input rows and columns corresponding to
+output pixels. Distances are clamped to @ref radius() + 1, same as in the GL
+implementation.
+
+@section TextureTools-DistanceFieldCpu-border Image border handling
+
+Pixels outside of the input image are ignored, i.e. the distance is
+calculated only to pixels of opposite color inside the image. The GL
+implementation looks at the whole @ref radius() neighborhood instead and what
+it gets outside of the image depends on the platform --- @glsl texelFetch() @ce
+is undefined for out-of-range coordinates (usually returning zero, which is
+then treated as black), while the ES2 / WebGL 1 fallback samples the texture
+with clamp-to-edge wrapping. Because of that, the output is identical to the
+GL implementation only for output pixels whose corresponding input pixel is
+farther than @ref radius() from the image border. Closer to the border the
+results may differ.
+
+Both passes are independent for each column and row, respectively, and are
+distributed over multiple threads if Magnum is built with
+@ref MAGNUM_BUILD_MULTITHREADED, see @ref setThreadCount().
+
+Based on: *Pedro F. Felzenszwalb, Daniel P. Huttenlocher - Distance
+Transforms of Sampled Functions, Theory of Computing, Vol. 8, 2012,
+http://cs.brown.edu/people/pfelzens/papers/dt-final.pdf*
+
+The internal scratch memory is kept across calls, so it's advised to reuse
+the instance for batch processing.
+@see @ref DistanceField
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT DistanceFieldCpu {
+    public:
+        /**
+         * @brief Constructor
+         * @param radius       Max lookup radius in the input image
+         */
+        explicit DistanceFieldCpu(UnsignedInt radius);
+
+        /** @brief Max lookup radius */
+        UnsignedInt radius() const { return _radius; }
+
+        /** @brief Thread count */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count
+         * @return Reference to self (for method chaining)
+         *
+         * If set to @cpp 0 @ce, the value of
+         * @ref std::thread::hardware_concurrency() is used. Has no effect
+         * if Magnum is not built with @ref MAGNUM_BUILD_MULTITHREADED.
+         * Default is @cpp 0 @ce.
+         */
+        DistanceFieldCpu& setThreadCount(UnsignedInt count) {
+            _threadCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief Calculate the distance field
+         * @param input         Input image
+         * @param outputSize    Output image size
+         *
+         * Expects that @p input is in @ref PixelFormat::R8Unorm,
+         * @ref PixelFormat::RG8Unorm, @ref PixelFormat::RGB8Unorm or
+         * @ref PixelFormat::RGBA8Unorm, only the first channel is taken into
+         * account. Pixels with value @cpp 0.5 @ce and above are treated as
+         * white. The output is in @ref PixelFormat::R8Unorm, with row
+         * alignment following the default @ref PixelStorage.
+         */
+        Image2D operator()(const ImageView2D& input, const Vector2i& outputSize);
+
+    private:
+        UnsignedInt _radius, _threadCount{};
+        std::vector<Int> _inputColumns, _inputRows;
+        std::vector<UnsignedInt> _columnDistances;
+};
+
+}}
+
+#endif
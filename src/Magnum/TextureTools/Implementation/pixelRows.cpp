@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "pixelRows.h"
+
+#include <cmath>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+namespace {
+
+/* The loops below operate on plain arrays with a fixed RGBA layout and no
+   branches depending on the data, so the compiler is able to vectorize them.
+   Half-floats go through the batch conversion functions instead. */
+
+struct Unorm8 {
+    typedef UnsignedByte Type;
+    static Float unpack(Type value) { return Math::unpack<Float>(value); }
+    static Type pack(Float value) {
+        return Type(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+    }
+};
+
+struct Snorm8 {
+    typedef Byte Type;
+    static Float unpack(Type value) { return Math::unpack<Float>(value); }
+    static Type pack(Float value) {
+        const Float scaled = Math::clamp(value, -1.0f, 1.0f)*127.0f;
+        return Type(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+    }
+};
+
+struct Unorm16 {
+    typedef UnsignedShort Type;
+    static Float unpack(Type value) { return Math::unpack<Float>(value); }
+    static Type pack(Float value) {
+        return Type(Math::clamp(value, 0.0f, 1.0f)*65535.0f + 0.5f);
+    }
+};
+
+struct Snorm16 {
+    typedef Short Type;
+    static Float unpack(Type value) { return Math::unpack<Float>(value); }
+    static Type pack(Float value) {
+        const Float scaled = Math::clamp(value, -1.0f, 1.0f)*32767.0f;
+        return Type(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+    }
+};
+
+struct Float16 {
+    typedef UnsignedShort Type;
+};
+
+struct Float32 {
+    typedef Float Type;
+    static Float unpack(Type value) { return value; }
+    static Type pack(Float value) { return value; }
+};
+
+template<class T, std::size_t channels> struct PixelRow {
+    static void unpack(const char* in, Float* out, std::size_t count);
+    static void pack(const Float* in, char* out, std::size_t count);
+};
+
+template<class T, std::size_t channels> void PixelRow<T, channels>::unpack(const char* const in, Float* const out, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        /* The input doesn't need to be aligned */
+        typename T::Type pixel[channels];
+        std::memcpy(pixel, in + i*sizeof(pixel), sizeof(pixel));
+
+        Float* const o = out + i*4;
+        o[0] = T::unpack(pixel[0]);
+        o[1] = channels > 1 ? T::unpack(pixel[channels > 1 ? 1 : 0]) : 0.0f;
+        o[2] = channels > 2 ? T::unpack(pixel[channels > 2 ? 2 : 0]) : 0.0f;
+        o[3] = channels > 3 ? T::unpack(pixel[channels > 3 ? 3 : 0]) : 1.0f;
+    }
+}
+
+template<class T, std::size_t channels> void PixelRow<T, channels>::pack(const Float* const in, char* const out, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        typename T::Type pixel[channels];
+        for(std::size_t c = 0; c != channels; ++c)
+            pixel[c] = T::pack(in[i*4 + c]);
+        std::memcpy(out + i*sizeof(pixel), pixel, sizeof(pixel));
+    }
+}
+
+/* Each channel of the row is converted with a single strided batch call.
+   Half-float pixel data is always at least two-byte aligned, so the row can
+   be accessed directly. */
+template<std::size_t channels> struct PixelRow<Float16, channels> {
+    static void unpack(const char* const in, Float* const out, const std::size_t count) {
+        const auto* const data = reinterpret_cast<const UnsignedShort*>(in);
+        for(std::size_t c = 0; c != channels; ++c)
+            Math::unpackHalfInto(
+                Containers::StridedArrayView<const UnsignedShort>{data + c, count, channels*sizeof(UnsignedShort)},
+                Containers::StridedArrayView<Float>{out + c, count, 4*sizeof(Float)});
+        for(std::size_t i = 0; i != count; ++i)
+            for(std::size_t c = channels; c != 4; ++c)
+                out[i*4 + c] = c == 3 ? 1.0f : 0.0f;
+    }
+
+    static void pack(const Float* const in, char* const out, const std::size_t count) {
+        auto* const data = reinterpret_cast<UnsignedShort*>(out);
+        for(std::size_t c = 0; c != channels; ++c)
+            Math::packHalfInto(
+                Containers::StridedArrayView<const Float>{in + c, count, 4*sizeof(Float)},
+                Containers::StridedArrayView<UnsignedShort>{data + c, count, channels*sizeof(UnsignedShort)});
+    }
+};
+
+/* Scalar equivalents of Color3::fromSrgb() / Color3::toSrgb(), which
+   evaluate the pow() for every channel even if the linear segment is used */
+inline Float fromSrgb(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+inline Float toSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+}
+
+/* Integer formats are not listed here, neither are the implementation-specific
+   and deprecated GL formats, so the switches below can't be exhaustive. Keep
+   in sync with isPixelFormatConvertible() in ConvertPixelFormat.cpp. */
+
+#define _f(function) \
+    _c(R8Unorm, function, Unorm8, 1) \
+    _c(RG8Unorm, function, Unorm8, 2) \
+    _c(RGB8Unorm, function, Unorm8, 3) \
+    _c(RGBA8Unorm, function, Unorm8, 4) \
+    _c(R8Snorm, function, Snorm8, 1) \
+    _c(RG8Snorm, function, Snorm8, 2) \
+    _c(RGB8Snorm, function, Snorm8, 3) \
+    _c(RGBA8Snorm, function, Snorm8, 4) \
+    _c(R16Unorm, function, Unorm16, 1) \
+    _c(RG16Unorm, function, Unorm16, 2) \
+    _c(RGB16Unorm, function, Unorm16, 3) \
+    _c(RGBA16Unorm, function, Unorm16, 4) \
+    _c(R16Snorm, function, Snorm16, 1) \
+    _c(RG16Snorm, function, Snorm16, 2) \
+    _c(RGB16Snorm, function, Snorm16, 3) \
+    _c(RGBA16Snorm, function, Snorm16, 4) \
+    _c(R16F, function, Float16, 1) \
+    _c(RG16F, function, Float16, 2) \
+    _c(RGB16F, function, Float16, 3) \
+    _c(RGBA16F, function, Float16, 4) \
+    _c(R32F, function, Float32, 1) \
+    _c(RG32F, function, Float32, 2) \
+    _c(RGB32F, function, Float32, 3) \
+    _c(RGBA32F, function, Float32, 4)
+#define _c(format, function, type, channels) \
+    case PixelFormat::format: return PixelRow<type, channels>::function(in, out, count);
+
+void unpackPixels(const PixelFormat format, const char* const in, Float* const out, const std::size_t count) {
+    switch(format) {
+        _f(unpack)
+        default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+void packPixels(const PixelFormat format, const Float* const in, char* const out, const std::size_t count) {
+    switch(format) {
+        _f(pack)
+        default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+#undef _c
+#undef _f
+
+void srgbToLinear(Float* const data, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        for(std::size_t c = 0; c != 3; ++c)
+            data[i*4 + c] = fromSrgb(data[i*4 + c]);
+}
+
+void linearToSrgb(Float* const data, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        for(std::size_t c = 0; c != 3; ++c)
+            data[i*4 + c] = toSrgb(data[i*4 + c]);
+}
+
+void premultiplyAlpha(Float* const data, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        for(std::size_t c = 0; c != 3; ++c)
+            data[i*4 + c] *= data[i*4 + 3];
+}
+
+}}}
@@ -0,0 +1,63 @@
+#ifndef Magnum_TextureTools_Implementation_pixelRows_h
+#define Magnum_TextureTools_Implementation_pixelRows_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+/* The formats have to be checked with the public isPixelFormatConvertible()
+   before calling any of these */
+
+/* Unpacks `count` pixels in given format to RGBA floats. Missing color
+   channels are set to 0, missing alpha to 1. */
+void unpackPixels(PixelFormat format, const char* in, Float* out, std::size_t count);
+
+/* Packs `count` RGBA floats to given format, dropping the channels that the
+   format doesn't have. Normalized formats are clamped and rounded to
+   nearest. */
+void packPixels(PixelFormat format, const Float* in, char* out, std::size_t count);
+
+/* In-place conversion of RGB channels of `count` RGBA floats from sRGB to
+   linear and back, alpha is left untouched */
+void srgbToLinear(Float* data, std::size_t count);
+void linearToSrgb(Float* data, std::size_t count);
+
+/* In-place multiplication of RGB channels of `count` RGBA floats with the
+   alpha */
+void premultiplyAlpha(Float* data, std::size_t count);
+
+/* Row stride for given width and pixel size with the default PixelStorage
+   alignment */
+inline std::size_t defaultRowStride(const std::size_t width, const std::size_t pixelSize) {
+    return (width*pixelSize + 3)/4*4;
+}
+
+}}}
+
+#endif
@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+#include "Magnum/TextureTools/Implementation/pixelRows.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Count of rows processed by a single work item */
+enum: std::size_t { BlockSize = 16 };
+
+constexpr Float KaiserRadius = 3.0f;
+constexpr Float KaiserAlpha = 4.0f;
+
+/* Modified Bessel function of the first kind, power series */
+Float besselI0(const Float x) {
+    Float sum = 1.0f, term = 1.0f;
+    for(Int k = 1; term > sum*1.0e-8f; ++k) {
+        const Float t = x/Float(2*k);
+        term *= t*t;
+        sum += term;
+    }
+    return sum;
+}
+
+Float filterRadius(const ResampleFilter filter) {
+    switch(filter) {
+        case ResampleFilter::Box: return 0.5f;
+        case ResampleFilter::Kaiser: return KaiserRadius;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+Float filterWeight(const ResampleFilter filter, const Float x) {
+    switch(filter) {
+        /* Half-open so a pixel on the boundary is not counted twice */
+        case ResampleFilter::Box:
+            return x >= -0.5f && x < 0.5f ? 1.0f : 0.0f;
+        case ResampleFilter::Kaiser: {
+            if(std::abs(x) >= KaiserRadius) return 0.0f;
+            const Float t = x/KaiserRadius;
+            const Float sinc = x == 0.0f ? 1.0f :
+                std::sin(Constants::pi()*x)/(Constants::pi()*x);
+            return sinc*besselI0(KaiserAlpha*std::sqrt(1.0f - t*t))/besselI0(KaiserAlpha);
+        }
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Input pixels and their normalized weights contributing to each output
+   pixel in one dimension, with a fixed count of taps per output pixel to
+   keep the inner loops simple */
+struct Contributions {
+    std::size_t taps;
+    Containers::Array<UnsignedInt> indices;
+    Containers::Array<Float> weights;
+};
+
+Contributions contributions(const Int inputSize, const Int outputSize, const ResampleFilter filter) {
+    /* When downsampling, the filter is stretched to cover all input pixels */
+    const Float scale = Float(inputSize)/Float(outputSize);
+    const Float stretch = Math::max(scale, 1.0f);
+    const Float radius = filterRadius(filter)*stretch;
+
+    Contributions out;
+    out.taps = std::size_t(std::ceil(2.0f*radius)) + 1;
+    out.indices = Containers::Array<UnsignedInt>{Containers::NoInit, out.taps*outputSize};
+    out.weights = Containers::Array<Float>{Containers::NoInit, out.taps*outputSize};
+    for(Int i = 0; i != outputSize; ++i) {
+        const Float center = (Float(i) + 0.5f)*scale;
+        const Int first = Int(std::floor(center - radius));
+        UnsignedInt* const indices = out.indices + i*out.taps;
+        Float* const weights = out.weights + i*out.taps;
+
+        Float sum = 0.0f;
+        for(std::size_t t = 0; t != out.taps; ++t) {
+            const Int j = first + Int(t);
+            indices[t] = UnsignedInt(Math::clamp(j, 0, inputSize - 1));
+            weights[t] = filterWeight(filter, (Float(j) + 0.5f - center)/stretch);
+            sum += weights[t];
+        }
+
+        /* The sum is never zero as the center of the support always falls
+           into the box or the main sinc lobe */
+        for(std::size_t t = 0; t != out.taps; ++t) weights[t] /= sum;
+    }
+
+    return out;
+}
+
+/* Unpacks the image to a tightly packed array of RGBA floats, optionally
+   linearizing sRGB */
+Containers::Array<Float> unpackImage(const ImageView2D& image, const ResampleFlags flags, const UnsignedInt threadCount) {
+    const Vector2i size = image.size();
+    Containers::Array<Float> out{Containers::NoInit, std::size_t(size.product())*4};
+
+    Math::Vector2<std::size_t> dataOffset, dataSize;
+    std::tie(dataOffset, dataSize) = image.dataProperties();
+    const char* const pixels = image.data() + dataOffset.sum();
+    const std::size_t stride = dataSize.x();
+
+    const std::size_t blockCount = (size.y() + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(blockCount, threadCount, [&](const std::size_t block) {
+        const std::size_t end = Math::min((block + 1)*BlockSize, std::size_t(size.y()));
+        for(std::size_t y = block*BlockSize; y != end; ++y) {
+            Float* const row = out + y*size.x()*4;
+            Implementation::unpackPixels(image.format(), pixels + y*stride, row, size.x());
+            if(flags & ResampleFlag::Srgb)
+                Implementation::srgbToLinear(row, size.x());
+        }
+    });
+
+    return out;
+}
+
+/* Packs the floats to an image with default row alignment, optionally
+   encoding sRGB. The input is modified in that case. */
+Image2D packImage(const PixelFormat format, Containers::ArrayView<Float> in, const Vector2i& size, const ResampleFlags flags, const UnsignedInt threadCount) {
+    const std::size_t stride = Implementation::defaultRowStride(size.x(), pixelSize(format));
+    Containers::Array<char> out{Containers::ValueInit, stride*size.y()};
+
+    const std::size_t blockCount = (size.y() + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(blockCount, threadCount, [&](const std::size_t block) {
+        const std::size_t end = Math::min((block + 1)*BlockSize, std::size_t(size.y()));
+        for(std::size_t y = block*BlockSize; y != end; ++y) {
+            Float* const row = in + y*size.x()*4;
+            if(flags & ResampleFlag::Srgb)
+                Implementation::linearToSrgb(row, size.x());
+            Implementation::packPixels(format, row, out + y*stride, size.x());
+        }
+    });
+
+    return Image2D{format, size, std::move(out)};
+}
+
+/* Separable resampling of tightly packed RGBA floats. The inner loops go over
+   all four channels at once, which the compiler can vectorize. */
+Containers::Array<Float> resampleFloat(Containers::Array<Float>&& in, const Vector2i& inputSize, const Vector2i& outputSize, const ResampleFilter filter, const UnsignedInt threadCount) {
+    /* Horizontal pass. With the same width the filter degenerates to
+       identity for both filters, so it can be skipped. */
+    Containers::Array<Float> horizontal;
+    if(inputSize.x() == outputSize.x()) horizontal = std::move(in);
+    else {
+        const Contributions c = contributions(inputSize.x(), outputSize.x(), filter);
+        horizontal = Containers::Array<Float>{Containers::NoInit, std::size_t(outputSize.x()*inputSize.y())*4};
+        const std::size_t blockCount = (inputSize.y() + BlockSize - 1)/BlockSize;
+        Magnum::Implementation::parallelFor(blockCount, threadCount, [&](const std::size_t block) {
+            const std::size_t end = Math::min((block + 1)*BlockSize, std::size_t(inputSize.y()));
+            for(std::size_t y = block*BlockSize; y != end; ++y) {
+                const Float* const inputRow = in + y*inputSize.x()*4;
+                Float* const outputRow = horizontal + y*outputSize.x()*4;
+                for(std::size_t x = 0; x != std::size_t(outputSize.x()); ++x) {
+                    Float pixel[4]{};
+                    for(std::size_t t = 0; t != c.taps; ++t) {
+                        const Float* const inputPixel = inputRow + c.indices[x*c.taps + t]*4;
+                        const Float weight = c.weights[x*c.taps + t];
+                        for(std::size_t i = 0; i != 4; ++i)
+                            pixel[i] += inputPixel[i]*weight;
+                    }
+                    for(std::size_t i = 0; i != 4; ++i)
+                        outputRow[x*4 + i] = pixel[i];
+                }
+            }
+        });
+    }
+
+    /* Vertical pass, accumulating whole rows */
+    if(inputSize.y() == outputSize.y()) return horizontal;
+    const Contributions c = contributions(inputSize.y(), outputSize.y(), filter);
+    const std::size_t rowSize = std::size_t(outputSize.x())*4;
+    Containers::Array<Float> out{Containers::NoInit, rowSize*outputSize.y()};
+    const std::size_t blockCount = (outputSize.y() + BlockSize - 1)/BlockSize;
+    Magnum::Implementation::parallelFor(blockCount, threadCount, [&](const std::size_t block) {
+        const std::size_t end = Math::min((block + 1)*BlockSize, std::size_t(outputSize.y()));
+        for(std::size_t y = block*BlockSize; y != end; ++y) {
+            Float* const outputRow = out + y*rowSize;
+            for(std::size_t i = 0; i != rowSize; ++i) outputRow[i] = 0.0f;
+            for(std::size_t t = 0; t != c.taps; ++t) {
+                const Float* const inputRow = horizontal + c.indices[y*c.taps + t]*rowSize;
+                const Float weight = c.weights[y*c.taps + t];
+                for(std::size_t i = 0; i != rowSize; ++i)
+                    outputRow[i] += inputRow[i]*weight;
+            }
+        }
+    });
+
+    return out;
+}
+
+}
+
+Image2D resample(const ImageView2D& image, const Vector2i& size, const ResampleFilter filter, const ResampleFlags flags, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isPixelFormatConvertible(image.format()),
+        "TextureTools::resample(): unsupported format" << image.format(), Image2D{image.format()});
+
+    if(!size.product()) {
+        Containers::Array<char> data{Containers::ValueInit, Implementation::defaultRowStride(size.x(), image.pixelSize())*size.y()};
+        return Image2D{image.format(), size, std::move(data)};
+    }
+
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::resample(): can't resample an empty image to" << size, Image2D{image.format()});
+
+    Containers::Array<Float> data = resampleFloat(unpackImage(image, flags, threadCount), image.size(), size, filter, threadCount);
+    return packImage(image.format(), data, size, flags, threadCount);
+}
+
+std::vector<Image2D> generateMipmaps(const ImageView2D& image, const ResampleFilter filter, const ResampleFlags flags, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isPixelFormatConvertible(image.format()),
+        "TextureTools::generateMipmaps(): unsupported format" << image.format(), {});
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::generateMipmaps(): can't generate mip levels of an empty image", {});
+
+    std::vector<Image2D> levels;
+    Vector2i size = image.size();
+    Containers::Array<Float> data = unpackImage(image, flags, threadCount);
+    while(size != Vector2i{1}) {
+        const Vector2i levelSize = Math::max(size/2, Vector2i{1});
+        data = resampleFloat(std::move(data), size, levelSize, filter, threadCount);
+        size = levelSize;
+
+        /* Packing modifies the data when encoding sRGB, so pack a copy to
+           have the next level calculated from linear values */
+        if(flags & ResampleFlag::Srgb) {
+            Containers::Array<Float> copy{Containers::NoInit, data.size()};
+            std::copy(data.begin(), data.end(), copy.begin());
+            levels.push_back(packImage(image.format(), copy, size, flags, threadCount));
+        } else levels.push_back(packImage(image.format(), data, size, flags, threadCount));
+    }
+
+    return levels;
+}
+
+}}
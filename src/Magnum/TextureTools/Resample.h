@@ -0,0 +1,136 @@
+#ifndef Magnum_TextureTools_Resample_h
+#define Magnum_TextureTools_Resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::resample(), @ref Magnum::TextureTools::generateMipmaps(), enum @ref Magnum::TextureTools::ResampleFilter, @ref Magnum::TextureTools::ResampleFlag, enum set @ref Magnum::TextureTools::ResampleFlags
+ */
+
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Resampling filter
+
+@see @ref resample(), @ref generateMipmaps()
+*/
+enum class ResampleFilter: UnsignedByte {
+    /**
+     * Box filter. Each output pixel is an average of input pixels it covers,
+     * which for power-of-two mip levels is the classic 2x2 average. When
+     * upsampling, it's equivalent to nearest-neighbor filtering.
+     */
+    Box,
+
+    /**
+     * Kaiser-windowed sinc filter with a radius of three pixels and
+     * @f$ \alpha = 4 @f$. Produces sharper mip levels than
+     * @ref ResampleFilter::Box, at the cost of slight ringing around
+     * high-contrast edges and being several times slower.
+     */
+    Kaiser
+};
+
+/**
+@brief Resampling flag
+
+@see @ref ResampleFlags, @ref resample(), @ref generateMipmaps()
+*/
+enum class ResampleFlag: UnsignedByte {
+    /**
+     * Treat RGB channels of the image as sRGB-encoded. They're converted to
+     * linear before filtering and back to sRGB after, making the filtering
+     * gamma-correct. Alpha is always treated as linear.
+     */
+    Srgb = 1 << 0
+};
+
+/**
+@brief Resampling flags
+
+@see @ref resample(), @ref generateMipmaps()
+*/
+typedef Containers::EnumSet<ResampleFlag> ResampleFlags;
+
+CORRADE_ENUMSET_OPERATORS(ResampleFlags)
+
+/**
+@brief Resample an image
+@param image        Input image
+@param size         Output image size
+@param filter       Filter to use
+@param flags        Resampling flags
+@param threadCount  Thread count. If set to @cpp 0 @ce, the value of
+    @ref std::thread::hardware_concurrency() is used. Has no effect if Magnum
+    is not built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+Expects that @p image is in one of the formats supported by
+@ref convertPixelFormat(), see @ref isPixelFormatConvertible(), and that it's not empty if @p size is not empty.
+The output is in the same format as @p image, with row alignment following the
+default @ref PixelStorage. Pixels outside of the image are treated as a copy of
+the nearest edge pixel.
+
+The filter is separable, pixels are unpacked to four-component floats,
+filtered first horizontally and then vertically, and packed back, with both
+passes distributed over multiple threads if Magnum is built with
+@ref MAGNUM_BUILD_MULTITHREADED.
+@see @ref generateMipmaps()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D resample(const ImageView2D& image, const Vector2i& size, ResampleFilter filter = ResampleFilter::Box, ResampleFlags flags = {}, UnsignedInt threadCount = 0);
+
+/**
+@brief Generate mip levels of an image
+@param image        Input image
+@param filter       Filter to use
+@param flags        Resampling flags
+@param threadCount  Thread count. If set to @cpp 0 @ce, the value of
+    @ref std::thread::hardware_concurrency() is used. Has no effect if Magnum
+    is not built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+Returns all mip levels following @p image, each having half the size of the
+previous one (rounded down, but at least one pixel), down to a 1x1 image. The
+input image itself is not included. Expects that @p image is in one of the
+formats supported by @ref convertPixelFormat(), see
+@ref isPixelFormatConvertible(), and that it's not empty.
+
+Each level is calculated from the previous one using @ref resample(), but
+without packing the intermediate results to @p image format, so precision is
+not lost in the smaller levels.
+
+You can also use the `--mipmaps` option of the
+@ref magnum-imageconverter "magnum-imageconverter" utility to generate the
+mip levels on command-line.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT std::vector<Image2D> generateMipmaps(const ImageView2D& image, ResampleFilter filter = ResampleFilter::Box, ResampleFlags flags = {}, UnsignedInt threadCount = 0);
+
+}}
+
+#endif
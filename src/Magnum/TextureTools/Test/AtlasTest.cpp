@@ -38,13 +38,27 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+
+    void packer();
+    void packerIncremental();
+    void packerIncrementalNoSpace();
+    void packerRotation();
+    void packerZeroSize();
+    void packerClear();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::packer,
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerIncrementalNoSpace,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerZeroSize,
+              &AtlasTest::packerClear});
 }
 
 void AtlasTest::create() {
@@ -56,9 +70,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +84,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -87,10 +101,116 @@ void AtlasTest::createTooSmall() {
     std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
         {8, 16},
         {21, 13},
-        {19, 29}
+        {19, 29},
+        {40, 10}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 4 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packer() {
+    AtlasPacker packer{{64, 64}, {1, 2}};
+    CORRADE_COMPARE(packer.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(packer.padding(), (Vector2i{1, 2}));
+    CORRADE_VERIFY(packer.flags() == AtlasPackerFlags{});
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    Containers::Optional<Range2Di> range = packer.add(Vector2i{30, 12});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({1, 2}, {30, 12}));
+    CORRADE_COMPARE(packer.count(), 1);
+    CORRADE_COMPARE(packer.occupancy(), 360.0f/4096.0f);
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer{{64, 64}};
+
+    CORRADE_COMPARE(packer.add(std::vector<Vector2i>{{16, 16}, {32, 32}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({32, 0}, {16, 16}),
+        Range2Di::fromSize({0, 0}, {32, 32})}));
+    CORRADE_COMPARE(packer.count(), 2);
+    CORRADE_COMPARE(packer.occupancy(), 0.3125f);
+
+    /* The already placed textures are left where they were */
+    CORRADE_COMPARE(packer.add(std::vector<Vector2i>{{16, 16}, {32, 8}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({48, 0}, {16, 16}),
+        Range2Di::fromSize({32, 16}, {32, 8})}));
+    CORRADE_COMPARE(packer.count(), 4);
+    CORRADE_COMPARE(packer.occupancy(), 0.4375f);
+
+    /* The texture lands on top of the lowest place it fits */
+    Containers::Optional<Range2Di> range = packer.add(Vector2i{64, 24});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({0, 32}, {64, 24}));
+    CORRADE_COMPARE(packer.count(), 5);
+}
+
+void AtlasTest::packerIncrementalNoSpace() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_COMPARE(packer.add(std::vector<Vector2i>{{64, 32}}).size(), 1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* The first texture would fit, but the second not, so nothing is added */
+    CORRADE_VERIFY(packer.add(std::vector<Vector2i>{{16, 16}, {64, 48}}).empty());
+    CORRADE_COMPARE(packer.count(), 1);
+    CORRADE_COMPARE(packer.occupancy(), 0.5f);
+    CORRADE_COMPARE(out.str(), "TextureTools::AtlasPacker::add(): can't fit 2 textures into remaining space of a Vector(64, 64) atlas\n");
+
+    CORRADE_VERIFY(!packer.add(Vector2i{65, 1}));
+    Containers::Optional<Range2Di> range = packer.add(Vector2i{64, 32});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({0, 32}, {64, 32}));
+    CORRADE_VERIFY(!packer.add(Vector2i{1, 1}));
+    CORRADE_COMPARE(packer.count(), 2);
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+}
+
+void AtlasTest::packerRotation() {
+    AtlasPacker packer{{80, 16}, {}, AtlasPackerFlag::AllowRotation};
+    CORRADE_VERIFY(packer.flags() == AtlasPackerFlag::AllowRotation);
+
+    /* Both textures get rotated, the returned sizes are flipped */
+    CORRADE_COMPARE(packer.add(std::vector<Vector2i>{{16, 32}, {16, 48}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({48, 0}, {32, 16}),
+        Range2Di::fromSize({0, 0}, {48, 16})}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+
+    /* Without rotation these won't fit */
+    std::ostringstream out;
+    Error redirectError{&out};
+    AtlasPacker packerNoRotation{{80, 16}};
+    CORRADE_VERIFY(packerNoRotation.add(std::vector<Vector2i>{{16, 32}, {16, 48}}).empty());
+}
+
+void AtlasTest::packerZeroSize() {
+    AtlasPacker packer{{16, 16}, {1, 1}};
+
+    /* Zero-area textures don't occupy any space */
+    Containers::Optional<Range2Di> empty = packer.add(Vector2i{0, 5});
+    CORRADE_VERIFY(empty);
+    CORRADE_COMPARE(*empty, Range2Di::fromSize({}, {0, 5}));
+    CORRADE_COMPARE(packer.count(), 1);
+
+    Containers::Optional<Range2Di> range = packer.add(Vector2i{14, 14});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({1, 1}, {14, 14}));
+    CORRADE_COMPARE(packer.count(), 2);
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer{{16, 16}};
+    CORRADE_VERIFY(packer.add(Vector2i{16, 16}));
+    CORRADE_VERIFY(!packer.add(Vector2i{1, 1}));
+
+    packer.clear();
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+    Containers::Optional<Range2Di> range = packer.add(Vector2i{16, 16});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({}, {16, 16}));
 }
 
 }}}}
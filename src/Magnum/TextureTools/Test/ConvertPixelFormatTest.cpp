@@ -0,0 +1,310 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct ConvertPixelFormatTest: TestSuite::Tester {
+    explicit ConvertPixelFormatTest();
+
+    void isConvertible();
+
+    void addChannels();
+    void removeChannels();
+    void unormToFloat();
+    void unormToHalf();
+    void floatToUnorm();
+    void floatToSnorm();
+    void decodeSrgb();
+    void encodeSrgb();
+    void premultiplyAlpha();
+    void sameFormat();
+    void roundTrip();
+    void empty();
+    void unsupportedFormat();
+
+    void benchmark();
+};
+
+constexpr struct {
+    const char* name;
+    UnsignedInt threadCount;
+} RoundTripData[] {
+    {"single thread", 1},
+    {"three threads", 3},
+    {"autodetected thread count", 0}
+};
+
+ConvertPixelFormatTest::ConvertPixelFormatTest() {
+    addTests({&ConvertPixelFormatTest::isConvertible,
+
+              &ConvertPixelFormatTest::addChannels,
+              &ConvertPixelFormatTest::removeChannels,
+              &ConvertPixelFormatTest::unormToFloat,
+              &ConvertPixelFormatTest::unormToHalf,
+              &ConvertPixelFormatTest::floatToUnorm,
+              &ConvertPixelFormatTest::floatToSnorm,
+              &ConvertPixelFormatTest::decodeSrgb,
+              &ConvertPixelFormatTest::encodeSrgb,
+              &ConvertPixelFormatTest::premultiplyAlpha,
+              &ConvertPixelFormatTest::sameFormat});
+
+    addInstancedTests({&ConvertPixelFormatTest::roundTrip},
+        Containers::arraySize(RoundTripData));
+
+    addTests({&ConvertPixelFormatTest::empty,
+              &ConvertPixelFormatTest::unsupportedFormat});
+
+    addBenchmarks({&ConvertPixelFormatTest::benchmark}, 5);
+}
+
+void ConvertPixelFormatTest::isConvertible() {
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::R8Unorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RGB16Snorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RG16F));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RGBA32F));
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::RGBA8UI));
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::R32I));
+    CORRADE_VERIFY(!isPixelFormatConvertible(pixelFormatWrap(0xdead)));
+}
+
+void ConvertPixelFormatTest::addChannels() {
+    /* Two pixels in a row padded to four bytes */
+    const UnsignedByte data[]{
+        10, 20, 30, 40, 50, 60, 0, 0,
+        70, 80, 90, 100, 110, 120, 0, 0
+    };
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGB8Unorm, {2, 2}, data}, PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(output.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(output.size(), (Vector2i{2, 2}));
+
+    /* Alpha is set to 1 */
+    const UnsignedByte expected[]{
+        10, 20, 30, 255, 40, 50, 60, 255,
+        70, 80, 90, 255, 100, 110, 120, 255
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 16),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::removeChannels() {
+    const UnsignedByte data[]{
+        10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120
+    };
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {3, 1}, data}, PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(output.format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(output.size(), (Vector2i{3, 1}));
+
+    /* Row padded to four bytes */
+    CORRADE_COMPARE(output.data().size(), 8);
+    const UnsignedByte expected[]{10, 20, 50, 60, 90, 100};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 6),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::unormToFloat() {
+    const UnsignedShort data[]{65535, 0, 13107, 0};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RG16Unorm, {2, 1}, data}, PixelFormat::RGBA32F);
+    const Float expected[]{1.0f, 0.0f, 0.0f, 1.0f, 0.2f, 0.0f, 0.0f, 1.0f};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<Float>(), 8),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::unormToHalf() {
+    const UnsignedByte data[]{255, 0, 0, 0};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::R8Unorm, {4, 1}, data}, PixelFormat::RG16F);
+    const UnsignedShort expected[]{
+        Math::packHalf(1.0f), 0, 0, 0, 0, 0, 0, 0
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedShort>(), 8),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::floatToUnorm() {
+    /* Out-of-range values are clamped, the rest rounded to nearest */
+    const Float data[]{-0.5f, 0.5f, 1.5f, 0.502f};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA32F, {1, 1}, data}, PixelFormat::RGBA8Unorm);
+    const UnsignedByte expected[]{0, 128, 255, 128};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 4),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::floatToSnorm() {
+    const Float data[]{-0.5f, 0.5f, 1.5f, -1.5f};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA32F, {1, 1}, data}, PixelFormat::RGBA8Snorm);
+    const Byte expected[]{-64, 64, 127, -127};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<Byte>(), 4),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::decodeSrgb() {
+    /* 188 in sRGB is roughly 0.5 in linear, alpha is untouched */
+    const UnsignedByte data[]{188, 0, 255, 188};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, data}, PixelFormat::RGBA8Unorm, PixelConversionFlag::DecodeSrgb);
+    const UnsignedByte expected[]{128, 0, 255, 188};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 4),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::encodeSrgb() {
+    const Float data[]{0.5f, 0.0f, 1.0f, 0.5f};
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA32F, {1, 1}, data}, PixelFormat::RGBA8Unorm, PixelConversionFlag::EncodeSrgb);
+    const UnsignedByte expected[]{188, 0, 255, 128};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 4),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::premultiplyAlpha() {
+    const UnsignedByte data[]{
+        200, 100, 50, 128,
+        188, 188, 188, 128
+    };
+
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, data}, PixelFormat::RGBA8Unorm, PixelConversionFlag::PremultiplyAlpha);
+    Image2D outputSrgb = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, data}, PixelFormat::RGBA8Unorm, PixelConversionFlag::DecodeSrgb|PixelConversionFlag::PremultiplyAlpha|PixelConversionFlag::EncodeSrgb);
+
+    /* The sRGB variant is premultiplied in linear space, so 188 goes to 0.5,
+       then to 0.25 and then back to 138 in sRGB */
+    const UnsignedByte expected[]{
+        100, 50, 25, 128,
+        94, 94, 94, 128
+    };
+    const UnsignedByte expectedSrgb[]{
+        147, 72, 34, 128,
+        138, 138, 138, 128
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 8),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(outputSrgb.data<UnsignedByte>(), 8),
+        Containers::arrayView(expectedSrgb),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::sameFormat() {
+    /* Input with a skip and alignment of 1, should get repacked to the
+       default alignment */
+    const UnsignedByte data[]{
+        0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 2, 3, 4, 5, 6,
+        0, 0, 0, 7, 8, 9, 10, 11, 12
+    };
+
+    Image2D output = convertPixelFormat(ImageView2D{
+        PixelStorage{}.setAlignment(1).setRowLength(3).setSkip({1, 1, 0}),
+        PixelFormat::RGB8Unorm, {2, 2}, data}, PixelFormat::RGB8Unorm);
+    const UnsignedByte expected[]{
+        1, 2, 3, 4, 5, 6, 0, 0,
+        7, 8, 9, 10, 11, 12, 0, 0
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 16),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::roundTrip() {
+    auto&& data = RoundTripData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Width not divisible by four so the rows are padded, height large
+       enough to be split over more threads */
+    const Vector2i size{37, 93};
+    const std::size_t stride = 37*3 + 1;
+    Containers::Array<char> input{Containers::ValueInit, stride*size.y()};
+    for(Int y = 0; y != size.y(); ++y)
+        for(std::size_t x = 0; x != std::size_t(size.x())*3; ++x)
+            input[y*stride + x] = char(x*7 + y*13);
+
+    /* Linear half-floats have enough precision for 8-bit sRGB values */
+    Image2D linear = convertPixelFormat(ImageView2D{PixelFormat::RGB8Unorm, size, input}, PixelFormat::RGBA16F, PixelConversionFlag::DecodeSrgb, data.threadCount);
+    CORRADE_COMPARE(linear.format(), PixelFormat::RGBA16F);
+    CORRADE_COMPARE(linear.size(), size);
+
+    Image2D output = convertPixelFormat(linear, PixelFormat::RGB8Unorm, PixelConversionFlag::EncodeSrgb, data.threadCount);
+    CORRADE_COMPARE(output.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE_AS(output.data(), input, TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::empty() {
+    const char data[4]{};
+    Image2D output = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {0, 1}, data}, PixelFormat::R32F);
+    CORRADE_COMPARE(output.format(), PixelFormat::R32F);
+    CORRADE_COMPARE(output.size(), (Vector2i{0, 1}));
+    CORRADE_VERIFY(!output.data().size());
+}
+
+void ConvertPixelFormatTest::unsupportedFormat() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char data[16]{};
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8UI, {2, 2}, data}, PixelFormat::RGBA8Unorm);
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, PixelFormat::R32UI);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::convertPixelFormat(): unsupported input format PixelFormat::RGBA8UI\n"
+        "TextureTools::convertPixelFormat(): unsupported output format PixelFormat::R32UI\n");
+}
+
+void ConvertPixelFormatTest::benchmark() {
+    const Vector2i size{1024, 1024};
+    Containers::Array<char> input{Containers::ValueInit, std::size_t(size.product())*4};
+    for(std::size_t i = 0; i != input.size(); ++i) input[i] = char(i*7);
+
+    Image2D output{PixelFormat::RGBA16F};
+    CORRADE_BENCHMARK(1)
+        output = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, size, input}, PixelFormat::RGBA16F, PixelConversionFlag::DecodeSrgb);
+
+    CORRADE_COMPARE(output.size(), size);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ConvertPixelFormatTest)
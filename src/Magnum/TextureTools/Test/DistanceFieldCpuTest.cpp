@@ -0,0 +1,219 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DistanceFieldCpuTest: TestSuite::Tester {
+    explicit DistanceFieldCpuTest();
+
+    void construct();
+    void test();
+    void pixelStorage();
+    void emptyOutput();
+    void unsupportedFormat();
+
+    void benchmark();
+};
+
+constexpr struct {
+    const char* name;
+    Vector2i inputSize, outputSize;
+    UnsignedInt radius;
+    UnsignedInt threadCount;
+} TestData[] {
+    {"same size", {48, 40}, {48, 40}, 6, 1},
+    {"downscale", {96, 80}, {24, 20}, 12, 1},
+    {"downscale, non-integer ratio", {97, 79}, {31, 17}, 9, 1},
+    {"upscale", {24, 20}, {53, 41}, 4, 1},
+    {"zero radius", {48, 40}, {24, 20}, 0, 1},
+    {"radius larger than the image", {24, 20}, {24, 20}, 50, 1},
+    {"three threads", {96, 80}, {24, 20}, 12, 3},
+    {"autodetected thread count", {96, 80}, {24, 20}, 12, 0}
+};
+
+DistanceFieldCpuTest::DistanceFieldCpuTest() {
+    addTests({&DistanceFieldCpuTest::construct});
+
+    addInstancedTests({&DistanceFieldCpuTest::test},
+        Containers::arraySize(TestData));
+
+    addTests({&DistanceFieldCpuTest::pixelStorage,
+              &DistanceFieldCpuTest::emptyOutput,
+              &DistanceFieldCpuTest::unsupportedFormat});
+
+    addBenchmarks({&DistanceFieldCpuTest::benchmark}, 5);
+}
+
+/* A few circles and rectangles, with a stripe pattern to have features in
+   every direction */
+Containers::Array<char> generateInput(const Vector2i& size, const std::size_t pixelSize, const std::size_t stride) {
+    Containers::Array<char> data{Containers::ValueInit, stride*size.y()};
+    for(Int y = 0; y != size.y(); ++y) {
+        for(Int x = 0; x != size.x(); ++x) {
+            const Vector2i d1 = Vector2i{x, y} - size/3;
+            const Vector2i d2 = Vector2i{x, y} - size*3/4;
+            const bool inside =
+                d1.dot() < size.product()/12 ||
+                d2.dot() < size.product()/40 ||
+                (x > size.x()*2/3 && y < size.y()/4) ||
+                (x + 2*y) % 23 == 0;
+            /* Values around the threshold to verify it's the same as in the
+               shader */
+            data[y*stride + x*pixelSize] = inside ? '\x80' : '\x7f';
+        }
+    }
+    return data;
+}
+
+/* Brute-force neighborhood search like in the GL implementation, but skipping
+   pixels outside of the image as the CPU implementation does. What the shader
+   gets outside of the image is platform-dependent, so this matches the GL
+   output only for pixels farther than radius from the border. */
+Containers::Array<UnsignedByte> bruteForceSkipOutside(const Containers::ArrayView<const char> data, const Vector2i& inputSize, const Vector2i& outputSize, const Int radius) {
+    auto isInside = [&](const Int x, const Int y) {
+        return UnsignedByte(data[y*inputSize.x() + x]) >= 128;
+    };
+
+    Containers::Array<UnsignedByte> out{Containers::ValueInit, std::size_t(outputSize.product())};
+    const Vector2 scaling = Vector2{inputSize}/Vector2{outputSize};
+    for(Int y = 0; y != outputSize.y(); ++y) {
+        for(Int x = 0; x != outputSize.x(); ++x) {
+            const Vector2i position = Math::min(Vector2i{Vector2{Float(x), Float(y)}*scaling}, inputSize - Vector2i{1});
+            const bool inside = isInside(position.x(), position.y());
+
+            Int minDistanceSquared = (radius + 1)*(radius + 1);
+            for(Int j = -radius; j <= radius; ++j) {
+                for(Int i = -radius; i <= radius; ++i) {
+                    const Vector2i p = position + Vector2i{i, j};
+                    if(p.x() < 0 || p.y() < 0 || p.x() >= inputSize.x() || p.y() >= inputSize.y() || isInside(p.x(), p.y()) == inside) continue;
+                    minDistanceSquared = Math::min(minDistanceSquared, i*i + j*j);
+                }
+            }
+
+            const Float distance = std::sqrt(Float(minDistanceSquared));
+            out[y*outputSize.x() + x] = Math::pack<UnsignedByte>((inside ? 0.5f : -0.5f)*distance/Float(radius + 1) + 0.5f);
+        }
+    }
+
+    return out;
+}
+
+void DistanceFieldCpuTest::construct() {
+    DistanceFieldCpu distanceField{16};
+    CORRADE_COMPARE(distanceField.radius(), 16);
+    CORRADE_COMPARE(distanceField.threadCount(), 0);
+
+    distanceField.setThreadCount(3);
+    CORRADE_COMPARE(distanceField.threadCount(), 3);
+}
+
+void DistanceFieldCpuTest::test() {
+    auto&& data = TestData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Width not divisible by four on purpose, so the default row alignment
+       isn't met */
+    const Containers::Array<char> input = generateInput(data.inputSize, 1, data.inputSize.x());
+    Containers::Array<UnsignedByte> expected = bruteForceSkipOutside(input, data.inputSize, data.outputSize, data.radius);
+
+    Image2D output = DistanceFieldCpu{data.radius}
+        .setThreadCount(data.threadCount)
+        (ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, data.inputSize, input}, data.outputSize);
+    CORRADE_COMPARE(output.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(output.size(), data.outputSize);
+
+    /* Strip the row padding */
+    const std::size_t stride = (data.outputSize.x() + 3)/4*4;
+    CORRADE_COMPARE(output.data().size(), stride*data.outputSize.y());
+    Containers::Array<UnsignedByte> actual{Containers::ValueInit, std::size_t(data.outputSize.product())};
+    for(Int y = 0; y != data.outputSize.y(); ++y)
+        for(Int x = 0; x != data.outputSize.x(); ++x)
+            actual[y*data.outputSize.x() + x] = output.data<UnsignedByte>()[y*stride + x];
+
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::pixelStorage() {
+    /* RGBA input with skip; only the red channel should be taken, the rest is
+       filled with garbage */
+    const Vector2i size{40, 32};
+    Containers::Array<char> red = generateInput(size, 1, size.x());
+    Containers::Array<char> rgba{Containers::ValueInit, std::size_t((size.y() + 2)*size.x()*4)};
+    for(std::size_t i = 0; i != rgba.size(); ++i)
+        rgba[i] = (i % 4) ? '\xff' : '\x00';
+    for(Int y = 0; y != size.y(); ++y)
+        for(Int x = 0; x != size.x(); ++x)
+            rgba[((y + 2)*size.x() + x)*4] = red[y*size.x() + x];
+
+    DistanceFieldCpu distanceField{8};
+    Image2D expected = distanceField(ImageView2D{PixelFormat::R8Unorm, size, red}, {20, 16});
+    Image2D actual = distanceField(ImageView2D{PixelStorage{}.setSkip({0, 2, 0}), PixelFormat::RGBA8Unorm, size, rgba}, {20, 16});
+    CORRADE_COMPARE_AS(actual.data(), expected.data(), TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::emptyOutput() {
+    const char data[4]{};
+    Image2D output = DistanceFieldCpu{4}(ImageView2D{PixelFormat::R8Unorm, {2, 2}, data}, {0, 3});
+    CORRADE_COMPARE(output.size(), (Vector2i{0, 3}));
+    CORRADE_VERIFY(!output.data().size());
+}
+
+void DistanceFieldCpuTest::unsupportedFormat() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char data[8]{};
+    DistanceFieldCpu{4}(ImageView2D{PixelFormat::R16Unorm, {2, 2}, data}, {2, 2});
+    CORRADE_COMPARE(out.str(), "TextureTools::DistanceFieldCpu: unsupported input format PixelFormat::R16Unorm\n");
+}
+
+void DistanceFieldCpuTest::benchmark() {
+    const Vector2i size{1024};
+    const Containers::Array<char> input = generateInput(size, 1, size.x());
+    DistanceFieldCpu distanceField{32};
+
+    Image2D output{PixelFormat::R8Unorm};
+    CORRADE_BENCHMARK(1)
+        output = distanceField(ImageView2D{PixelFormat::R8Unorm, size, input}, {128, 128});
+
+    CORRADE_COMPARE(output.size(), (Vector2i{128, 128}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldCpuTest)
@@ -0,0 +1,359 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct ResampleTest: TestSuite::Tester {
+    explicit ResampleTest();
+
+    void box();
+    void boxNonIntegerRatio();
+    void boxUpsample();
+    void constant();
+    void srgb();
+    void threads();
+    void pixelStorage();
+    void emptyOutput();
+    void emptyInput();
+    void unsupportedFormat();
+
+    void mipmaps();
+    void mipmapsSrgb();
+    void mipmapsEmpty();
+    void mipmapsUnsupportedFormat();
+
+    void benchmark();
+};
+
+constexpr struct {
+    const char* name;
+    ResampleFilter filter;
+    PixelFormat format;
+    Vector2i inputSize, outputSize;
+} ConstantData[] {
+    {"box, downsample", ResampleFilter::Box, PixelFormat::RGBA8Unorm, {37, 21}, {18, 10}},
+    {"box, upsample", ResampleFilter::Box, PixelFormat::RGBA8Unorm, {18, 10}, {37, 21}},
+    {"Kaiser, downsample", ResampleFilter::Kaiser, PixelFormat::RGBA8Unorm, {37, 21}, {18, 10}},
+    {"Kaiser, downsample, 16-bit", ResampleFilter::Kaiser, PixelFormat::RG16Unorm, {37, 21}, {7, 3}},
+    {"Kaiser, upsample", ResampleFilter::Kaiser, PixelFormat::RGBA8Unorm, {18, 10}, {37, 21}}
+};
+
+constexpr struct {
+    const char* name;
+    ResampleFilter filter;
+    UnsignedInt threadCount;
+} ThreadsData[] {
+    {"box, three threads", ResampleFilter::Box, 3},
+    {"box, autodetected thread count", ResampleFilter::Box, 0},
+    {"Kaiser, three threads", ResampleFilter::Kaiser, 3},
+    {"Kaiser, autodetected thread count", ResampleFilter::Kaiser, 0}
+};
+
+constexpr struct {
+    const char* name;
+    ResampleFilter filter;
+} BenchmarkData[] {
+    {"box", ResampleFilter::Box},
+    {"Kaiser", ResampleFilter::Kaiser}
+};
+
+ResampleTest::ResampleTest() {
+    addTests({&ResampleTest::box,
+              &ResampleTest::boxNonIntegerRatio,
+              &ResampleTest::boxUpsample});
+
+    addInstancedTests({&ResampleTest::constant},
+        Containers::arraySize(ConstantData));
+
+    addTests({&ResampleTest::srgb});
+
+    addInstancedTests({&ResampleTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&ResampleTest::pixelStorage,
+              &ResampleTest::emptyOutput,
+              &ResampleTest::emptyInput,
+              &ResampleTest::unsupportedFormat,
+
+              &ResampleTest::mipmaps,
+              &ResampleTest::mipmapsSrgb,
+              &ResampleTest::mipmapsEmpty,
+              &ResampleTest::mipmapsUnsupportedFormat});
+
+    addInstancedBenchmarks({&ResampleTest::benchmark}, 5,
+        Containers::arraySize(BenchmarkData));
+}
+
+/* Deterministic noise */
+Containers::Array<char> generateInput(const Vector2i& size, const std::size_t pixelSize) {
+    const std::size_t stride = (size.x()*pixelSize + 3)/4*4;
+    Containers::Array<char> data{Containers::ValueInit, stride*size.y()};
+    for(Int y = 0; y != size.y(); ++y)
+        for(std::size_t x = 0; x != size.x()*pixelSize; ++x)
+            data[y*stride + x] = char((x*7 + y*13) ^ (x >> 3));
+    return data;
+}
+
+void ResampleTest::box() {
+    const UnsignedByte data[]{
+        0, 10, 20, 30,
+        40, 50, 60, 70
+    };
+
+    Image2D output = resample(ImageView2D{PixelFormat::R8Unorm, {4, 2}, data}, {2, 1});
+    CORRADE_COMPARE(output.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(output.size(), (Vector2i{2, 1}));
+
+    /* Averages of 2x2 blocks */
+    const UnsignedByte expected[]{25, 45};
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 2),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ResampleTest::boxNonIntegerRatio() {
+    const UnsignedByte data[]{
+        0, 10, 20, 0,
+        40, 50, 60, 0,
+        80, 90, 100, 0
+    };
+
+    /* All nine pixels are averaged */
+    Image2D output = resample(ImageView2D{PixelFormat::R8Unorm, {3, 3}, data}, {1, 1});
+    CORRADE_COMPARE(output.size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(output.data<UnsignedByte>()[0], 50);
+}
+
+void ResampleTest::boxUpsample() {
+    const UnsignedByte data[]{
+        10, 20, 0, 0,
+        30, 40, 0, 0
+    };
+
+    /* Equivalent to nearest-neighbor filtering */
+    Image2D output = resample(ImageView2D{PixelFormat::R8Unorm, {2, 2}, data}, {4, 3});
+    const UnsignedByte expected[]{
+        10, 10, 20, 20,
+        10, 10, 20, 20,
+        30, 30, 40, 40
+    };
+    CORRADE_COMPARE_AS(Containers::arrayView(output.data<UnsignedByte>(), 12),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void ResampleTest::constant() {
+    auto&& data = ConstantData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Since the weights are normalized, a constant image stays constant
+       regardless of the filter, even on the edges */
+    const std::size_t pixelSize = Magnum::pixelSize(data.format);
+    const std::size_t stride = (data.inputSize.x()*pixelSize + 3)/4*4;
+    Containers::Array<char> input{Containers::ValueInit, stride*data.inputSize.y()};
+    for(Int y = 0; y != data.inputSize.y(); ++y)
+        for(std::size_t x = 0; x != data.inputSize.x()*pixelSize; ++x)
+            input[y*stride + x] = '\x4d';
+
+    Image2D output = resample(ImageView2D{data.format, data.inputSize, input}, data.outputSize, data.filter);
+    CORRADE_COMPARE(output.format(), data.format);
+    CORRADE_COMPARE(output.size(), data.outputSize);
+
+    const std::size_t outputStride = (data.outputSize.x()*pixelSize + 3)/4*4;
+    Containers::Array<char> expected{Containers::ValueInit, outputStride*data.outputSize.y()};
+    for(Int y = 0; y != data.outputSize.y(); ++y)
+        for(std::size_t x = 0; x != data.outputSize.x()*pixelSize; ++x)
+            expected[y*outputStride + x] = '\x4d';
+    CORRADE_COMPARE_AS(output.data(), expected, TestSuite::Compare::Container);
+}
+
+void ResampleTest::srgb() {
+    /* Black and white checkerboard with half-transparent pixels. Averaging
+       in linear space gives 0.5, which is 188 in sRGB. Alpha is not affected
+       by the sRGB conversion. */
+    const UnsignedByte data[]{
+        0, 0, 0, 255, 255, 255, 255, 0,
+        255, 255, 255, 0, 0, 0, 0, 255
+    };
+
+    Image2D linear = resample(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, {1, 1});
+    Image2D srgb = resample(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, {1, 1}, ResampleFilter::Box, ResampleFlag::Srgb);
+
+    const UnsignedByte expectedLinear[]{128, 128, 128, 128};
+    const UnsignedByte expectedSrgb[]{188, 188, 188, 128};
+    CORRADE_COMPARE_AS(Containers::arrayView(linear.data<UnsignedByte>(), 4),
+        Containers::arrayView(expectedLinear),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(srgb.data<UnsignedByte>(), 4),
+        Containers::arrayView(expectedSrgb),
+        TestSuite::Compare::Container);
+}
+
+void ResampleTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The result should not depend on how the work is distributed */
+    const Vector2i size{97, 83};
+    Containers::Array<char> input = generateInput(size, 3);
+    const ImageView2D image{PixelFormat::RGB8Unorm, size, input};
+
+    Image2D expected = resample(image, {31, 47}, data.filter, {}, 1);
+    Image2D actual = resample(image, {31, 47}, data.filter, {}, data.threadCount);
+    CORRADE_COMPARE_AS(actual.data(), expected.data(), TestSuite::Compare::Container);
+}
+
+void ResampleTest::pixelStorage() {
+    /* Same data in the middle of a larger RGBA image, should give the same
+       result */
+    const Vector2i size{17, 13};
+    Containers::Array<char> input = generateInput(size, 4);
+    Containers::Array<char> larger{Containers::ValueInit, std::size_t(20*16*4)};
+    for(Int y = 0; y != size.y(); ++y)
+        for(std::size_t x = 0; x != std::size_t(size.x())*4; ++x)
+            larger[((y + 2)*20 + 1)*4 + x] = input[y*size.x()*4 + x];
+
+    Image2D expected = resample(ImageView2D{PixelFormat::RGBA8Unorm, size, input}, {8, 6}, ResampleFilter::Kaiser);
+    Image2D actual = resample(ImageView2D{
+        PixelStorage{}.setRowLength(20).setSkip({1, 2, 0}),
+        PixelFormat::RGBA8Unorm, size, larger}, {8, 6}, ResampleFilter::Kaiser);
+    CORRADE_COMPARE_AS(actual.data(), expected.data(), TestSuite::Compare::Container);
+}
+
+void ResampleTest::emptyOutput() {
+    const char data[4]{};
+    Image2D output = resample(ImageView2D{PixelFormat::R8Unorm, {2, 2}, data}, {0, 3});
+    CORRADE_COMPARE(output.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(output.size(), (Vector2i{0, 3}));
+    CORRADE_VERIFY(!output.data().size());
+}
+
+void ResampleTest::emptyInput() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    resample(ImageView2D{PixelFormat::R8Unorm, {2, 0}, nullptr}, {1, 1});
+    CORRADE_COMPARE(out.str(), "TextureTools::resample(): can't resample an empty image to Vector(1, 1)\n");
+}
+
+void ResampleTest::unsupportedFormat() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char data[16]{};
+    resample(ImageView2D{PixelFormat::RGBA8UI, {2, 2}, data}, {1, 1});
+    CORRADE_COMPARE(out.str(), "TextureTools::resample(): unsupported format PixelFormat::RGBA8UI\n");
+}
+
+void ResampleTest::mipmaps() {
+    const Vector2i size{37, 21};
+    Containers::Array<char> input = generateInput(size, 2);
+    const ImageView2D image{PixelFormat::RG8Unorm, size, input};
+
+    std::vector<Image2D> levels = generateMipmaps(image, ResampleFilter::Kaiser);
+    CORRADE_COMPARE(levels.size(), 5);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{18, 10}));
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{9, 5}));
+    CORRADE_COMPARE(levels[2].size(), (Vector2i{4, 2}));
+    CORRADE_COMPARE(levels[3].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(levels[4].size(), (Vector2i{1, 1}));
+    for(const Image2D& level: levels)
+        CORRADE_COMPARE(level.format(), PixelFormat::RG8Unorm);
+
+    /* The first level is the same as when resampling directly */
+    Image2D first = resample(image, {18, 10}, ResampleFilter::Kaiser);
+    CORRADE_COMPARE_AS(levels[0].data(), first.data(), TestSuite::Compare::Container);
+}
+
+void ResampleTest::mipmapsSrgb() {
+    /* Black and white 4x4 checkerboard, each level should be uniform 0.5 in
+       linear space */
+    const UnsignedByte data[]{
+        0, 255, 0, 255,
+        255, 0, 255, 0,
+        0, 255, 0, 255,
+        255, 0, 255, 0
+    };
+
+    std::vector<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {4, 4}, data}, ResampleFilter::Box, ResampleFlag::Srgb);
+    CORRADE_COMPARE(levels.size(), 2);
+
+    const UnsignedByte expected[]{188, 188, 0, 0, 188, 188, 0, 0};
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayView(levels[0].data<UnsignedByte>(), 8),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* The second level is calculated from linear values, not from the sRGB
+       ones */
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[1].data<UnsignedByte>()[0], 188);
+}
+
+void ResampleTest::mipmapsEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {0, 2}, nullptr});
+    CORRADE_COMPARE(out.str(), "TextureTools::generateMipmaps(): can't generate mip levels of an empty image\n");
+}
+
+void ResampleTest::mipmapsUnsupportedFormat() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char data[16]{};
+    generateMipmaps(ImageView2D{PixelFormat::RGBA8I, {2, 2}, data});
+    CORRADE_COMPARE(out.str(), "TextureTools::generateMipmaps(): unsupported format PixelFormat::RGBA8I\n");
+}
+
+void ResampleTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector2i size{512, 512};
+    Containers::Array<char> input = generateInput(size, 4);
+
+    std::vector<Image2D> levels;
+    CORRADE_BENCHMARK(1)
+        levels = generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, size, input}, data.filter, ResampleFlag::Srgb);
+
+    CORRADE_COMPARE(levels.size(), 9);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleTest)
@@ -34,6 +34,7 @@
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/TextureTools/DistanceField.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -87,8 +88,8 @@ information.
 
 @code{.sh}
 magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER]
-    [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N
-    [--] input output
+    [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N]
+    --output-size "X Y" --radius N [--] input output
 @endcode
 
 Arguments:
@@ -101,6 +102,11 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--cpu` --- calculate the distance field on the CPU using
+    @ref TextureTools::DistanceFieldCpu instead of the GPU, without creating
+    a GL context
+-   `--threads N` --- thread count for the `--cpu` calculation (default:
+    @cpp 0 @ce, meaning the hardware thread count)
 -   `--output-size "X Y"` --- size of output image
 -   `--radius N` --- distance field computation radius
 -   `--magnum-...` --- engine-specific options (see
@@ -113,6 +119,11 @@ The resulting image can be then used with @ref Shaders::DistanceFieldVector
 shader. See also @ref TextureTools::distanceField() for more information about
 the algorithm and parameters.
 
+The `--cpu` option makes it possible to use the utility on machines without
+any GPU or display available. Note that the utility still needs to be built
+with a windowless application available, a context just isn't created in that
+case.
+
 @section magnum-distancefield-example Example usage
 
 @code{.sh}
@@ -143,13 +154,15 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        .addBooleanOption("cpu").setHelp("cpu", "calculate the distance field on the CPU without creating a GL context")
+        .addOption("threads", "0").setHelp("threads", "thread count for the CPU calculation, 0 for hardware thread count", "N")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -187,27 +200,40 @@ int DistanceFieldConverter::exec() {
         return 4;
     }
 
-    /* Input texture */
-    GL::Texture2D input;
-    input.setMinificationFilter(SamplerFilter::Linear)
-        .setMagnificationFilter(SamplerFilter::Linear)
-        .setWrapping(SamplerWrapping::ClampToEdge)
-        .setStorage(1, internalFormat, image->size())
-        .setSubImage(0, {}, *image);
-
-    /* Output texture */
-    GL::Texture2D output;
-    output.setStorage(1, GL::TextureFormat::R8, args.value<Vector2i>("output-size"));
-
-    CORRADE_INTERNAL_ASSERT(GL::Renderer::error() == GL::Renderer::Error::NoError);
+    const Vector2i outputSize = args.value<Vector2i>("output-size");
+    const UnsignedInt radius = args.value<UnsignedInt>("radius");
+    Image2D result{PixelFormat::R8Unorm};
 
-    /* Do it */
-    Debug() << "Converting image of size" << image->size() << "to distance field...";
-    TextureTools::DistanceField{args.value<UnsignedInt>("radius")}(input, output, {{}, args.value<Vector2i>("output-size")}, image->size());
+    /* Do it on the CPU */
+    if(args.isSet("cpu")) {
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        result = TextureTools::DistanceFieldCpu{radius}
+            .setThreadCount(args.value<UnsignedInt>("threads"))
+            (*image, outputSize);
+
+    /* Do it on the GPU */
+    } else {
+        /* Input texture */
+        GL::Texture2D input;
+        input.setMinificationFilter(SamplerFilter::Linear)
+            .setMagnificationFilter(SamplerFilter::Linear)
+            .setWrapping(SamplerWrapping::ClampToEdge)
+            .setStorage(1, internalFormat, image->size())
+            .setSubImage(0, {}, *image);
+
+        /* Output texture */
+        GL::Texture2D output;
+        output.setStorage(1, GL::TextureFormat::R8, outputSize);
+
+        CORRADE_INTERNAL_ASSERT(GL::Renderer::error() == GL::Renderer::Error::NoError);
+
+        Debug() << "Converting image of size" << image->size() << "to distance field...";
+        TextureTools::DistanceField{radius}(input, output, {{}, outputSize}, image->size());
+
+        output.image(0, result);
+    }
 
     /* Save image */
-    Image2D result{PixelFormat::R8Unorm};
-    output.image(0, result);
     if(!converter->exportToFile(result, args.value("output"))) {
         Error() << "Cannot save file" << args.value("output");
         return 5;
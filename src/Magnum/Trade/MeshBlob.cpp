@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlob.h"
+
+#include <cstring>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+static_assert(sizeof(MeshBlobHeader) == 48, "improper size of MeshBlobHeader");
+
+namespace {
+
+std::size_t alignedSize(const std::size_t size) {
+    return (size + MeshBlobAlignment - 1)/MeshBlobAlignment*MeshBlobAlignment;
+}
+
+template<class T> char* copyArray(char* out, const std::vector<T>& array) {
+    if(!array.empty()) std::memcpy(out, array.data(), array.size()*sizeof(T));
+    return out + alignedSize(array.size()*sizeof(T));
+}
+
+}
+
+Containers::Array<char> serializeMeshBlob(const MeshData3D& mesh) {
+    const std::size_t vertexCount = mesh.positions(0).size();
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        CORRADE_ASSERT(mesh.positions(i).size() == vertexCount,
+            "Trade::serializeMeshBlob(): expected" << vertexCount << "items in position array" << i << "but got" << mesh.positions(i).size(), {});
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        CORRADE_ASSERT(mesh.normals(i).size() == vertexCount,
+            "Trade::serializeMeshBlob(): expected" << vertexCount << "items in normal array" << i << "but got" << mesh.normals(i).size(), {});
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        CORRADE_ASSERT(mesh.textureCoords2D(i).size() == vertexCount,
+            "Trade::serializeMeshBlob(): expected" << vertexCount << "items in texture coordinate array" << i << "but got" << mesh.textureCoords2D(i).size(), {});
+    for(UnsignedInt i = 0; i != mesh.colorArrayCount(); ++i)
+        CORRADE_ASSERT(mesh.colors(i).size() == vertexCount,
+            "Trade::serializeMeshBlob(): expected" << vertexCount << "items in color array" << i << "but got" << mesh.colors(i).size(), {});
+    #endif
+
+    const std::size_t indexCount = mesh.isIndexed() ? mesh.indices().size() : 0;
+    const std::size_t dataSize = alignedSize(sizeof(MeshBlobHeader)) +
+        alignedSize(indexCount*sizeof(UnsignedInt)) +
+        (mesh.positionArrayCount() + mesh.normalArrayCount())*alignedSize(vertexCount*sizeof(Vector3)) +
+        mesh.textureCoords2DArrayCount()*alignedSize(vertexCount*sizeof(Vector2)) +
+        mesh.colorArrayCount()*alignedSize(vertexCount*sizeof(Color4));
+
+    /* Zero-initialized so the padding is deterministic */
+    Containers::Array<char> out{Containers::ValueInit, dataSize};
+
+    MeshBlobHeader& header = *reinterpret_cast<MeshBlobHeader*>(out.data());
+    std::memcpy(header.signature, MeshBlobSignature, sizeof(header.signature));
+    header.version = MeshBlobVersion;
+    header.headerSize = sizeof(MeshBlobHeader);
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.indexCount = indexCount;
+    header.vertexCount = vertexCount;
+    header.positionArrayCount = mesh.positionArrayCount();
+    header.normalArrayCount = mesh.normalArrayCount();
+    header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+    header.colorArrayCount = mesh.colorArrayCount();
+    header.dataSize = dataSize;
+
+    char* data = out.data() + alignedSize(sizeof(MeshBlobHeader));
+    if(indexCount) data = copyArray(data, mesh.indices());
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        data = copyArray(data, mesh.positions(i));
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        data = copyArray(data, mesh.normals(i));
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        data = copyArray(data, mesh.textureCoords2D(i));
+    for(UnsignedInt i = 0; i != mesh.colorArrayCount(); ++i)
+        data = copyArray(data, mesh.colors(i));
+    CORRADE_INTERNAL_ASSERT(data == out.end());
+
+    return out;
+}
+
+}}
@@ -0,0 +1,115 @@
+#ifndef Magnum_Trade_MeshBlob_h
+#define Magnum_Trade_MeshBlob_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshBlobHeader, function @ref Magnum::Trade::serializeMeshBlob()
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob header
+
+Binary mesh blob is a compact representation of @ref MeshData3D that can be
+used directly from memory without any parsing. It's produced by
+@ref serializeMeshBlob() and imported by the
+@ref MeshBlobImporter "MeshBlobImporter" plugin.
+
+The blob starts with this header, followed by the index array and then by all
+attribute arrays in order --- positions, normals, 2D texture coordinates and
+colors --- with @ref vertexCount items each. Indices are stored as
+@ref Magnum::UnsignedInt "UnsignedInt", positions and normals as
+@ref Magnum::Vector3 "Vector3", texture coordinates as
+@ref Magnum::Vector2 "Vector2" and colors as @ref Magnum::Color4 "Color4".
+Each array starts at an offset aligned to @ref MeshBlobAlignment bytes, with
+zero padding in between. The data are stored in machine endianness, blobs are
+thus not portable between platforms of different endianness.
+*/
+struct MeshBlobHeader {
+    /** @brief Signature, equal to @ref MeshBlobSignature */
+    char signature[4];
+
+    /** @brief Format version, equal to @ref MeshBlobVersion */
+    UnsignedShort version;
+
+    /** @brief Header size in bytes */
+    UnsignedShort headerSize;
+
+    /** @brief Mesh primitive, stored as @ref MeshPrimitive */
+    UnsignedInt primitive;
+
+    /** @brief Index count, @cpp 0 @ce for non-indexed meshes */
+    UnsignedInt indexCount;
+
+    /** @brief Vertex count in each attribute array */
+    UnsignedInt vertexCount;
+
+    /** @brief Position array count */
+    UnsignedInt positionArrayCount;
+
+    /** @brief Normal array count */
+    UnsignedInt normalArrayCount;
+
+    /** @brief 2D texture coordinate array count */
+    UnsignedInt textureCoords2DArrayCount;
+
+    /** @brief Color array count */
+    UnsignedInt colorArrayCount;
+
+    /** @brief Reserved, set to @cpp 0 @ce */
+    UnsignedInt reserved;
+
+    /** @brief Size of the whole blob including the header, in bytes */
+    UnsignedLong dataSize;
+};
+
+/** @brief Mesh blob signature */
+constexpr const char MeshBlobSignature[4]{'M', 'B', 'L', 'B'};
+
+/** @brief Mesh blob format version */
+constexpr UnsignedShort MeshBlobVersion = 1;
+
+/** @brief Alignment of arrays in the mesh blob */
+constexpr std::size_t MeshBlobAlignment = 16;
+
+/**
+@brief Serialize mesh data into a binary blob
+
+Expects that all attribute arrays have the same size. Importer state is not
+saved. See @ref MeshBlobHeader for the format description.
+*/
+MAGNUM_TRADE_EXPORT Containers::Array<char> serializeMeshBlob(const MeshData3D& mesh);
+
+}}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MeshBlob.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MeshBlobTest: TestSuite::Tester {
+    explicit MeshBlobTest();
+
+    void serialize();
+    void serializeNonIndexed();
+    void serializeWrongArraySize();
+};
+
+MeshBlobTest::MeshBlobTest() {
+    addTests({&MeshBlobTest::serialize,
+              &MeshBlobTest::serializeNonIndexed,
+              &MeshBlobTest::serializeWrongArraySize});
+}
+
+using namespace Math::Literals;
+
+void MeshBlobTest::serialize() {
+    Containers::Array<char> data = serializeMeshBlob(MeshData3D{
+        MeshPrimitive::Lines, {0, 1, 2, 1, 2},
+        {{{0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}, {-2.0f, 3.5f, 0.0f}}},
+        {{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}}},
+        {{0xff3366_rgbf, 0x33ff66cc_rgbaf, 0x6633ff_rgbf}}});
+
+    /* Header, 5 indices padded to 32 bytes, 2x 3 Vector3 padded to 48 bytes,
+       3 Vector2 padded to 32 bytes and 3 Color4 */
+    CORRADE_COMPARE(data.size(), 48 + 32 + 2*48 + 32 + 48);
+
+    const MeshBlobHeader& header = *reinterpret_cast<const MeshBlobHeader*>(data.data());
+    CORRADE_COMPARE(std::string(header.signature, 4), "MBLB");
+    CORRADE_COMPARE(header.version, MeshBlobVersion);
+    CORRADE_COMPARE(header.headerSize, sizeof(MeshBlobHeader));
+    CORRADE_COMPARE(MeshPrimitive(header.primitive), MeshPrimitive::Lines);
+    CORRADE_COMPARE(header.indexCount, 5);
+    CORRADE_COMPARE(header.vertexCount, 3);
+    CORRADE_COMPARE(header.positionArrayCount, 1);
+    CORRADE_COMPARE(header.normalArrayCount, 1);
+    CORRADE_COMPARE(header.textureCoords2DArrayCount, 1);
+    CORRADE_COMPARE(header.colorArrayCount, 1);
+    CORRADE_COMPARE(header.reserved, 0);
+    CORRADE_COMPARE(header.dataSize, data.size());
+
+    /* Arrays are aligned and padding is zeroed */
+    CORRADE_COMPARE(reinterpret_cast<const UnsignedInt*>(data + 48)[4], 2);
+    CORRADE_COMPARE(reinterpret_cast<const UnsignedInt*>(data + 48)[5], 0);
+    CORRADE_COMPARE(reinterpret_cast<const Vector3*>(data + 80)[2], (Vector3{-2.0f, 3.5f, 0.0f}));
+    CORRADE_COMPARE(reinterpret_cast<const Vector3*>(data + 128)[1], (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(reinterpret_cast<const Vector2*>(data + 176)[2], (Vector2{0.75f, 1.0f}));
+    CORRADE_COMPARE(reinterpret_cast<const Color4*>(data + 208)[1], 0x33ff66cc_rgbaf);
+}
+
+void MeshBlobTest::serializeNonIndexed() {
+    Containers::Array<char> data = serializeMeshBlob(MeshData3D{
+        MeshPrimitive::Points, {},
+        {{{0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}}}, {}, {}, {}});
+
+    /* Header and 2 Vector3 padded to 32 bytes */
+    CORRADE_COMPARE(data.size(), 48 + 32);
+
+    const MeshBlobHeader& header = *reinterpret_cast<const MeshBlobHeader*>(data.data());
+    CORRADE_COMPARE(header.indexCount, 0);
+    CORRADE_COMPARE(header.vertexCount, 2);
+    CORRADE_COMPARE(header.positionArrayCount, 1);
+    CORRADE_COMPARE(header.normalArrayCount, 0);
+    CORRADE_COMPARE(reinterpret_cast<const Vector3*>(data + 48)[1], (Vector3{1.1f, 1.2f, 1.3f}));
+}
+
+void MeshBlobTest::serializeWrongArraySize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    serializeMeshBlob(MeshData3D{MeshPrimitive::Points, {},
+        {{{0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}}},
+        {{}, {{0.0f, 0.0f, 1.0f}}}, {}, {}});
+    CORRADE_COMPARE(out.str(), "Trade::serializeMeshBlob(): expected 2 items in normal array 0 but got 0\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobTest)
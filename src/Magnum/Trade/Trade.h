@@ -57,6 +57,7 @@ typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
 class LightData;
+struct MeshBlobHeader;
 class MeshData2D;
 class MeshData3D;
 class MeshObjectData2D;
@@ -27,7 +27,11 @@
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/ConfigurationValue.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+#include "Magnum/TextureTools/Resample.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -40,8 +44,8 @@ namespace Magnum {
 @m_footernavigation
 @m_keywords{magnum-imageconverter imageconverter}
 
-This utility is built if both `WITH_TRADE` and `WITH_IMAGECONVERTER` is enabled
-when building Magnum. To use this utility with CMake, you need to request the
+This utility is built if `WITH_TRADE`, `WITH_TEXTURETOOLS` and
+`WITH_IMAGECONVERTER` is enabled when building Magnum. To use this utility with CMake, you need to request the
 `imageconverter` component of the `Magnum` package and use the
 `Magnum::imageconverter` target for example in a custom command:
 
@@ -58,7 +62,9 @@ information.
 
 @code{.sh}
 magnum-imageconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER]
-    [--plugin-dir DIR] [--] input output
+    [--plugin-dir DIR] [--format FORMAT] [--resize "X Y"] [--mipmaps]
+    [--filter FILTER] [--srgb] [--premultiply-alpha] [--threads N] [--]
+    input output
 @endcode
 
 Arguments:
@@ -71,6 +77,25 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--format FORMAT` --- convert the image to given pixel format using
+    @ref TextureTools::convertPixelFormat(), for example `RGBA16F`
+-   `--resize "X Y"` --- resample the image to given size using
+    @ref TextureTools::resample()
+-   `--mipmaps` --- generate mip levels using
+    @ref TextureTools::generateMipmaps() and save each to a separate file
+-   `--filter FILTER` --- filter for `--resize` and `--mipmaps`, either `box`
+    or `kaiser` (default: `box`)
+-   `--srgb` --- treat RGB channels of the image as sRGB-encoded, doing the
+    filtering and alpha premultiplication in linear space
+-   `--premultiply-alpha` --- premultiply RGB channels with alpha
+-   `--threads N` --- thread count for the image processing (default:
+    @cpp 0 @ce, meaning the hardware thread count)
+
+The image is first resized, then converted to the target format and with alpha
+premultiplied, and the mip levels are generated from the result. Only
+uncompressed images in the formats supported by
+@ref TextureTools::convertPixelFormat() can be processed. Mip levels are saved
+next to the output, with the level number inserted before the extension.
 
 @section magnum-imageconverter-example Example usage
 
@@ -80,12 +105,66 @@ Converting a JPEG file to a PNG:
 magnum-imageconverter image.jpg image.png
 @endcode
 
+Converting a sRGB PNG with alpha to a premultiplied half-float image and
+generating mip levels as `image.1.exr`, `image.2.exr` etc. next to it:
+
+@code{.sh}
+magnum-imageconverter --format RGBA16F --srgb --premultiply-alpha --mipmaps \
+    image.png image.exr
+@endcode
+
 */
 
 }
 
 using namespace Magnum;
 
+namespace {
+
+/* Formats supported by TextureTools::convertPixelFormat() */
+constexpr struct {
+    const char* name;
+    PixelFormat format;
+} PixelFormatNames[] {
+    #define _c(format) {#format, PixelFormat::format},
+    _c(R8Unorm)
+    _c(RG8Unorm)
+    _c(RGB8Unorm)
+    _c(RGBA8Unorm)
+    _c(R8Snorm)
+    _c(RG8Snorm)
+    _c(RGB8Snorm)
+    _c(RGBA8Snorm)
+    _c(R16Unorm)
+    _c(RG16Unorm)
+    _c(RGB16Unorm)
+    _c(RGBA16Unorm)
+    _c(R16Snorm)
+    _c(RG16Snorm)
+    _c(RGB16Snorm)
+    _c(RGBA16Snorm)
+    _c(R16F)
+    _c(RG16F)
+    _c(RGB16F)
+    _c(RGBA16F)
+    _c(R32F)
+    _c(RG32F)
+    _c(RGB32F)
+    _c(RGBA32F)
+    #undef _c
+};
+
+/* image.png -> image.1.png */
+std::string levelFilename(const std::string& filename, const std::size_t level) {
+    const std::size_t slash = filename.find_last_of("/\\");
+    std::size_t dot = filename.rfind('.');
+    if(dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        dot = filename.size();
+    return filename.substr(0, dot) + '.' + std::to_string(level) + filename.substr(dot);
+}
+
+}
+
 int main(int argc, char** argv) {
     Utility::Arguments args;
     args.addArgument("input").setHelp("input", "input image")
@@ -93,6 +172,13 @@ int main(int argc, char** argv) {
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        .addOption("format").setHelp("format", "convert to given pixel format", "FORMAT")
+        .addOption("resize").setHelp("resize", "resample to given size", "\"X Y\"")
+        .addBooleanOption("mipmaps").setHelp("mipmaps", "generate mip levels and save each to a separate file")
+        .addOption("filter", "box").setHelp("filter", "filter for resizing and mip generation, box or kaiser", "FILTER")
+        .addBooleanOption("srgb").setHelp("srgb", "treat RGB channels as sRGB, filter and premultiply in linear space")
+        .addBooleanOption("premultiply-alpha").setHelp("premultiply-alpha", "premultiply RGB channels with alpha")
+        .addOption("threads", "0").setHelp("threads", "thread count for the processing, 0 for hardware thread count", "N")
         .setHelp("Converts images of different formats.")
         .parse(argc, argv);
 
@@ -117,11 +203,96 @@ int main(int argc, char** argv) {
         return 3;
     }
 
+    /* Parse the processing options */
+    PixelFormat format = image->isCompressed() ? PixelFormat{} : image->format();
+    if(!args.value("format").empty()) {
+        bool found = false;
+        for(const auto& name: PixelFormatNames) {
+            if(args.value("format") != name.name) continue;
+            format = name.format;
+            found = true;
+            break;
+        }
+        if(!found) {
+            Error() << "Unsupported pixel format" << args.value("format");
+            return 5;
+        }
+    }
+
+    TextureTools::ResampleFilter filter;
+    if(args.value("filter") == "box")
+        filter = TextureTools::ResampleFilter::Box;
+    else if(args.value("filter") == "kaiser")
+        filter = TextureTools::ResampleFilter::Kaiser;
+    else {
+        Error() << "Unknown filter" << args.value("filter");
+        return 5;
+    }
+
+    const bool resize = !args.value("resize").empty();
+    const bool convert = !args.value("format").empty() || args.isSet("premultiply-alpha");
+    const UnsignedInt threadCount = args.value<UnsignedInt>("threads");
+    TextureTools::ResampleFlags resampleFlags;
+    TextureTools::PixelConversionFlags conversionFlags;
+    if(args.isSet("srgb")) {
+        resampleFlags |= TextureTools::ResampleFlag::Srgb;
+        conversionFlags |= TextureTools::PixelConversionFlag::DecodeSrgb|TextureTools::PixelConversionFlag::EncodeSrgb;
+    }
+    if(args.isSet("premultiply-alpha"))
+        conversionFlags |= TextureTools::PixelConversionFlag::PremultiplyAlpha;
+
+    /* The processing functions assert on these, check upfront to not abort
+       on bad input */
+    if(resize || convert || args.isSet("mipmaps")) {
+        if(image->isCompressed()) {
+            Error() << "Compressed images can't be processed";
+            return 5;
+        }
+        if(!TextureTools::isPixelFormatConvertible(image->format())) {
+            Error() << "Images of format" << image->format() << "can't be processed";
+            return 5;
+        }
+        if(!image->size().product()) {
+            Error() << "Empty images can't be processed";
+            return 5;
+        }
+    }
+    if(convert && !TextureTools::isPixelFormatConvertible(format)) {
+        Error() << "Can't convert to format" << format;
+        return 5;
+    }
+
     Debug() << "Converting image of size" << image->size() << "and format" << image->format() << "to" << args.value("output");
 
-    /* Save output file */
-    if(!converter->exportToFile(*image, args.value("output"))) {
+    /* Process the image. The view points either to the imported or to the
+       processed data. */
+    Containers::Optional<Image2D> processed;
+    if(resize) {
+        Debug() << "Resizing to" << args.value<Vector2i>("resize");
+        processed = TextureTools::resample(*image, args.value<Vector2i>("resize"), filter, resampleFlags, threadCount);
+    }
+    if(convert) {
+        Debug() << "Converting to" << format;
+        processed = TextureTools::convertPixelFormat(processed ? ImageView2D{*processed} : ImageView2D{*image}, format, conversionFlags, threadCount);
+    }
+
+    /* Save output file. Can't use the view for compressed images. */
+    if(processed ? !converter->exportToFile(*processed, args.value("output")) :
+                   !converter->exportToFile(*image, args.value("output"))) {
         Error() << "Cannot save file" << args.value("output");
         return 4;
     }
+
+    /* Generate and save mip levels */
+    if(args.isSet("mipmaps")) {
+        std::vector<Image2D> levels = TextureTools::generateMipmaps(processed ? ImageView2D{*processed} : ImageView2D{*image}, filter, resampleFlags, threadCount);
+        for(std::size_t i = 0; i != levels.size(); ++i) {
+            const std::string filename = levelFilename(args.value("output"), i + 1);
+            Debug() << "Saving level" << i + 1 << "of size" << levels[i].size() << "to" << filename;
+            if(!converter->exportToFile(levels[i], filename)) {
+                Error() << "Cannot save file" << filename;
+                return 4;
+            }
+        }
+    }
 }
@@ -68,6 +68,8 @@ void AnySceneImporter::doOpenFile(const std::string& filename) {
         plugin = "Ac3dImporter";
     else if(Utility::String::endsWith(filename, ".blend"))
         plugin = "BlenderImporter";
+    else if(Utility::String::endsWith(filename, ".blob"))
+        plugin = "MeshBlobImporter";
     else if(Utility::String::endsWith(filename, ".bvh"))
         plugin = "BvhImporter";
     else if(Utility::String::endsWith(filename, ".csm"))
@@ -71,6 +71,8 @@ Supported formats:
 -   AC3D (`*.ac`), loaded with any plugin that provides `Ac3dImporter`
 -   Blender 3D (`*.blend`), loaded with any plugin that provides
     `BlenderImporter`
+-   Magnum mesh blob (`*.blob`), loaded with @ref MeshBlobImporter or any
+    other plugin that provides it
 -   Biovision BVH (`*.bvh`), loaded with any plugin that provides `BvhImporter`
 -   CharacterStudio Motion (`*.csm`), loaded with any plugin that provides
     `CsmImporter`
@@ -38,6 +38,7 @@ namespace Magnum { namespace Trade { namespace Test { namespace {
 struct AnySceneImporterTest: TestSuite::Tester {
     explicit AnySceneImporterTest();
 
+    void blob();
     void obj();
 
     void unknown();
@@ -47,7 +48,8 @@ struct AnySceneImporterTest: TestSuite::Tester {
 };
 
 AnySceneImporterTest::AnySceneImporterTest() {
-    addTests({&AnySceneImporterTest::obj,
+    addTests({&AnySceneImporterTest::blob,
+              &AnySceneImporterTest::obj,
 
               &AnySceneImporterTest::unknown});
 
@@ -57,11 +59,27 @@ AnySceneImporterTest::AnySceneImporterTest() {
     CORRADE_INTERNAL_ASSERT(_manager.load(ANYSCENEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
     /* Optional plugins that don't have to be here */
+    #ifdef MESHBLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(MESHBLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
 }
 
+void AnySceneImporterTest::blob() {
+    if(!(_manager.loadState("MeshBlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MeshBlobImporter plugin not enabled, cannot test");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    CORRADE_VERIFY(importer->openFile(BLOB_FILE));
+
+    /* Check only size, as it is good enough proof that it is working */
+    Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0).size(), 3);
+}
+
 void AnySceneImporterTest::obj() {
     if(!(_manager.loadState("ObjImporter") & PluginManager::LoadState::Loaded))
         CORRADE_SKIP("ObjImporter plugin not enabled, cannot test");
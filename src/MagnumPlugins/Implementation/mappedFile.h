@@ -0,0 +1,107 @@
+#ifndef Magnum_Plugins_Implementation_mappedFile_h
+#define Magnum_Plugins_Implementation_mappedFile_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Shared by file-based importer plugins, not installed */
+
+namespace Magnum { namespace Implementation {
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+/* Array deleter for mapFile(). The data pointer is not necessarily at a page
+   boundary, so the mapping start is recovered from it. */
+inline void unmapFile(char* const data, const std::size_t size) {
+    const std::size_t pageOffset = reinterpret_cast<std::uintptr_t>(data) % sysconf(_SC_PAGESIZE);
+    munmap(data - pageOffset, size + pageOffset);
+}
+#endif
+
+/* Maps @p size bytes of given file starting at @p offset into memory, or the
+   rest of the file if @p size is ~std::size_t{}. The mapping is private and
+   writable, modifications don't propagate to the file and only the pages that
+   get modified are copied. Returns NullOpt on platforms without mmap(), when
+   the file can't be mapped or when it's empty, in which case the caller is
+   expected to fall back to reading the file. The returned array unmaps itself
+   on destruction, independently of the file and of whoever created it. */
+inline Containers::Optional<Containers::Array<char>> mapFile(const std::string& filename, const std::size_t offset = 0, std::size_t size = ~std::size_t{}) {
+    #if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) return Containers::NullOpt;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || std::size_t(st.st_size) < offset) {
+        close(fd);
+        return Containers::NullOpt;
+    }
+
+    if(size == ~std::size_t{}) {
+        size = st.st_size - offset;
+        if(!size) {
+            close(fd);
+            return Containers::NullOpt;
+        }
+    } else if(std::size_t(st.st_size) - offset < size) {
+        close(fd);
+        return Containers::NullOpt;
+    }
+
+    /* An explicitly requested empty range is valid, there's just nothing to
+       map */
+    if(!size) {
+        close(fd);
+        return Containers::Array<char>{};
+    }
+
+    /* The mapping has to start at a page boundary */
+    const std::size_t pageOffset = offset % sysconf(_SC_PAGESIZE);
+    void* const mapped = mmap(nullptr, size + pageOffset, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, offset - pageOffset);
+    /* The mapping keeps its own reference to the file */
+    close(fd);
+    if(mapped == MAP_FAILED) return Containers::NullOpt;
+
+    return Containers::Array<char>{static_cast<char*>(mapped) + pageOffset, size, unmapFile};
+    #else
+    static_cast<void>(filename);
+    static_cast<void>(offset);
+    static_cast<void>(size);
+    return Containers::NullOpt;
+    #endif
+}
+
+}}
+
+#endif
@@ -25,6 +25,8 @@
 
 #include "MagnumFont.h"
 
+#include <cstdlib>
+#include <new>
 #include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/Configuration.h>
@@ -37,17 +39,50 @@
 
 namespace Magnum { namespace Text {
 
-struct MagnumFont::Data {
-    Utility::Configuration conf;
-    Trade::ImageData2D image;
-    std::unordered_map<char32_t, UnsignedInt> glyphId;
-    std::vector<Vector2> glyphAdvance;
-};
-
 namespace {
+    /* Memory of deleted layouters, recycled for next layouts. Layouters can
+       outlive the font, so the pool is deleted only once the font is closed
+       and all its layouters are gone. */
+    struct LayouterPool {
+        /* Max count of unused blocks kept around */
+        enum: std::size_t { MaxFreeBlocks = 16 };
+
+        /* Placed in front of each layouter */
+        struct Header {
+            LayouterPool* pool;
+            /* Count of glyph IDs that fit after the layouter */
+            std::size_t capacity;
+        };
+
+        /* Called when the font is closed */
+        void release() {
+            for(Header* const header: freeBlocks) std::free(header);
+            freeBlocks.clear();
+            if(!used) delete this;
+            else orphaned = true;
+        }
+
+        std::vector<Header*> freeBlocks;
+        std::size_t used{};
+        bool orphaned{};
+    };
+
     class MagnumFontLayouter: public AbstractLayouter {
         public:
-            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
+            /* Returns memory for a layouter with space for at least
+               glyphCount glyph IDs after it, either recycled from the pool
+               or newly allocated */
+            static void* allocate(LayouterPool& pool, std::size_t glyphCount);
+
+            /* Puts the memory back to the pool it came from */
+            static void operator delete(void* ptr);
+
+            /* Glyph IDs stored right after the layouter */
+            static UnsignedInt* glyphs(void* ptr) {
+                return reinterpret_cast<UnsignedInt*>(static_cast<char*>(ptr) + sizeof(MagnumFontLayouter));
+            }
+
+            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, UnsignedInt glyphCount);
 
         private:
             std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override;
@@ -55,10 +90,41 @@ namespace {
             const std::vector<Vector2>& glyphAdvance;
             const GlyphCache& cache;
             const Float fontSize, textSize;
-            const std::vector<UnsignedInt> glyphs;
     };
 }
 
+struct MagnumFont::Data {
+    Utility::Configuration conf;
+    Trade::ImageData2D image;
+
+    /* Dense two-level glyph ID lookup table for the Basic Multilingual
+       Plane. The first level is indexed with upper eight bits of the
+       codepoint and gives an index of a 256-item page in the second level.
+       Page 0 is all zeros and is used for ranges with no characters in the
+       font. */
+    UnsignedShort glyphIdPages[256];
+    std::vector<UnsignedInt> glyphIdTable;
+
+    /* Characters outside of the BMP */
+    std::unordered_map<char32_t, UnsignedInt> glyphId;
+
+    std::vector<Vector2> glyphAdvance;
+
+    LayouterPool* layouterPool;
+
+    ~Data() { layouterPool->release(); }
+
+    UnsignedInt glyphIdFor(char32_t character) const;
+};
+
+UnsignedInt MagnumFont::Data::glyphIdFor(const char32_t character) const {
+    if(character < 0x10000)
+        return glyphIdTable[glyphIdPages[character >> 8]*256 + (character & 0xff)];
+
+    auto it = glyphId.find(character);
+    return it != glyphId.end() ? it->second : 0;
+}
+
 MagnumFont::MagnumFont(): _opened(nullptr) {}
 
 MagnumFont::MagnumFont(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractFont{manager, plugin}, _opened(nullptr) {}
@@ -147,7 +213,7 @@ auto MagnumFont::doOpenFile(const std::string& filename, Float) -> Metrics {
 
 auto MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image) -> Metrics {
     /* Everything okay, save the data internally */
-    _opened = new Data{std::move(conf), std::move(image), std::unordered_map<char32_t, UnsignedInt>{}, {}};
+    _opened = new Data{std::move(conf), std::move(image), {}, {}, {}, {}, new LayouterPool};
 
     /* Glyph advances */
     const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
@@ -155,12 +221,29 @@ auto MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&
     for(const Utility::ConfigurationGroup* const g: glyphs)
         _opened->glyphAdvance.push_back(g->value<Vector2>("advance"));
 
-    /* Fill character->glyph map */
+    /* Fill character->glyph map. BMP characters go to the lookup table,
+       with a new page allocated for each range that has some characters,
+       the rest into a hashmap. The page 0 stays empty. */
+    _opened->glyphIdTable.resize(256);
     const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
     for(const Utility::ConfigurationGroup* const c: chars) {
         const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
         CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphAdvance.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+        const char32_t character = c->value<char32_t>("unicode");
+        if(character >= 0x10000) {
+            _opened->glyphId.emplace(character, glyphId);
+            continue;
+        }
+
+        UnsignedShort& page = _opened->glyphIdPages[character >> 8];
+        if(!page) {
+            page = UnsignedShort(_opened->glyphIdTable.size()/256);
+            _opened->glyphIdTable.resize(_opened->glyphIdTable.size() + 256);
+        }
+
+        /* Keep the first occurence, consistently with the hashmap */
+        UnsignedInt& id = _opened->glyphIdTable[page*256 + (character & 0xff)];
+        if(!id) id = glyphId;
     }
 
     return {_opened->conf.value<Float>("fontSize"),
@@ -175,8 +258,7 @@ void MagnumFont::doClose() {
 }
 
 UnsignedInt MagnumFont::doGlyphId(const char32_t character) {
-    auto it = _opened->glyphId.find(character);
-    return it != _opened->glyphId.end() ? it->second : 0;
+    return _opened->glyphIdFor(character);
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
@@ -200,28 +282,74 @@ std::unique_ptr<GlyphCache> MagnumFont::doCreateGlyphCache() {
 }
 
 std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache, Float size, const std::string& text) {
-    /* Get glyph codes from characters */
-    std::vector<UnsignedInt> glyphs;
-    glyphs.reserve(text.size());
+    /* Get memory for the layouter, there's never more glyphs than bytes */
+    void* const memory = MagnumFontLayouter::allocate(*_opened->layouterPool, text.size());
+
+    /* Get glyph codes from characters, decoding ASCII directly */
+    UnsignedInt* const glyphs = MagnumFontLayouter::glyphs(memory);
+    UnsignedInt glyphCount = 0;
     for(std::size_t i = 0; i != text.size(); ) {
-        UnsignedInt codepoint;
-        std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
+        char32_t codepoint;
+        if(!(text[i] & 0x80)) codepoint = text[i++];
+        else std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
+        glyphs[glyphCount++] = _opened->glyphIdFor(codepoint);
     }
 
-    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
+    return std::unique_ptr<AbstractLayouter>(new(memory) MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, glyphCount));
 }
 
 namespace {
 
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
+void* MagnumFontLayouter::allocate(LayouterPool& pool, const std::size_t glyphCount) {
+    static_assert(sizeof(LayouterPool::Header) % alignof(MagnumFontLayouter) == 0,
+        "layouter would be misaligned");
+
+    ++pool.used;
+
+    /* Reuse the most recently freed block that's large enough */
+    for(std::size_t i = pool.freeBlocks.size(); i != 0; --i) {
+        LayouterPool::Header* const header = pool.freeBlocks[i - 1];
+        if(header->capacity < glyphCount) continue;
+
+        pool.freeBlocks.erase(pool.freeBlocks.begin() + i - 1);
+        return header + 1;
+    }
+
+    /* Allocate a new one otherwise, rounding the capacity up to make it
+       easier to reuse for texts of varying length */
+    std::size_t capacity = 32;
+    while(capacity < glyphCount) capacity *= 2;
+    auto* const header = static_cast<LayouterPool::Header*>(std::malloc(sizeof(LayouterPool::Header) + sizeof(MagnumFontLayouter) + capacity*sizeof(UnsignedInt)));
+    CORRADE_INTERNAL_ASSERT(header);
+    header->pool = &pool;
+    header->capacity = capacity;
+    return header + 1;
+}
+
+void MagnumFontLayouter::operator delete(void* const ptr) {
+    if(!ptr) return;
+
+    LayouterPool::Header* const header = static_cast<LayouterPool::Header*>(ptr) - 1;
+    LayouterPool& pool = *header->pool;
+    --pool.used;
+
+    /* The font was already closed, delete the pool with the last layouter */
+    if(pool.orphaned) {
+        std::free(header);
+        if(!pool.used) delete &pool;
+    } else if(pool.freeBlocks.size() < LayouterPool::MaxFreeBlocks)
+        pool.freeBlocks.push_back(header);
+    else std::free(header);
+}
+
+MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, const UnsignedInt glyphCount): AbstractLayouter(glyphCount), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize) {}
 
 std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
     /* Position of the texture in the resulting glyph, texture coordinates */
     Vector2i position;
     Range2Di rectangle;
-    std::tie(position, rectangle) = cache[glyphs[i]];
+    const UnsignedInt glyph = glyphs(this)[i];
+    std::tie(position, rectangle) = cache[glyph];
 
     /* Normalized texture coordinates */
     const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
@@ -231,7 +359,7 @@ std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const Un
     const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
 
     /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
+    const Vector2 advance = glyphAdvance[glyph]*(textSize/fontSize);
 
     return std::make_tuple(quadRectangle, textureCoordinates, advance);
 }
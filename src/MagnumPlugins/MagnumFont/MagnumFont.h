@@ -121,6 +121,14 @@ rectangle=45 0 44 25
 
 # ...
 @endcode
+
+@section Text-MagnumFont-performance Performance
+
+Glyph IDs of characters from the Basic Multilingual Plane are looked up in a
+dense table covering the 256-character ranges present in the font, other
+characters go through a hashmap. Memory of deleted layouters is kept and
+reused for subsequent @ref layout() calls, so laying out text repeatedly
+doesn't allocate in a steady state.
 */
 class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
     public:
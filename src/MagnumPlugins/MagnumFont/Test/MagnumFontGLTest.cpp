@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/GL/OpenGLTester.h"
@@ -41,8 +42,14 @@ struct MagnumFontGLTest: GL::OpenGLTester {
     void nonexistent();
     void properties();
     void layout();
+    void layoutReuse();
+    void layoutAfterClose();
+    void glyphIdLookup();
     void createGlyphCache();
 
+    void layoutBenchmark();
+    void layoutShortBenchmark();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
     PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
@@ -52,8 +59,14 @@ MagnumFontGLTest::MagnumFontGLTest() {
     addTests({&MagnumFontGLTest::nonexistent,
               &MagnumFontGLTest::properties,
               &MagnumFontGLTest::layout,
+              &MagnumFontGLTest::layoutReuse,
+              &MagnumFontGLTest::layoutAfterClose,
+              &MagnumFontGLTest::glyphIdLookup,
               &MagnumFontGLTest::createGlyphCache});
 
+    addBenchmarks({&MagnumFontGLTest::layoutBenchmark,
+                   &MagnumFontGLTest::layoutShortBenchmark}, 10);
+
     /* Load the plugins directly from the build tree. Otherwise they're static
        and already loaded. */
     #if defined(TGAIMPORTER_PLUGIN_FILENAME) && defined(MAGNUMFONT_PLUGIN_FILENAME)
@@ -126,6 +139,105 @@ void MagnumFontGLTest::layout() {
     CORRADE_COMPARE(cursorPosition, Vector2(0.375f, 0.0f));
 }
 
+void MagnumFontGLTest::layoutReuse() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+
+    /* Memory of the first layouter gets reused for the second, which
+       shouldn't be affected by the previous contents */
+    auto layouter = font->layout(cache, 16.0f, "WeW");
+    CORRADE_COMPARE(layouter->glyphCount(), 3);
+    layouter = nullptr;
+    layouter = font->layout(cache, 16.0f, "eW");
+    CORRADE_COMPARE(layouter->glyphCount(), 2);
+
+    /* A text that doesn't fit into the recycled memory */
+    std::unique_ptr<AbstractLayouter> another = font->layout(cache, 16.0f, std::string(1000, 'e') + "W");
+    CORRADE_COMPARE(another->glyphCount(), 1001);
+
+    /* Both layouters are alive at the same time and independent */
+    Range2D rectangle;
+    Vector2 cursorPosition;
+    layouter->renderGlyph(0, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(12.0f, 0.0f));
+    layouter->renderGlyph(1, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(23.0f, 0.0f));
+    another->renderGlyph(999, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(12.0f, 0.0f));
+    another->renderGlyph(1000, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(23.0f, 0.0f));
+}
+
+void MagnumFontGLTest::layoutAfterClose() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+    auto a = font->layout(cache, 16.0f, "We");
+    auto b = font->layout(cache, 16.0f, "eW");
+    a = nullptr;
+
+    /* Layouters can be destroyed after the font is closed */
+    font->close();
+    CORRADE_VERIFY(!font->isOpened());
+    b = nullptr;
+}
+
+void MagnumFontGLTest::glyphIdLookup() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    /* Characters in various ranges of the BMP and outside of it */
+    const char conf[] =
+        "version=1\n"
+        "image=font.tga\n"
+        "originalImageSize=1536 1536\n"
+        "padding=24 24\n"
+        "fontSize=16\n"
+        "ascent=25\n"
+        "descent=-10\n"
+        "lineHeight=39.7333\n"
+        "[char]\nunicode=57\nglyph=2\n"
+        "[char]\nunicode=159\nglyph=1\n"
+        "[char]\nunicode=ff21\nglyph=2\n"
+        "[char]\nunicode=1f600\nglyph=1\n"
+        "[glyph]\nadvance=8 0\nposition=24 24\nrectangle=24 24 -24 -24\n"
+        "[glyph]\nadvance=12 0\nposition=25 12\nrectangle=16 4 64 32\n"
+        "[glyph]\nadvance=23 0\nposition=25 34\nrectangle=0 8 16 128\n";
+    Containers::Array<char> image = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(font->openData({
+        {"font.conf", Containers::arrayView(conf, sizeof(conf) - 1)},
+        {"font.tga", {image.data(), image.size()}}}, 0.0f));
+
+    CORRADE_COMPARE(font->glyphId(U'W'), 2);
+    CORRADE_COMPARE(font->glyphId(U'X'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\u0159'), 1);
+    CORRADE_COMPARE(font->glyphId(U'\u0158'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\uff21'), 2);
+    CORRADE_COMPARE(font->glyphId(U'\uff22'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\u4e00'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\U0001f600'), 1);
+    CORRADE_COMPARE(font->glyphId(U'\U0001f601'), 0);
+
+    /* The same through layout, the advances tell which glyph was used */
+    GlyphCache cache(Vector2i(256));
+    auto layouter = font->layout(cache, 16.0f, "W\xc5\x99\xf0\x9f\x98\x80X");
+    CORRADE_COMPARE(layouter->glyphCount(), 4);
+    Range2D rectangle;
+    Vector2 cursorPosition;
+    layouter->renderGlyph(0, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(23.0f, 0.0f));
+    layouter->renderGlyph(1, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(12.0f, 0.0f));
+    layouter->renderGlyph(2, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(12.0f, 0.0f));
+    layouter->renderGlyph(3, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(8.0f, 0.0f));
+}
+
 void MagnumFontGLTest::createGlyphCache() {
     std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
 
@@ -141,6 +253,42 @@ void MagnumFontGLTest::createGlyphCache() {
     /** @todo properly test contents */
 }
 
+void MagnumFontGLTest::layoutBenchmark() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+
+    /* One million characters */
+    std::string text;
+    text.reserve(1000000);
+    while(text.size() != 1000000) text += "Wave ";
+
+    UnsignedInt glyphCount = 0;
+    CORRADE_BENCHMARK(1)
+        glyphCount += font->layout(cache, 16.0f, text)->glyphCount();
+
+    CORRADE_COMPARE(glyphCount, 1000000);
+}
+
+void MagnumFontGLTest::layoutShortBenchmark() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+
+    /* One million characters in short texts, as in a HUD */
+    const std::string text = "Wave Wave Wave Wave";
+    UnsignedInt glyphCount = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != 1000000/text.size(); ++i)
+            glyphCount += font->layout(cache, 16.0f, text)->glyphCount();
+
+    CORRADE_COMPARE(glyphCount, 1000000/text.size()*text.size());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::MagnumFontGLTest)
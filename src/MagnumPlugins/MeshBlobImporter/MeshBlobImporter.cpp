@@ -0,0 +1,174 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlobImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MeshBlob.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/Implementation/mappedFile.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+UnsignedLong alignedSize(const UnsignedLong size) {
+    return (size + MeshBlobAlignment - 1)/MeshBlobAlignment*MeshBlobAlignment;
+}
+
+/* Subtracts size of `count` arrays of `arraySize` bytes from `remaining`,
+   returns false if they don't fit. Done this way to avoid overflows with
+   garbage counts. */
+bool consume(UnsignedLong& remaining, const UnsignedLong count, const UnsignedLong arraySize) {
+    if(count && arraySize > remaining/count) return false;
+    remaining -= count*arraySize;
+    return true;
+}
+
+template<class T> std::vector<T> copyArray(const char*& data, const std::size_t count) {
+    const T* const begin = reinterpret_cast<const T*>(data);
+    data += alignedSize(count*sizeof(T));
+    return std::vector<T>(begin, begin + count);
+}
+
+}
+
+MeshBlobImporter::MeshBlobImporter() = default;
+
+MeshBlobImporter::MeshBlobImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+MeshBlobImporter::~MeshBlobImporter() = default;
+
+auto MeshBlobImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool MeshBlobImporter::doIsOpened() const { return _in; }
+
+void MeshBlobImporter::doClose() { _in = nullptr; }
+
+void MeshBlobImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    Containers::Array<char> in{Containers::NoInit, data.size()};
+    std::copy(data.begin(), data.end(), in.begin());
+    openInternal(std::move(in));
+}
+
+void MeshBlobImporter::doOpenFile(const std::string& filename) {
+    /* Map the file instead of reading it. If mapping is not possible, fall
+       back to the default implementation. */
+    if(configuration().value<bool>("mmap")) {
+        Containers::Optional<Containers::Array<char>> mapped = Magnum::Implementation::mapFile(filename);
+        if(mapped) {
+            openInternal(std::move(*mapped));
+            return;
+        }
+    }
+
+    AbstractImporter::doOpenFile(filename);
+}
+
+void MeshBlobImporter::openInternal(Containers::Array<char>&& data) {
+    if(data.size() < sizeof(MeshBlobHeader)) {
+        Error() << "Trade::MeshBlobImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    const MeshBlobHeader& header = *reinterpret_cast<const MeshBlobHeader*>(data.data());
+    if(std::memcmp(header.signature, MeshBlobSignature, sizeof(header.signature)) != 0) {
+        Error() << "Trade::MeshBlobImporter::openData(): invalid signature";
+        return;
+    }
+
+    /* A blob with different endianness ends up here as well */
+    if(header.version != MeshBlobVersion || header.headerSize != sizeof(MeshBlobHeader)) {
+        Error() << "Trade::MeshBlobImporter::openData(): unsupported version" << header.version << "with header size" << header.headerSize;
+        return;
+    }
+
+    if(header.primitive > UnsignedInt(MeshPrimitive::TriangleFan)) {
+        Error() << "Trade::MeshBlobImporter::openData(): invalid primitive" << header.primitive;
+        return;
+    }
+
+    if(!header.positionArrayCount) {
+        Error() << "Trade::MeshBlobImporter::openData(): no position array";
+        return;
+    }
+
+    /* Check that all arrays fit into the data and the size is exactly as
+       advertised */
+    UnsignedLong remaining = data.size() - alignedSize(sizeof(MeshBlobHeader));
+    if(header.dataSize != data.size() ||
+       !consume(remaining, 1, alignedSize(UnsignedLong{header.indexCount}*sizeof(UnsignedInt))) ||
+       !consume(remaining, UnsignedLong{header.positionArrayCount} + header.normalArrayCount, alignedSize(UnsignedLong{header.vertexCount}*sizeof(Vector3))) ||
+       !consume(remaining, header.textureCoords2DArrayCount, alignedSize(UnsignedLong{header.vertexCount}*sizeof(Vector2))) ||
+       !consume(remaining, header.colorArrayCount, alignedSize(UnsignedLong{header.vertexCount}*sizeof(Color4))) ||
+       remaining) {
+        Error() << "Trade::MeshBlobImporter::openData(): file size" << data.size() << "doesn't match the header";
+        return;
+    }
+
+    _in = std::move(data);
+}
+
+UnsignedInt MeshBlobImporter::doMesh3DCount() const { return 1; }
+
+Containers::Optional<MeshData3D> MeshBlobImporter::doMesh3D(UnsignedInt) {
+    const MeshBlobHeader& header = *reinterpret_cast<const MeshBlobHeader*>(_in.data());
+    const char* data = _in.data() + alignedSize(sizeof(MeshBlobHeader));
+
+    /* Everything was validated on opening, so just copy the arrays */
+    std::vector<UnsignedInt> indices = copyArray<UnsignedInt>(data, header.indexCount);
+    std::vector<std::vector<Vector3>> positions;
+    positions.reserve(header.positionArrayCount);
+    for(UnsignedInt i = 0; i != header.positionArrayCount; ++i)
+        positions.push_back(copyArray<Vector3>(data, header.vertexCount));
+    std::vector<std::vector<Vector3>> normals;
+    normals.reserve(header.normalArrayCount);
+    for(UnsignedInt i = 0; i != header.normalArrayCount; ++i)
+        normals.push_back(copyArray<Vector3>(data, header.vertexCount));
+    std::vector<std::vector<Vector2>> textureCoords2D;
+    textureCoords2D.reserve(header.textureCoords2DArrayCount);
+    for(UnsignedInt i = 0; i != header.textureCoords2DArrayCount; ++i)
+        textureCoords2D.push_back(copyArray<Vector2>(data, header.vertexCount));
+    std::vector<std::vector<Color4>> colors;
+    colors.reserve(header.colorArrayCount);
+    for(UnsignedInt i = 0; i != header.colorArrayCount; ++i)
+        colors.push_back(copyArray<Color4>(data, header.vertexCount));
+
+    return MeshData3D{MeshPrimitive(header.primitive), std::move(indices),
+        std::move(positions), std::move(normals), std::move(textureCoords2D),
+        std::move(colors)};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MeshBlobImporter, Magnum::Trade::MeshBlobImporter,
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3")
@@ -0,0 +1,118 @@
+#ifndef Magnum_Trade_MeshBlobImporter_h
+#define Magnum_Trade_MeshBlobImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshBlobImporter
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MeshBlobImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHBLOBIMPORTER_BUILD_STATIC
+    #ifdef MeshBlobImporter_EXPORTS
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHBLOBIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MESHBLOBIMPORTER_EXPORT
+#define MAGNUM_MESHBLOBIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob importer plugin
+
+Imports binary mesh blobs (`*.blob`) produced by @ref serializeMeshBlob(). See
+@ref MeshBlobHeader for the format description. Each blob contains exactly one
+mesh.
+
+This plugin depends on the @ref Trade library and is built if
+`WITH_MESHBLOBIMPORTER` is enabled when building Magnum. To use as a dynamic
+plugin, you need to load the @cpp "MeshBlobImporter" @ce plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use as a static plugin or use this as a
+dependency of another plugin with CMake, you need to request the
+`MeshBlobImporter` component of the `Magnum` package and link to the
+`Magnum::MeshBlobImporter` target. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+The header and the data size are validated when opening the file, the mesh
+import itself does no parsing. As @ref MeshData3D stores the data in
+@ref std::vector instances, @ref mesh3D() makes one copy of each array, which
+doesn't need any other processing thanks to the arrays being stored in the
+same layout as in memory. Importer state is not supported.
+
+@section Trade-MeshBlobImporter-mmap Memory-mapped import
+
+On Unix platforms, files opened through @ref openFile() are memory-mapped
+instead of being read into memory, so only the parts of the file that are
+actually accessed get loaded from the disk. In comparison, @ref openData()
+makes a copy of the input. Set the @cb{.ini} mmap @ce configuration option to
+@cpp false @ce to always read the whole file instead, which is also what
+happens if file callbacks are set or the file can't be mapped.
+
+@snippet MagnumPlugins/MeshBlobImporter/MeshBlobImporter.conf config
+
+See @ref plugins-configuration for more information.
+*/
+class MAGNUM_MESHBLOBIMPORTER_EXPORT MeshBlobImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshBlobImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshBlobImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
+
+        ~MeshBlobImporter();
+
+    private:
+        Features MAGNUM_MESHBLOBIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_MESHBLOBIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doClose() override;
+        UnsignedInt MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3DCount() const override;
+        Containers::Optional<MeshData3D> MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3D(UnsignedInt id) override;
+
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL openInternal(Containers::Array<char>&& data);
+
+        Containers::Array<char> _in;
+};
+
+}}
+
+#endif
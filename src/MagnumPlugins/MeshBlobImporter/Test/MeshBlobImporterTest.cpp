@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshBlob.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+constexpr struct {
+    const char* name;
+    bool mmap;
+} OpenFileData[] {
+    {"mapped", true},
+    {"read", false}
+};
+
+struct MeshBlobImporterTest: TestSuite::Tester {
+    explicit MeshBlobImporterTest();
+
+    void openShort();
+    void invalidSignature();
+    void unsupportedVersion();
+    void invalidPrimitive();
+    void noPositions();
+    void sizeMismatch();
+
+    void roundtrip();
+    void roundtripNonIndexed();
+
+    void openFile();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+MeshBlobImporterTest::MeshBlobImporterTest() {
+    addTests({&MeshBlobImporterTest::openShort,
+              &MeshBlobImporterTest::invalidSignature,
+              &MeshBlobImporterTest::unsupportedVersion,
+              &MeshBlobImporterTest::invalidPrimitive,
+              &MeshBlobImporterTest::noPositions,
+              &MeshBlobImporterTest::sizeMismatch,
+
+              &MeshBlobImporterTest::roundtrip,
+              &MeshBlobImporterTest::roundtripNonIndexed});
+
+    addInstancedTests({&MeshBlobImporterTest::openFile},
+        Containers::arraySize(OpenFileData));
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MESHBLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(MESHBLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+using namespace Math::Literals;
+
+Containers::Array<char> triangleBlob() {
+    return serializeMeshBlob(MeshData3D{MeshPrimitive::Triangles, {0, 1, 2},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {}, {}, {}});
+}
+
+void MeshBlobImporterTest::openShort() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const char data[] = { 'M', 'B', 'L', 'B', 1, 0 };
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): the file is too short: 6 bytes\n");
+}
+
+void MeshBlobImporterTest::invalidSignature() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = triangleBlob();
+    data[1] = 'O';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): invalid signature\n");
+}
+
+void MeshBlobImporterTest::unsupportedVersion() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = triangleBlob();
+    reinterpret_cast<MeshBlobHeader*>(data.data())->version = 2;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): unsupported version 2 with header size 48\n");
+}
+
+void MeshBlobImporterTest::invalidPrimitive() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = triangleBlob();
+    reinterpret_cast<MeshBlobHeader*>(data.data())->primitive = 0xdead;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): invalid primitive 57005\n");
+}
+
+void MeshBlobImporterTest::noPositions() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = triangleBlob();
+    reinterpret_cast<MeshBlobHeader*>(data.data())->positionArrayCount = 0;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): no position array\n");
+}
+
+void MeshBlobImporterTest::sizeMismatch() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = triangleBlob();
+    CORRADE_COMPARE(data.size(), 112);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Truncated data */
+    CORRADE_VERIFY(!importer->openData(Containers::ArrayView<const char>{data, 96}));
+
+    /* Vertex count not matching the data */
+    reinterpret_cast<MeshBlobHeader*>(data.data())->vertexCount = 0xffffffffu;
+    CORRADE_VERIFY(!importer->openData(data));
+
+    /* Array count not matching the data */
+    reinterpret_cast<MeshBlobHeader*>(data.data())->vertexCount = 3;
+    reinterpret_cast<MeshBlobHeader*>(data.data())->colorArrayCount = 0xffffffffu;
+    CORRADE_VERIFY(!importer->openData(data));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshBlobImporter::openData(): file size 96 doesn't match the header\n"
+        "Trade::MeshBlobImporter::openData(): file size 112 doesn't match the header\n"
+        "Trade::MeshBlobImporter::openData(): file size 112 doesn't match the header\n");
+}
+
+void MeshBlobImporterTest::roundtrip() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    Containers::Array<char> data = serializeMeshBlob(MeshData3D{
+        MeshPrimitive::TriangleFan, {0, 1, 2, 1, 2, 0},
+        {{{0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}, {-2.0f, 3.5f, 0.0f}},
+         {{0.0f, 0.1f, 0.2f}, {1.0f, 1.1f, 1.2f}, {2.0f, 2.1f, 2.2f}}},
+        {{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}},
+         {{0.1f, 0.2f}, {0.3f, 0.4f}, {0.5f, 0.6f}}},
+        {{0xff3366_rgbf, 0x33ff66cc_rgbaf, 0x6633ff_rgbf}}});
+
+    /* The data are not needed after opening */
+    CORRADE_VERIFY(importer->openData(data));
+    data = nullptr;
+
+    CORRADE_COMPARE(importer->mesh3DCount(), 1);
+    Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::TriangleFan);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2, 1, 2, 0}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 2);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}, {-2.0f, 3.5f, 0.0f}}));
+    CORRADE_COMPARE(mesh->positions(1), (std::vector<Vector3>{
+        {0.0f, 0.1f, 0.2f}, {1.0f, 1.1f, 1.2f}, {2.0f, 2.1f, 2.2f}}));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 2);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2D(1), (std::vector<Vector2>{
+        {0.1f, 0.2f}, {0.3f, 0.4f}, {0.5f, 0.6f}}));
+    CORRADE_COMPARE(mesh->colorArrayCount(), 1);
+    CORRADE_COMPARE(mesh->colors(0), (std::vector<Color4>{
+        0xff3366_rgbf, 0x33ff66cc_rgbaf, 0x6633ff_rgbf}));
+}
+
+void MeshBlobImporterTest::roundtripNonIndexed() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+
+    CORRADE_VERIFY(importer->openData(serializeMeshBlob(MeshData3D{
+        MeshPrimitive::Points, {},
+        {{{0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}}}, {}, {}, {}})));
+
+    Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {0.5f, 1.0f, 0.3f}, {1.1f, 1.2f, 1.3f}}));
+    CORRADE_VERIFY(!mesh->hasNormals());
+    CORRADE_VERIFY(!mesh->hasTextureCoords2D());
+    CORRADE_VERIFY(!mesh->hasColors());
+}
+
+void MeshBlobImporterTest::openFile() {
+    auto&& data = OpenFileData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("MeshBlobImporter");
+    importer->configuration().setValue("mmap", data.mmap);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(MESHBLOBIMPORTER_TEST_DIR, "mesh.blob")));
+
+    Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+    CORRADE_VERIFY(mesh);
+
+    /* The data should stay valid after the importer is gone */
+    importer = nullptr;
+
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}));
+    CORRADE_COMPARE(mesh->colorArrayCount(), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobImporterTest)
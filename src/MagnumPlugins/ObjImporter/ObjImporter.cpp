@@ -25,210 +25,231 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <unordered_map>
-#include <Corrade/Containers/ArrayView.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/Implementation/mappedFile.h"
 
 namespace Magnum { namespace Trade {
 
-struct ObjImporter::File {
-    std::unordered_map<std::string, UnsignedInt> meshesForName;
-    std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
-};
-
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-}
+struct MeshInfo {
+    /* Byte range of the mesh in the file */
+    std::size_t begin, end;
+
+    /* Indices of the first position, texture coordinate and normal in this
+       mesh (OBJ indices are global for the whole file) */
+    UnsignedInt positionIndexOffset,
+        textureCoordinateIndexOffset,
+        normalIndexOffset;
+
+    /* Count of vertex data and primitives in the mesh, used to reserve the
+       output arrays upfront */
+    UnsignedInt positionCount,
+        textureCoordinateCount,
+        normalCount,
+        primitiveCount;
+};
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
-        throw 0;
-    }
+}
 
-    Math::Vector<size, Float> output;
+struct ObjImporter::File {
+    std::unordered_map<std::string, UnsignedInt> meshesForName;
+    std::vector<std::string> meshNames;
+    std::vector<MeshInfo> meshes;
+    Containers::Array<char> data;
 
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+    #if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+    /* Filled by prefetchMeshes() if the parallel option is enabled */
+    std::vector<Containers::Optional<MeshData3D>> prefetched;
+    #endif
+};
 
-    if(data.size() == size+1) {
-        /* This should be obvious from the first if, but add this just to make
-           Clang Analyzer happy */
-        CORRADE_INTERNAL_ASSERT(extra);
+namespace {
 
-        *extra = std::stof(data.back());
-    }
+/* The parser operates directly on the file contents using a pair of
+   pointers, without any stream or per-line string allocations. Lines are
+   delimited by '\n', everything else counts as a whitespace (so CRLF files
+   work too). */
 
-    return output;
+inline bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
 
-template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
-    /* Check that indices are in range */
-    for(UnsignedInt i: indices) if(i >= data.size()) {
-        Error() << "Trade::ObjImporter::mesh3D(): index out of range";
-        throw 0;
-    }
-
-    data = MeshTools::duplicate(indices, data);
+inline const char* skipSpaces(const char* it, const char* const end) {
+    while(it != end && isSpace(*it)) ++it;
+    return it;
 }
 
+inline const char* skipToken(const char* it, const char* const end) {
+    while(it != end && !isSpace(*it)) ++it;
+    return it;
 }
 
-ObjImporter::ObjImporter() = default;
-
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+inline const char* findLineEnd(const char* const it, const char* const end) {
+    const void* const found = std::memchr(it, '\n', end - it);
+    return found ? static_cast<const char*>(found) : end;
+}
 
-ObjImporter::~ObjImporter() = default;
+template<std::size_t size> inline bool equals(const char* const begin, const char* const end, const char(&string)[size]) {
+    return std::size_t(end - begin) == size - 1 && std::memcmp(begin, string, size - 1) == 0;
+}
 
-auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
+[[noreturn]] void conversionError() {
+    Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+    throw 0;
+}
 
-void ObjImporter::doClose() { _file.reset(); }
+/* Powers of ten that are exactly representable in a double */
+constexpr double PowersOf10[]{
+    1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,
+    1.0e8,  1.0e9,  1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+    1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22
+};
 
-bool ObjImporter::doIsOpened() const { return !!_file; }
+/* Parses a float from the whole [begin, end) range. The common case of a
+   plain decimal number with at most 15 significant digits and a small
+   exponent is handled directly, as both the mantissa and the power of ten are
+   exactly representable in a double and a single multiplication or division
+   gives a correctly rounded double. Narrowing that to a float rounds a second
+   time, so the result is within 1 ULP of what std::strtof() would return,
+   differing from it only in rare halfway cases. Everything else (long
+   mantissas, large exponents, inf, nan, hexadecimal floats) goes through
+   std::strtof() on a null-terminated copy in a stack buffer. */
+Float parseFloat(const char* const begin, const char* const end) {
+    const char* it = begin;
+    bool negative = false;
+    if(it != end && (*it == '-' || *it == '+')) negative = *it++ == '-';
+
+    UnsignedLong mantissa = 0;
+    Int significantDigits = 0;
+    Int exponent = 0;
+    bool hasDigits = false;
+    for(; it != end && UnsignedInt(*it - '0') < 10; ++it) {
+        mantissa = mantissa*10 + (*it - '0');
+        if(mantissa) ++significantDigits;
+        hasDigits = true;
+    }
+    if(it != end && *it == '.') for(++it; it != end && UnsignedInt(*it - '0') < 10; ++it) {
+        mantissa = mantissa*10 + (*it - '0');
+        if(mantissa) ++significantDigits;
+        --exponent;
+        hasDigits = true;
+    }
+    if(hasDigits && it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool negativeExponent = false;
+        if(it != end && (*it == '-' || *it == '+')) negativeExponent = *it++ == '-';
+        Int explicitExponent = 0;
+        const char* const exponentBegin = it;
+        for(; it != end && UnsignedInt(*it - '0') < 10 && explicitExponent < 10000; ++it)
+            explicitExponent = explicitExponent*10 + (*it - '0');
+        /* Make sure the fast path isn't taken for "1e" and such */
+        if(it == exponentBegin) hasDigits = false;
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
 
-void ObjImporter::doOpenFile(const std::string& filename) {
-    std::unique_ptr<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
+    /* Fast path */
+    if(hasDigits && it == end && significantDigits <= 15 && exponent >= -22 && exponent <= 22) {
+        const double value = exponent < 0 ?
+            double(mantissa)/PowersOf10[-exponent] :
+            double(mantissa)*PowersOf10[exponent];
+        return Float(negative ? -value : value);
     }
 
-    _file.reset(new File);
-    _file->in = std::move(in);
-    parseMeshNames();
+    /* Slow path. Nothing that's a valid float needs this many characters, so
+       treat it as an error instead of allocating. */
+    char buffer[128];
+    const std::size_t size = end - begin;
+    if(size >= sizeof(buffer)) conversionError();
+    std::memcpy(buffer, begin, size);
+    buffer[size] = '\0';
+    char* parsedEnd;
+    errno = 0;
+    const Float value = std::strtof(buffer, &parsedEnd);
+    if(parsedEnd != buffer + size || errno == ERANGE) conversionError();
+    return value;
 }
 
-void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
-    _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+/* Parses an OBJ index from the whole [begin, end) range. Only positive
+   (absolute) indices are supported. */
+UnsignedInt parseIndex(const char* it, const char* const end) {
+    if(it == end) conversionError();
+
+    UnsignedLong value = 0;
+    for(; it != end; ++it) {
+        const UnsignedInt digit = *it - '0';
+        if(digit > 9) conversionError();
+        value = value*10 + digit;
+        if(value > 0xffffffffull) conversionError();
+    }
 
-    parseMeshNames();
+    return UnsignedInt(value);
 }
 
-void ObjImporter::parseMeshNames() {
-    /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
-    UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
-    UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
-
-    /* The first mesh doesn't have name by default but we might find it later,
-       so we need to track whether there are any data before first name */
-    bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
-
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+template<std::size_t size> Math::Vector<size, Float> extractFloatData(const char* it, const char* const end, Float* extra = nullptr) {
+    /* Find all numbers first so the array size is checked before parsing any
+       of them */
+    const char* tokens[size + 1][2];
+    const std::size_t maxCount = size + (extra ? 1 : 0);
+    std::size_t count = 0;
+    for(it = skipSpaces(it, end); it != end; it = skipSpaces(it, end)) {
+        if(count == maxCount) {
+            count = maxCount + 1;
+            break;
         }
 
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
-
-        /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
-
-            /* This is the name of first mesh */
-            if(thisIsFirstMeshAndItHasNoData) {
-                thisIsFirstMeshAndItHasNoData = false;
-
-                /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = std::move(name);
-
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
-
-            /* Otherwise this is a name of new mesh */
-            } else {
-                /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
-
-                /* Save name and offset of the new one. The end offset will be
-                   updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
-            }
-
-            continue;
+        tokens[count][0] = it;
+        tokens[count][1] = it = skipToken(it, end);
+        ++count;
+    }
+    if(count < size || count > maxCount) {
+        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
+        throw 0;
+    }
 
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
+    Math::Vector<size, Float> output;
 
-        /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
-            ++positionIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
-            ++textureCoordinateIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
-            ++normalIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
+    for(std::size_t i = 0; i != size; ++i)
+        output[i] = parseFloat(tokens[i][0], tokens[i][1]);
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
-        }
+    if(count == size+1) {
+        /* This should be obvious from the first if, but add this just to make
+           Clang Analyzer happy */
+        CORRADE_INTERNAL_ASSERT(extra);
 
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+        *extra = parseFloat(tokens[size][0], tokens[size][1]);
     }
 
-    /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    return output;
 }
 
-UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
-
-Int ObjImporter::doMesh3DForName(const std::string& name) {
-    const auto it = _file->meshesForName.find(name);
-    return it == _file->meshesForName.end() ? -1 : it->second;
-}
+template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
+    /* Check that indices are in range */
+    for(UnsignedInt i: indices) if(i >= data.size()) {
+        Error() << "Trade::ObjImporter::mesh3D(): index out of range";
+        throw 0;
+    }
 
-std::string ObjImporter::doMesh3DName(UnsignedInt id) {
-    return _file->meshNames[id];
+    data = MeshTools::duplicate(indices, data);
 }
 
-Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+Containers::Optional<MeshData3D> parseMesh(const Containers::ArrayView<const char> fileData, const MeshInfo& mesh) {
+    const char* const end = fileData.begin() + mesh.end;
 
     Containers::Optional<MeshPrimitive> primitive;
     std::vector<Vector3> positions;
@@ -238,31 +259,42 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
+    /* Reserve the memory upfront. Assuming triangles, which is the most
+       common case. */
+    positions.reserve(mesh.positionCount);
+    if(mesh.textureCoordinateCount) {
+        textureCoordinates.emplace_back();
+        textureCoordinates.front().reserve(mesh.textureCoordinateCount);
+    }
+    if(mesh.normalCount) {
+        normals.emplace_back();
+        normals.front().reserve(mesh.normalCount);
+    }
+    positionIndices.reserve(mesh.primitiveCount*3);
+    if(mesh.textureCoordinateCount)
+        textureCoordinateIndices.reserve(mesh.primitiveCount*3);
+    if(mesh.normalCount)
+        normalIndices.reserve(mesh.primitiveCount*3);
+
+    try { for(const char* it = fileData.begin() + mesh.begin; it < end; ) {
+        /* Get the line, trim it */
+        const char* lineEnd = findLineEnd(it, end);
+        const char* const lineBegin = skipSpaces(it, lineEnd);
+        it = lineEnd == end ? end : lineEnd + 1;
+        while(lineEnd != lineBegin && isSpace(lineEnd[-1])) --lineEnd;
+
+        /* Ignore empty lines and comments */
+        if(lineBegin == lineEnd || *lineBegin == '#') continue;
 
         /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        const char* const keywordBegin = lineBegin;
+        const char* const keywordEnd = skipToken(keywordBegin, lineEnd);
+        const char* const contents = skipSpaces(keywordEnd, lineEnd);
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(equals(keywordBegin, keywordEnd, "v")) {
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            const Vector3 data = extractFloatData<3>(contents, lineEnd, &extra);
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
                 Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
                 return Containers::NullOpt;
@@ -271,28 +303,31 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
             positions.push_back(data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
             Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
+            const auto data = extractFloatData<2>(contents, lineEnd, &extra);
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
                 Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
                 return Containers::NullOpt;
             }
 
-            if(textureCoordinates.empty()) textureCoordinates.emplace_back();
             textureCoordinates.front().emplace_back(data);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            if(normals.empty()) normals.emplace_back();
-            normals.front().emplace_back(extractFloatData<3>(contents));
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
+            normals.front().emplace_back(extractFloatData<3>(contents, lineEnd));
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(equals(keywordBegin, keywordEnd, "p") ||
+                  equals(keywordBegin, keywordEnd, "l") ||
+                  equals(keywordBegin, keywordEnd, "f")) {
+            /* Count the index tuples first */
+            std::size_t indexTupleCount = 0;
+            for(const char* tuple = contents; tuple != lineEnd; tuple = skipSpaces(skipToken(tuple, lineEnd), lineEnd))
+                ++indexTupleCount;
 
             /* Points */
-            if(keyword == "p") {
+            if(*keywordBegin == 'p') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Points) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
@@ -300,7 +335,7 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
+                if(indexTupleCount != 1) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
                     return Containers::NullOpt;
                 }
@@ -308,7 +343,7 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(*keywordBegin == 'l') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Lines) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
@@ -316,7 +351,7 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
+                if(indexTupleCount != 2) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
                     return Containers::NullOpt;
                 }
@@ -324,7 +359,7 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(*keywordBegin == 'f') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Triangles) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
@@ -332,10 +367,10 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
+                if(indexTupleCount < 3) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
                     return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
+                } else if(indexTupleCount != 3) {
                     Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
                     return Containers::NullOpt;
                 }
@@ -344,40 +379,47 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
 
             } else CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return Containers::NullOpt;
+            for(const char* tuple = contents; tuple != lineEnd; ) {
+                const char* const tupleEnd = skipToken(tuple, lineEnd);
+
+                /* Split the tuple on slashes */
+                const char* partBegin[3]{tuple};
+                const char* partEnd[3];
+                std::size_t partCount = 1;
+                for(const char* c = tuple; c != tupleEnd; ++c) if(*c == '/') {
+                    if(partCount == 3) {
+                        Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
+                        return Containers::NullOpt;
+                    }
+                    partEnd[partCount - 1] = c;
+                    partBegin[partCount++] = c + 1;
                 }
+                partEnd[partCount - 1] = tupleEnd;
 
                 /* Position indices */
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
+                positionIndices.push_back(parseIndex(partBegin[0], partEnd[0]) - mesh.positionIndexOffset);
 
                 /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty()))
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
+                if(partCount == 2 || (partCount == 3 && partBegin[1] != partEnd[1]))
+                    textureCoordinateIndices.push_back(parseIndex(partBegin[1], partEnd[1]) - mesh.textureCoordinateIndexOffset);
 
                 /* Normal indices */
-                if(indices.size() == 3)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
+                if(partCount == 3)
+                    normalIndices.push_back(parseIndex(partBegin[2], partEnd[2]) - mesh.normalIndexOffset);
+
+                tuple = skipSpaces(tupleEnd, lineEnd);
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+        } else if(!equals(keywordBegin, keywordEnd, "mtllib") &&
+                  !equals(keywordBegin, keywordEnd, "usemtl") &&
+                  !equals(keywordBegin, keywordEnd, "g") &&
+                  !equals(keywordBegin, keywordEnd, "s")) {
+            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << std::string{keywordBegin, keywordEnd};
             return Containers::NullOpt;
         }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
+    }} catch(...) {
         /* Error message already printed */
         return Containers::NullOpt;
     }
@@ -443,6 +485,196 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     return MeshData3D{*primitive, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates), {}, nullptr};
 }
 
+}
+
+ObjImporter::ObjImporter() = default;
+
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+ObjImporter::~ObjImporter() = default;
+
+auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+void ObjImporter::doClose() { _file.reset(); }
+
+bool ObjImporter::doIsOpened() const { return !!_file; }
+
+void ObjImporter::doOpenFile(const std::string& filename) {
+    if(!Utility::Directory::fileExists(filename)) {
+        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    /* Map the file or read it at once if that's not possible, and parse
+       directly from it */
+    _file.reset(new File);
+    Containers::Optional<Containers::Array<char>> mapped;
+    if(configuration().value<bool>("mmap") && (mapped = Magnum::Implementation::mapFile(filename)))
+        _file->data = std::move(*mapped);
+    else _file->data = Utility::Directory::read(filename);
+    parseMeshNames();
+}
+
+void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
+    /* The data aren't guaranteed to stay in scope after this function exits,
+       so a copy has to be made */
+    _file.reset(new File);
+    _file->data = Containers::Array<char>{Containers::NoInit, data.size()};
+    std::copy(data.begin(), data.end(), _file->data.begin());
+
+    parseMeshNames();
+}
+
+void ObjImporter::parseMeshNames() {
+    const char* const begin = _file->data.begin();
+    const char* const end = _file->data.end();
+
+    /* First mesh starts at the beginning, its indices start from 1. The end
+       offset will be updated to proper value later. */
+    UnsignedInt positionIndexOffset = 1;
+    UnsignedInt textureCoordinateIndexOffset = 1;
+    UnsignedInt normalIndexOffset = 1;
+    UnsignedInt primitiveCount = 0;
+    _file->meshes.push_back({0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
+
+    /* The first mesh doesn't have name by default but we might find it later,
+       so we need to track whether there are any data before first name */
+    bool thisIsFirstMeshAndItHasNoData = true;
+    _file->meshNames.emplace_back();
+
+    /* Saves counts of data in the current (last) mesh */
+    auto finishMesh = [&]() {
+        MeshInfo& mesh = _file->meshes.back();
+        mesh.positionCount = positionIndexOffset - mesh.positionIndexOffset;
+        mesh.textureCoordinateCount = textureCoordinateIndexOffset - mesh.textureCoordinateIndexOffset;
+        mesh.normalCount = normalIndexOffset - mesh.normalIndexOffset;
+        mesh.primitiveCount = primitiveCount;
+    };
+
+    for(const char* it = begin; it != end; ) {
+        /* The previous object might end at the beginning of this line */
+        const char* const lineBegin = it;
+        const char* const lineEnd = findLineEnd(it, end);
+        const char* const next = lineEnd == end ? end : lineEnd + 1;
+
+        /* Parse the keyword */
+        const char* const keywordBegin = skipSpaces(lineBegin, lineEnd);
+        const char* const keywordEnd = skipToken(keywordBegin, lineEnd);
+        it = next;
+
+        /* Empty and comment line */
+        if(keywordBegin == keywordEnd || *keywordBegin == '#') continue;
+
+        /* Mesh name */
+        if(equals(keywordBegin, keywordEnd, "o")) {
+            const char* const nameBegin = skipSpaces(keywordEnd, lineEnd);
+            const char* nameEnd = lineEnd;
+            while(nameEnd != nameBegin && isSpace(nameEnd[-1])) --nameEnd;
+            std::string name{nameBegin, nameEnd};
+
+            /* This is the name of first mesh */
+            if(thisIsFirstMeshAndItHasNoData) {
+                thisIsFirstMeshAndItHasNoData = false;
+
+                /* Update its name and add it to name map */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
+                _file->meshNames.back() = std::move(name);
+
+                /* Update its begin offset to be more precise */
+                _file->meshes.back().begin = next - begin;
+
+            /* Otherwise this is a name of new mesh */
+            } else {
+                /* Set end and data counts of the previous one */
+                _file->meshes.back().end = lineBegin - begin;
+                finishMesh();
+
+                /* Save name and offset of the new one. The end offset will be
+                   updated later. */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size());
+                _file->meshNames.emplace_back(std::move(name));
+                _file->meshes.push_back({std::size_t(next - begin), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
+                primitiveCount = 0;
+            }
+
+        /* If there are any data/indices before the first name, it means that
+           the first object is unnamed. We need to check for them. */
+
+        /* Vertex data, update index offset for the following meshes */
+        } else if(equals(keywordBegin, keywordEnd, "v")) {
+            ++positionIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
+            ++textureCoordinateIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
+            ++normalIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+
+        /* Index data, count the primitives and mark that we found something
+           for first unnamed object */
+        } else if(equals(keywordBegin, keywordEnd, "p") ||
+                  equals(keywordBegin, keywordEnd, "l") ||
+                  equals(keywordBegin, keywordEnd, "f")) {
+            ++primitiveCount;
+            thisIsFirstMeshAndItHasNoData = false;
+        }
+    }
+
+    /* Set end of the last object */
+    _file->meshes.back().end = end - begin;
+    finishMesh();
+}
+
+UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
+
+Int ObjImporter::doMesh3DForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string ObjImporter::doMesh3DName(UnsignedInt id) {
+    return _file->meshNames[id];
+}
+
+Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
+    #if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+    /* Decode all meshes in parallel on first access, if enabled */
+    if(_file->prefetched.empty() && _file->meshes.size() > 1 && configuration().value<bool>("parallel"))
+        prefetchMeshes();
+
+    /* If the mesh was prefetched, move it out. Repeated requests and meshes
+       that failed to import (so the error message gets printed) go through
+       the serial path. */
+    if(!_file->prefetched.empty() && _file->prefetched[id]) {
+        Containers::Optional<MeshData3D> mesh = std::move(_file->prefetched[id]);
+        _file->prefetched[id] = Containers::NullOpt;
+        return mesh;
+    }
+    #endif
+
+    return parseMesh(_file->data, _file->meshes[id]);
+}
+
+#if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+void ObjImporter::prefetchMeshes() {
+    _file->prefetched.resize(_file->meshes.size());
+
+    /* Each mesh is parsed with its own cursor over the shared data. Every
+       output slot is written by exactly one worker. */
+    File& file = *_file;
+    Magnum::Implementation::parallelFor(file.meshes.size(), configuration().value<UnsignedInt>("threads"), [&file](const std::size_t i) {
+        /* Debug output redirection is thread-local in multithreaded builds.
+           Errors get printed again by the serial path when the mesh is
+           requested, so silence them here. */
+        Error redirectError{nullptr};
+        file.prefetched[i] = parseMesh(file.data, file.meshes[i]);
+    });
+}
+#endif
+
 }}
 
 CORRADE_PLUGIN_REGISTER(ObjImporter, Magnum::Trade::ObjImporter,
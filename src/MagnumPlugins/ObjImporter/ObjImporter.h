@@ -71,7 +71,31 @@ for more information.
 @section Trade-ObjImporter-limitations Behavior and limitations
 
 Polygons (quads etc.), automatic normal generation and material properties are
-currently not supported.
+currently not supported. Only positive (absolute) indices are supported.
+
+The whole file is kept in memory and parsed in place without any intermediate
+per-line allocations. When opening a file, it's memory-mapped on Unix
+platforms; when opening data, a single copy is made. Each mesh is parsed only
+when requested through @ref mesh3D(). Set the @cb{.ini} mmap @ce
+configuration option to @cpp false @ce to always read the whole file instead,
+which is also what happens if file callbacks are set or the file can't be
+mapped.
+
+@section Trade-ObjImporter-parallel Parallel import
+
+If the @cb{.ini} parallel @ce configuration option is enabled and the file
+contains more than one mesh, the first call to @ref mesh3D() decodes all meshes
+concurrently on a set of worker threads and the subsequent calls return the
+already decoded data. The result is the same as with the serial import, meshes
+that failed to import are parsed again on request to print the error message.
+Use the @cb{.ini} threads @ce option to limit the worker thread count. This
+feature is available only if Magnum is built with
+@ref MAGNUM_BUILD_MULTITHREADED enabled (and Corrade with
+@ref CORRADE_BUILD_MULTITHREADED), otherwise the option is ignored.
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf config
+
+See @ref plugins-configuration for more information.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -99,6 +123,9 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
         MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData3D> doMesh3D(UnsignedInt id) override;
 
         MAGNUM_OBJIMPORTER_LOCAL void parseMeshNames();
+        #if defined(MAGNUM_BUILD_MULTITHREADED) && defined(CORRADE_BUILD_MULTITHREADED)
+        MAGNUM_OBJIMPORTER_LOCAL void prefetchMeshes();
+        #endif
 
         std::unique_ptr<File> _file;
 };
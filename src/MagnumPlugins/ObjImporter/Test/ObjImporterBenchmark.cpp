@@ -0,0 +1,174 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/String.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ObjImporterBenchmark: TestSuite::Tester {
+    explicit ObjImporterBenchmark();
+
+    void openData();
+    void mesh3D();
+    void mesh3DIstream();
+
+    private:
+        std::string _data;
+
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+/* Vertex count along one side of the generated grid */
+constexpr UnsignedInt GridSize = 384;
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    addBenchmarks({&ObjImporterBenchmark::openData,
+                   &ObjImporterBenchmark::mesh3D,
+                   &ObjImporterBenchmark::mesh3DIstream}, 5);
+
+    #ifdef OBJIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* A grid with ~150k vertices and ~300k triangles, each vertex having a
+       position, a texture coordinate and a normal, taking about 20 MB */
+    std::ostringstream out;
+    out << "# Generated grid\no Grid\n";
+    for(UnsignedInt y = 0; y != GridSize; ++y)
+        for(UnsignedInt x = 0; x != GridSize; ++x)
+            out << "v " << x*0.125f << " " << (x ^ y)*0.0078125f - 1.5f << " " << y*-0.375f << "\n";
+    for(UnsignedInt y = 0; y != GridSize; ++y)
+        for(UnsignedInt x = 0; x != GridSize; ++x)
+            out << "vt " << Float(x)/GridSize << " " << Float(y)/GridSize << "\n";
+    for(UnsignedInt y = 0; y != GridSize; ++y)
+        for(UnsignedInt x = 0; x != GridSize; ++x)
+            out << "vn 0 " << Float(x)/GridSize << " " << Float(y)/GridSize << "\n";
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) {
+        for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+            const UnsignedInt a = y*GridSize + x + 1;
+            const UnsignedInt b = a + 1;
+            const UnsignedInt c = a + GridSize;
+            const UnsignedInt d = c + 1;
+            out << "f " << a << "/" << a << "/" << a << " "
+                        << b << "/" << b << "/" << b << " "
+                        << d << "/" << d << "/" << d << "\n"
+                << "f " << a << "/" << a << "/" << a << " "
+                        << d << "/" << d << "/" << d << " "
+                        << c << "/" << c << "/" << c << "\n";
+        }
+    }
+    _data = out.str();
+}
+
+void ObjImporterBenchmark::openData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    CORRADE_BENCHMARK(1)
+        CORRADE_VERIFY(importer->openData({_data.data(), _data.size()}));
+
+    CORRADE_COMPARE(importer->mesh3DCount(), 1);
+    CORRADE_COMPARE(importer->mesh3DName(0), "Grid");
+}
+
+void ObjImporterBenchmark::mesh3D() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData({_data.data(), _data.size()}));
+
+    Containers::Optional<MeshData3D> data;
+    CORRADE_BENCHMARK(1)
+        data = importer->mesh3D(0);
+
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data->indices().size(), (GridSize - 1)*(GridSize - 1)*6);
+    CORRADE_COMPARE(data->positions(0).size(), GridSize*GridSize);
+    CORRADE_COMPARE(data->positions(0)[GridSize + 1], (Vector3{0.125f, -1.5f, -0.375f}));
+}
+
+/* The std::istream and std::string based tokenization that the plugin used
+   before, kept here for comparison. Parses just the raw vertex and index
+   data, without any validation or index merging. */
+void ObjImporterBenchmark::mesh3DIstream() {
+    std::vector<Vector3> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
+    std::vector<UnsignedInt> positionIndices;
+    std::vector<UnsignedInt> textureCoordinateIndices;
+    std::vector<UnsignedInt> normalIndices;
+
+    CORRADE_BENCHMARK(1) {
+        positions.clear();
+        textureCoordinates.clear();
+        normals.clear();
+        positionIndices.clear();
+        textureCoordinateIndices.clear();
+        normalIndices.clear();
+
+        std::istringstream in{_data};
+        while(in.good()) {
+            std::string line;
+            std::getline(in, line);
+            line = Utility::String::trim(line);
+            if(line.empty() || line[0] == '#') continue;
+
+            const std::size_t keywordEnd = line.find(' ');
+            const std::string keyword = line.substr(0, keywordEnd);
+            const std::string contents = keywordEnd != std::string::npos ?
+                Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+            const std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(contents, ' ');
+
+            if(keyword == "v")
+                positions.emplace_back(std::stof(data[0]), std::stof(data[1]), std::stof(data[2]));
+            else if(keyword == "vt")
+                textureCoordinates.emplace_back(std::stof(data[0]), std::stof(data[1]));
+            else if(keyword == "vn")
+                normals.emplace_back(std::stof(data[0]), std::stof(data[1]), std::stof(data[2]));
+            else if(keyword == "f") for(const std::string& indexTuple: data) {
+                const std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
+                positionIndices.push_back(std::stoul(indices[0]) - 1);
+                textureCoordinateIndices.push_back(std::stoul(indices[1]) - 1);
+                normalIndices.push_back(std::stoul(indices[2]) - 1);
+            }
+        }
+    }
+
+    CORRADE_COMPARE(positionIndices.size(), (GridSize - 1)*(GridSize - 1)*6);
+    CORRADE_COMPARE(positions.size(), GridSize*GridSize);
+    CORRADE_COMPARE(positions[GridSize + 1], (Vector3{0.125f, -1.5f, -0.375f}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
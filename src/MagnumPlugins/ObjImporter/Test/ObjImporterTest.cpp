@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Mesh.h"
@@ -42,6 +43,7 @@ struct ObjImporterTest: TestSuite::Tester {
     void pointMesh();
     void lineMesh();
     void triangleMesh();
+    void triangleMeshNoMmap();
     void mixedPrimitives();
 
     void positionsOnly();
@@ -89,6 +91,12 @@ struct ObjImporterTest: TestSuite::Tester {
     void unsupportedKeyword();
     void unknownKeyword();
 
+    void openData();
+    void whitespace();
+
+    void parallel();
+    void parallelErrors();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -97,6 +105,7 @@ ObjImporterTest::ObjImporterTest() {
     addTests({&ObjImporterTest::pointMesh,
               &ObjImporterTest::lineMesh,
               &ObjImporterTest::triangleMesh,
+              &ObjImporterTest::triangleMeshNoMmap,
               &ObjImporterTest::mixedPrimitives,
 
               &ObjImporterTest::positionsOnly,
@@ -142,7 +151,13 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::wrongNormalIndexCount,
 
               &ObjImporterTest::unsupportedKeyword,
-              &ObjImporterTest::unknownKeyword});
+              &ObjImporterTest::unknownKeyword,
+
+              &ObjImporterTest::openData,
+              &ObjImporterTest::whitespace,
+
+              &ObjImporterTest::parallel,
+              &ObjImporterTest::parallelErrors});
 
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
@@ -207,6 +222,25 @@ void ObjImporterTest::triangleMesh() {
     }));
 }
 
+void ObjImporterTest::triangleMeshNoMmap() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("mmap", false);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "triangleMesh.obj")));
+    CORRADE_COMPARE(importer->mesh3DCount(), 1);
+
+    const Containers::Optional<MeshData3D> data = importer->mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->positions(0), (std::vector<Vector3>{
+        {0.5f, 2.0f, 3.0f},
+        {0.0f, 1.5f, 1.0f},
+        {2.0f, 3.0f, 5.0f},
+        {2.5f, 0.0f, 1.0f}
+    }));
+    CORRADE_COMPARE(data->indices(), (std::vector<UnsignedInt>{
+        0, 1, 2, 3, 1, 0
+    }));
+}
+
 void ObjImporterTest::mixedPrimitives() {
     std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "mixedPrimitives.obj")));
@@ -739,6 +773,130 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): unknown keyword bleh\n");
 }
 
+void ObjImporterTest::openData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    /* The data should be copied and not referenced after the call */
+    {
+        std::string data = "o Points\nv 0.5 2 3\nv 0 1.5 1\np 2\np 1\n";
+        CORRADE_VERIFY(importer->openData({data.data(), data.size()}));
+        data.assign(data.size(), '!');
+    }
+
+    CORRADE_COMPARE(importer->mesh3DCount(), 1);
+    CORRADE_COMPARE(importer->mesh3DName(0), "Points");
+
+    const Containers::Optional<MeshData3D> data = importer->mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(data->positions(0), (std::vector<Vector3>{
+        {0.5f, 2.0f, 3.0f},
+        {0.0f, 1.5f, 1.0f}
+    }));
+    CORRADE_COMPARE(data->indices(), (std::vector<UnsignedInt>{1, 0}));
+}
+
+void ObjImporterTest::whitespace() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    /* CRLF line endings, tabs, leading and trailing whitespace, indented
+       comments and no newline at the end */
+    const char data[] =
+        "# A comment\r\n"
+        "o \tLines \r\n"
+        "\tv 0.5\t2  3 \r\n"
+        "v -1e1 +.5 7.25E-1\r\n"
+        "  # Another comment\r\n"
+        "\r\n"
+        "vn 0 0 1\r\n"
+        "l  1//1\t2//1\t\r\n"
+        "\r\n"
+        "o Last\r\n"
+        "v 1 2 3\r\n"
+        "p 3";
+    CORRADE_VERIFY(importer->openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer->mesh3DCount(), 2);
+    CORRADE_COMPARE(importer->mesh3DName(0), "Lines");
+    CORRADE_COMPARE(importer->mesh3DName(1), "Last");
+
+    {
+        const Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+        CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+            {0.5f, 2.0f, 3.0f},
+            {-10.0f, 0.5f, 0.725f}
+        }));
+        CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+        CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>{
+            {0.0f, 0.0f, 1.0f},
+            {0.0f, 0.0f, 1.0f}
+        }));
+        CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1}));
+    } {
+        const Containers::Optional<MeshData3D> mesh = importer->mesh3D(1);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+        CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+            {1.0f, 2.0f, 3.0f}
+        }));
+        CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0}));
+    }
+}
+
+void ObjImporterTest::parallel() {
+    #if !defined(MAGNUM_BUILD_MULTITHREADED) || !defined(CORRADE_BUILD_MULTITHREADED)
+    CORRADE_SKIP("Parallel import requires a multithreaded build.");
+    #else
+    std::unique_ptr<AbstractImporter> serial = _manager.instantiate("ObjImporter");
+    std::unique_ptr<AbstractImporter> parallel = _manager.instantiate("ObjImporter");
+    parallel->configuration().setValue("parallel", true);
+    parallel->configuration().setValue("threads", 2);
+    CORRADE_VERIFY(serial->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+    CORRADE_VERIFY(parallel->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+    CORRADE_COMPARE(parallel->mesh3DCount(), 3);
+
+    /* Go in reverse order to not accidentally depend on it, then once more
+       to verify that repeated requests give the same result */
+    for(UnsignedInt i: {2, 1, 0, 2, 1, 0}) {
+        const Containers::Optional<MeshData3D> expected = serial->mesh3D(i);
+        const Containers::Optional<MeshData3D> actual = parallel->mesh3D(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(actual);
+        CORRADE_COMPARE(actual->primitive(), expected->primitive());
+        CORRADE_COMPARE(actual->indices(), expected->indices());
+        CORRADE_COMPARE(actual->positions(0), expected->positions(0));
+        CORRADE_COMPARE(actual->normalArrayCount(), expected->normalArrayCount());
+        if(expected->hasNormals())
+            CORRADE_COMPARE(actual->normals(0), expected->normals(0));
+        CORRADE_COMPARE(actual->textureCoords2DArrayCount(), expected->textureCoords2DArrayCount());
+        if(expected->hasTextureCoords2D())
+            CORRADE_COMPARE(actual->textureCoords2D(0), expected->textureCoords2D(0));
+    }
+    #endif
+}
+
+void ObjImporterTest::parallelErrors() {
+    #if !defined(MAGNUM_BUILD_MULTITHREADED) || !defined(CORRADE_BUILD_MULTITHREADED)
+    CORRADE_SKIP("Parallel import requires a multithreaded build.");
+    #else
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("parallel", true);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
+    CORRADE_COMPARE(importer->mesh3DCount(), 5);
+
+    /* Errors from the worker threads shouldn't leak anywhere, each should be
+       printed exactly once when given mesh is requested */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh3D(importer->mesh3DForName("ZeroIndex")));
+    CORRADE_VERIFY(!importer->mesh3D(importer->mesh3DForName("WrongFloat")));
+    CORRADE_COMPARE(out.str(),
+        "Trade::ObjImporter::mesh3D(): index out of range\n"
+        "Trade::ObjImporter::mesh3D(): error while converting numeric data\n");
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
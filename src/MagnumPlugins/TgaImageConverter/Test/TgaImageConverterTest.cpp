@@ -28,6 +28,7 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Image.h"
@@ -48,6 +49,9 @@ struct TgaImageConverterTest: TestSuite::Tester {
     void rgb();
     void rgba();
 
+    void rle();
+    void rleSmaller();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImageConverter> _converterManager{"nonexistent"};
     PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
@@ -78,11 +82,23 @@ constexpr char OriginalDataRGBA[] = {
 };
 const ImageView2D OriginalRGBA{PixelFormat::RGBA8Unorm, {2, 3}, OriginalDataRGBA};
 
+constexpr struct {
+    const char* name;
+    bool rle;
+} CompressionData[] {
+    {"uncompressed", false},
+    {"RLE", true}
+};
+
 TgaImageConverterTest::TgaImageConverterTest() {
-    addTests({&TgaImageConverterTest::wrongFormat,
+    addTests({&TgaImageConverterTest::wrongFormat});
 
-              &TgaImageConverterTest::rgb,
-              &TgaImageConverterTest::rgba});
+    addInstancedTests({&TgaImageConverterTest::rgb,
+                       &TgaImageConverterTest::rgba},
+        Containers::arraySize(CompressionData));
+
+    addTests({&TgaImageConverterTest::rle,
+              &TgaImageConverterTest::rleSmaller});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -108,15 +124,20 @@ void TgaImageConverterTest::wrongFormat() {
 }
 
 void TgaImageConverterTest::rgb() {
+    auto&& data = CompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
-    const auto data = converter->exportToData(OriginalRGB);
-    CORRADE_VERIFY(data);
+    converter->configuration().setValue("rle", data.rle);
+    const auto output = converter->exportToData(OriginalRGB);
+    CORRADE_VERIFY(output);
+    CORRADE_COMPARE(output[2], char(data.rle ? 10 : 2));
 
     if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
         CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
 
     std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
-    CORRADE_VERIFY(importer->openData(data));
+    CORRADE_VERIFY(importer->openData(output));
     Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
     CORRADE_VERIFY(converted);
 
@@ -128,15 +149,20 @@ void TgaImageConverterTest::rgb() {
 }
 
 void TgaImageConverterTest::rgba() {
+    auto&& data = CompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
-    const auto data = converter->exportToData(OriginalRGBA);
-    CORRADE_VERIFY(data);
+    converter->configuration().setValue("rle", data.rle);
+    const auto output = converter->exportToData(OriginalRGBA);
+    CORRADE_VERIFY(output);
+    CORRADE_COMPARE(output[2], char(data.rle ? 10 : 2));
 
     if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
         CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
 
     std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
-    CORRADE_VERIFY(importer->openData(data));
+    CORRADE_VERIFY(importer->openData(output));
     Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
     CORRADE_VERIFY(converted);
 
@@ -147,6 +173,56 @@ void TgaImageConverterTest::rgba() {
         TestSuite::Compare::Container);
 }
 
+void TgaImageConverterTest::rle() {
+    /* The sevens at the end of the first row and at the start of the second
+       shouldn't end up in a single packet */
+    constexpr char original[] = {
+        1, 1, 1, 1, 2, 3, 3, 7,
+        7, 7, 7, 4, 5, 6, 8, 8
+    };
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    converter->configuration().setValue("rle", true);
+    const auto output = converter->exportToData(ImageView2D{PixelFormat::R8Unorm, {8, 2}, original});
+    CORRADE_VERIFY(output);
+
+    /* Runs of two single-byte pixels are stored as raw */
+    constexpr char expected[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 2, 0, 8, 0,
+        '\x83', 1, '\x03', 2, 3, 3, 7,
+        '\x82', 7, '\x04', 4, 5, 6, 8, 8
+    };
+    CORRADE_COMPARE_AS(output, Containers::arrayView(expected),
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+}
+
+void TgaImageConverterTest::rleSmaller() {
+    Containers::Array<char> original{Containers::ValueInit, 64*64*4};
+    for(std::size_t i = 0; i != original.size(); ++i)
+        original[i] = char(i/(16*4));
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    const auto uncompressed = converter->exportToData(ImageView2D{PixelFormat::RGBA8Unorm, {64, 64}, original});
+    converter->configuration().setValue("rle", true);
+    const auto compressed = converter->exportToData(ImageView2D{PixelFormat::RGBA8Unorm, {64, 64}, original});
+    CORRADE_VERIFY(uncompressed);
+    CORRADE_VERIFY(compressed);
+    CORRADE_COMPARE(uncompressed.size(), 18 + 64*64*4);
+    /* Each row has four runs of 16 pixels */
+    CORRADE_COMPARE(compressed.size(), 18 + 64*4*5);
+
+    if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
+
+    std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(compressed));
+    Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(64, 64));
+    CORRADE_COMPARE_AS(converted->data(), original,
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterTest)
@@ -26,19 +26,62 @@
 #include "TgaImageConverter.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <tuple>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
+#include "MagnumPlugins/TgaImporter/TgaSwizzle.h"
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+/* Encodes a row of pixels as RLE packets, returns the end of the output */
+char* encodeRle(const char* const in, const std::size_t pixelCount, const std::size_t pixelSize, char* out) {
+    /* How many times given pixel repeats, limited by the packet size */
+    const auto runLength = [&](const std::size_t i) {
+        std::size_t count = 1;
+        while(i + count != pixelCount && count != 128 && std::memcmp(in + i*pixelSize, in + (i + count)*pixelSize, pixelSize) == 0)
+            ++count;
+        return count;
+    };
+
+    /* A run-length packet of two single-byte pixels is as large as a raw
+       packet with them, but it splits the surrounding raw packet in two */
+    const std::size_t minRunLength = pixelSize == 1 ? 3 : 2;
+
+    std::size_t i = 0;
+    while(i != pixelCount) {
+        /* If the pixel repeats, emit a run-length packet with it */
+        std::size_t count = runLength(i);
+        if(count >= minRunLength) {
+            *out++ = char(0x80|(count - 1));
+            out = std::copy_n(in + i*pixelSize, pixelSize, out);
+            i += count;
+            continue;
+        }
+
+        /* Otherwise gather pixels into a raw packet until a repeating one is
+           found */
+        count = 1;
+        while(i + count != pixelCount && count != 128 && runLength(i + count) < minRunLength)
+            ++count;
+        *out++ = char(count - 1);
+        out = std::copy_n(in + i*pixelSize, count*pixelSize, out);
+        i += count;
+    }
+
+    return out;
+}
+
+}
+
 TgaImageConverter::TgaImageConverter() = default;
 
 TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImageConverter{manager, plugin} {}
@@ -46,6 +89,8 @@ TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, co
 auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
 
 Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& image) {
+    const bool rle = configuration().value<bool>("rle");
+
     /* Initialize data buffer */
     const auto pixelSize = UnsignedByte(image.pixelSize());
     Containers::Array<char> data{Containers::ValueInit, sizeof(Implementation::TgaHeader) + pixelSize*image.size().product()};
@@ -55,10 +100,10 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& ima
     switch(image.format()) {
         case PixelFormat::RGB8Unorm:
         case PixelFormat::RGBA8Unorm:
-            header->imageType = 2;
+            header->imageType = rle ? 10 : 2;
             break;
         case PixelFormat::R8Unorm:
-            header->imageType = 3;
+            header->imageType = rle ? 11 : 3;
             break;
         default:
             Error() << "Trade::TgaImageConverter::exportToData(): unsupported pixel format" << image.format();
@@ -79,17 +124,28 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& ima
             std::copy_n(imageData + y*rowStride, rowSize, data.begin() + sizeof(Implementation::TgaHeader) + y*rowSize);
     } else std::copy_n(imageData, pixelSize*image.size().product(), data.begin() + sizeof(Implementation::TgaHeader));
 
-    if(image.format() == PixelFormat::RGB8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(Implementation::TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == PixelFormat::RGBA8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(Implementation::TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
-    }
-
-    return data;
+    char* const pixels = data.begin() + sizeof(Implementation::TgaHeader);
+    if(image.format() == PixelFormat::RGB8Unorm)
+        Implementation::swizzleBgr(pixels, pixels, image.size().product());
+    else if(image.format() == PixelFormat::RGBA8Unorm)
+        Implementation::swizzleBgra(pixels, pixels, image.size().product());
+
+    if(!rle) return data;
+
+    /* Compress each row separately, as recommended by the specification. Each
+       run-length packet is smaller than the pixels it replaces, so in the
+       worst case there's one extra byte for every 128 pixels plus one for
+       each row. */
+    Containers::Array<char> compressed{Containers::NoInit, data.size() + image.size().y()*(image.size().x()/128 + 1)};
+    std::copy_n(data.begin(), sizeof(Implementation::TgaHeader), compressed.begin());
+    char* out = compressed.begin() + sizeof(Implementation::TgaHeader);
+    for(std::int_fast32_t y = 0; y != image.size().y(); ++y)
+        out = encodeRle(pixels + y*rowSize, image.size().x(), pixelSize, out);
+
+    /* Copy to an array of the final size */
+    Containers::Array<char> result{Containers::NoInit, std::size_t(out - compressed.begin())};
+    std::copy_n(compressed.begin(), result.size(), result.begin());
+    return result;
 }
 
 }}
@@ -66,6 +66,14 @@ dependency of another plugin with CMake, you need to request the
 `TgaImageConverter` component of the `Magnum` package and link to the
 `Magnum::TgaImageConverter` target. See @ref building, @ref cmake and
 @ref plugins for more information.
+
+The output is uncompressed by default. Enable the @cb{.ini} rle @ce
+configuration option to compress it with run-length encoding, which is then
+understood by @ref TgaImporter as well.
+
+@snippet MagnumPlugins/TgaImageConverter/TgaImageConverter.conf config
+
+See @ref plugins-configuration for more information.
 */
 class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageConverter {
     public:
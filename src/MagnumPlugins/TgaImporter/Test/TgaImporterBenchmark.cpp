@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/TgaImporter/TgaHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct TgaImporterBenchmark: TestSuite::Tester {
+    explicit TgaImporterBenchmark();
+
+    void openFileMapped();
+    void openFileRead();
+
+    #ifdef __linux__
+    void peakMemoryBegin();
+    std::uint64_t peakMemoryEnd();
+    #endif
+
+    private:
+        void load(bool mmap);
+
+        std::string _filename;
+        #ifdef __linux__
+        std::uint64_t _memoryBegin{};
+        #endif
+
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+/* 64 MB of RGBA data */
+constexpr Vector2i ImageSize{4096, 4096};
+
+TgaImporterBenchmark::TgaImporterBenchmark() {
+    addBenchmarks({&TgaImporterBenchmark::openFileMapped,
+                   &TgaImporterBenchmark::openFileRead}, 5);
+
+    /* Peak memory use, measurable only on Linux */
+    #ifdef __linux__
+    addCustomBenchmarks({&TgaImporterBenchmark::openFileMapped,
+                         &TgaImporterBenchmark::openFileRead}, 1,
+        &TgaImporterBenchmark::peakMemoryBegin,
+        &TgaImporterBenchmark::peakMemoryEnd,
+        BenchmarkUnits::Bytes);
+    #endif
+
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    Containers::Array<char> data{Containers::ValueInit, sizeof(Implementation::TgaHeader) + ImageSize.product()*4};
+    auto& header = *reinterpret_cast<Implementation::TgaHeader*>(data.data());
+    header.imageType = 2;
+    header.width = Utility::Endianness::littleEndian(UnsignedShort(ImageSize.x()));
+    header.height = Utility::Endianness::littleEndian(UnsignedShort(ImageSize.y()));
+    header.bpp = 32;
+    /* The file stores BGRA, the low byte of pixel index goes to blue */
+    auto pixels = reinterpret_cast<Color4ub*>(data.data() + sizeof(Implementation::TgaHeader));
+    for(std::size_t i = 0, size = ImageSize.product(); i != size; ++i)
+        pixels[i] = {UnsignedByte(i), UnsignedByte(i >> 8), UnsignedByte(i >> 16), 0xff};
+
+    Utility::Directory::mkpath(TGAIMPORTER_TEST_WRITE_DIR);
+    _filename = Utility::Directory::join(TGAIMPORTER_TEST_WRITE_DIR, "benchmark.tga");
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::write(_filename, data));
+}
+
+#ifdef __linux__
+/* Value of given memory field in /proc/self/status, converted to bytes */
+std::uint64_t processMemory(const char* const field) {
+    std::ifstream in{"/proc/self/status"};
+    const std::size_t fieldSize = std::strlen(field);
+    std::string line;
+    while(std::getline(in, line))
+        if(line.compare(0, fieldSize, field) == 0)
+            return std::stoull(line.substr(fieldSize))*1024;
+    return 0;
+}
+
+void TgaImporterBenchmark::peakMemoryBegin() {
+    /* Reset the peak resident set size to the current resident set size so
+       only what happens during the benchmark gets measured */
+    std::ofstream{"/proc/self/clear_refs"} << "5";
+    _memoryBegin = processMemory("VmRSS:");
+}
+
+std::uint64_t TgaImporterBenchmark::peakMemoryEnd() {
+    return processMemory("VmHWM:") - _memoryBegin;
+}
+#endif
+
+void TgaImporterBenchmark::openFileMapped() { load(true); }
+
+void TgaImporterBenchmark::openFileRead() { load(false); }
+
+void TgaImporterBenchmark::load(const bool mmap) {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->configuration().setValue("mmap", mmap);
+
+    Containers::Optional<ImageData2D> image;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openFile(_filename));
+        image = importer->image2D(0);
+    }
+
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), ImageSize);
+    CORRADE_COMPARE(reinterpret_cast<const Color4ub*>(image->data().data())[ImageSize.x() + 2], (Color4ub{0x00, 0x10, 0x02, 0xff}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterBenchmark)
@@ -27,6 +27,7 @@
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/PixelFormat.h"
@@ -37,10 +38,27 @@
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
 
+constexpr struct {
+    const char* name;
+    bool mmap;
+} OpenFileData[] {
+    {"mapped", true},
+    {"read", false}
+};
+
+constexpr struct {
+    const char* name;
+    char bpp;
+} SwizzleData[] {
+    {"BGR", 24},
+    {"BGRA", 32}
+};
+
 struct TgaImporterTest: TestSuite::Tester {
     explicit TgaImporterTest();
 
     void openShort();
+    void openShortData();
     void paletted();
     void compressed();
 
@@ -51,6 +69,14 @@ struct TgaImporterTest: TestSuite::Tester {
     void grayscaleBits8();
     void grayscaleBits16();
 
+    void rleColorBits24();
+    void rleColorBits32();
+    void rleGrayscale();
+    void rleTooShort();
+    void rleTooLong();
+    void swizzle();
+
+    void openFile();
     void useTwice();
 
     /* Explicitly forbid system-wide plugin dependencies */
@@ -59,6 +85,7 @@ struct TgaImporterTest: TestSuite::Tester {
 
 TgaImporterTest::TgaImporterTest() {
     addTests({&TgaImporterTest::openShort,
+              &TgaImporterTest::openShortData,
               &TgaImporterTest::paletted,
               &TgaImporterTest::compressed,
 
@@ -69,7 +96,19 @@ TgaImporterTest::TgaImporterTest() {
               &TgaImporterTest::grayscaleBits8,
               &TgaImporterTest::grayscaleBits16,
 
-              &TgaImporterTest::useTwice});
+              &TgaImporterTest::rleColorBits24,
+              &TgaImporterTest::rleColorBits32,
+              &TgaImporterTest::rleGrayscale,
+              &TgaImporterTest::rleTooShort,
+              &TgaImporterTest::rleTooLong});
+
+    addInstancedTests({&TgaImporterTest::swizzle},
+        Containers::arraySize(SwizzleData));
+
+    addInstancedTests({&TgaImporterTest::openFile},
+        Containers::arraySize(OpenFileData));
+
+    addTests({&TgaImporterTest::useTwice});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -89,6 +128,22 @@ void TgaImporterTest::openShort() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short: 17 bytes\n");
 }
 
+void TgaImporterTest::openShortData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short: 23 bytes, expected 24\n");
+}
+
 void TgaImporterTest::paletted() {
     std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     const char data[] = { 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -108,7 +163,7 @@ void TgaImporterTest::compressed() {
     std::ostringstream debug;
     Error redirectError{&debug};
     CORRADE_VERIFY(!importer->image2D(0));
-    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported (compressed?) image type: 9\n");
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported image type: 9\n");
 }
 
 void TgaImporterTest::colorBits16() {
@@ -200,6 +255,176 @@ void TgaImporterTest::grayscaleBits16() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel: 16\n");
 }
 
+void TgaImporterTest::rleColorBits24() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Three repeated pixels, crossing a row boundary */
+        '\x82', 1, 2, 3,
+        /* Two raw pixels */
+        '\x01', 4, 5, 6, 7, 8, 9,
+        /* One repeated pixel */
+        '\x80', 10, 11, 12
+    };
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1,
+        3, 2, 1, 6, 5, 4,
+        9, 8, 7, 12, 11, 10
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleColorBits32() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0,
+        '\x01', 1, 2, 3, 4, 5, 6, 7, 8,
+        '\x83', 9, 10, 11, 12
+    };
+    const char pixels[] = {
+        3, 2, 1, 4, 7, 6, 5, 8,
+        11, 10, 9, 12, 11, 10, 9, 12,
+        11, 10, 9, 12, 11, 10, 9, 12
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 4);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleGrayscale() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        '\x83', 1,
+        '\x01', 2, 3
+    };
+    const char pixels[] = {
+        1, 1,
+        1, 1,
+        2, 3
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleTooShort() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        '\x83', 1,
+        '\x01', 2
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the RLE data are too short\n");
+}
+
+void TgaImporterTest::rleTooLong() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        '\x83', 1,
+        '\x82', 2
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): RLE packet of 3 pixels exceeds the image size\n");
+}
+
+void TgaImporterTest::swizzle() {
+    auto&& data = SwizzleData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to go through the vectorized code paths and then the
+       remainder as well */
+    const std::size_t pixelSize = data.bpp/8;
+    Containers::Array<char> file{Containers::ValueInit, 18 + 37*pixelSize};
+    file[2] = 2;
+    file[12] = 37;
+    file[14] = 1;
+    file[16] = data.bpp;
+    for(std::size_t i = 18; i != file.size(); ++i)
+        file[i] = char(i);
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(file));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data().size(), 37*pixelSize);
+    for(std::size_t i = 0; i != 37; ++i) {
+        const char* pixel = image->data() + i*pixelSize;
+        const char* original = file + 18 + i*pixelSize;
+        CORRADE_COMPARE(pixel[0], original[2]);
+        CORRADE_COMPARE(pixel[1], original[1]);
+        CORRADE_COMPARE(pixel[2], original[0]);
+        if(pixelSize == 4) CORRADE_COMPARE(pixel[3], original[3]);
+    }
+}
+
+void TgaImporterTest::openFile() {
+    auto&& data = OpenFileData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->configuration().setValue("mmap", data.mmap);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "color24.tga")));
+
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        7, 6, 5, 8, 7, 6
+    };
+
+    /* The first image is swizzled in place, which shouldn't affect the second
+       one */
+    Containers::Optional<Trade::ImageData2D> first = importer->image2D(0);
+    CORRADE_VERIFY(first);
+    Containers::Optional<Trade::ImageData2D> second = importer->image2D(0);
+    CORRADE_VERIFY(second);
+
+    /* The data should stay valid after the importer is gone */
+    importer = nullptr;
+
+    CORRADE_COMPARE(first->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(first->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(first->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(second->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+
+    /* Modifying the data shouldn't affect the file */
+    first->data()[0] = 0x7f;
+    CORRADE_COMPARE(Utility::Directory::read(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "color24.tga"))[18], 1);
+}
+
 void TgaImporterTest::useTwice() {
     std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
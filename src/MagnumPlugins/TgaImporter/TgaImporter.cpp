@@ -30,15 +30,66 @@
 #include <sstream>
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
+#include "Magnum/Math/Vector2.h"
 #include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/Implementation/mappedFile.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
+#include "MagnumPlugins/TgaImporter/TgaSwizzle.h"
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+/* Decodes RLE packets from `in` until `out` is filled. Packets are allowed to
+   cross row boundaries. */
+bool decodeRle(const Containers::ArrayView<const char> in, const Containers::ArrayView<char> out, const std::size_t pixelSize) {
+    const char* i = in.begin();
+    char* o = out.begin();
+    while(o != out.end()) {
+        if(i == in.end()) {
+            Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+            return false;
+        }
+
+        /* The low seven bits are pixel count minus one */
+        const UnsignedByte packet = *i++;
+        const std::size_t count = (packet & 0x7f) + 1;
+        if(std::size_t(out.end() - o) < count*pixelSize) {
+            Error() << "Trade::TgaImporter::image2D(): RLE packet of" << count << "pixels exceeds the image size";
+            return false;
+        }
+
+        /* Run-length packet, one pixel repeated */
+        if(packet & 0x80) {
+            if(std::size_t(in.end() - i) < pixelSize) {
+                Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+                return false;
+            }
+
+            for(char* const end = o + count*pixelSize; o != end; o += pixelSize)
+                std::copy_n(i, pixelSize, o);
+            i += pixelSize;
+
+        /* Raw packet, pixels copied as-is */
+        } else {
+            if(std::size_t(in.end() - i) < count*pixelSize) {
+                Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+                return false;
+            }
+
+            o = std::copy_n(i, count*pixelSize, o);
+            i += count*pixelSize;
+        }
+    }
+
+    return true;
+}
+
+}
+
 TgaImporter::TgaImporter() = default;
 
 TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
@@ -49,13 +100,32 @@ auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
 bool TgaImporter::doIsOpened() const { return _in; }
 
-void TgaImporter::doClose() { _in = nullptr; }
+void TgaImporter::doClose() {
+    _in = nullptr;
+    _filename = {};
+}
 
 void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
-    _in = Containers::Array<char>{data.size()};
+    _in = Containers::Array<char>{Containers::NoInit, data.size()};
     std::copy(data.begin(), data.end(), _in.begin());
 }
 
+void TgaImporter::doOpenFile(const std::string& filename) {
+    /* Map the file instead of reading it. Only the header page gets touched
+       here, the pixel data are mapped again in doImage2D(). If mapping is not
+       possible, fall back to the default implementation. */
+    if(configuration().value<bool>("mmap")) {
+        Containers::Optional<Containers::Array<char>> mapped = Magnum::Implementation::mapFile(filename);
+        if(mapped) {
+            _in = std::move(*mapped);
+            _filename = filename;
+            return;
+        }
+    }
+
+    AbstractImporter::doOpenFile(filename);
+}
+
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
 Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
@@ -78,8 +148,8 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         return Containers::NullOpt;
     }
 
-    /* Color */
-    if(header.imageType == 2) {
+    /* Color, uncompressed or RLE */
+    if(header.imageType == 2 || header.imageType == 10) {
         switch(header.bpp) {
             case 24:
                 format = PixelFormat::RGB8Unorm;
@@ -92,37 +162,65 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
                 return Containers::NullOpt;
         }
 
-    /* Grayscale */
-    } else if(header.imageType == 3) {
+    /* Grayscale, uncompressed or RLE */
+    } else if(header.imageType == 3 || header.imageType == 11) {
         format = PixelFormat::R8Unorm;
         if(header.bpp != 8) {
             Error() << "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel:" << header.bpp;
             return Containers::NullOpt;
         }
 
-    /* Compressed files */
+    /* Paletted or otherwise unknown */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
+        Error() << "Trade::TgaImporter::image2D(): unsupported image type:" << header.imageType;
         return Containers::NullOpt;
     }
 
-    Containers::Array<char> data{std::size_t(size.product())*header.bpp/8};
-    std::copy_n(_in + sizeof(Implementation::TgaHeader), data.size(), data.begin());
+    const std::size_t pixelSize = header.bpp/8;
+    const std::size_t dataSize = std::size_t(size.product())*pixelSize;
+    Containers::Array<char> data;
+
+    /* RLE data are decoded and then swizzled in place */
+    bool inPlace;
+    const char* in;
+    if(header.imageType & 8) {
+        data = Containers::Array<char>{Containers::NoInit, dataSize};
+        if(!decodeRle({_in + sizeof(Implementation::TgaHeader), _in.size() - sizeof(Implementation::TgaHeader)}, data, pixelSize))
+            return Containers::NullOpt;
+
+        inPlace = true;
+        in = data;
+
+    } else {
+        if(_in.size() < sizeof(Implementation::TgaHeader) + dataSize) {
+            Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes, expected" << sizeof(Implementation::TgaHeader) + dataSize;
+            return Containers::NullOpt;
+        }
+
+        /* If the file was opened through openFile(), map the pixel data
+           directly. The swizzle below then happens in place, making a copy
+           only of the pages it modifies, and grayscale images stay backed by
+           the file. Otherwise (or if the mapping fails) the data are copied,
+           swizzled in the same pass. */
+        if(!_filename.empty()) {
+            Containers::Optional<Containers::Array<char>> mapped = Magnum::Implementation::mapFile(_filename, sizeof(Implementation::TgaHeader), dataSize);
+            if(mapped) data = std::move(*mapped);
+        }
+        inPlace = data;
+        in = inPlace ? data.data() : _in + sizeof(Implementation::TgaHeader);
+        if(!inPlace) data = Containers::Array<char>{Containers::NoInit, dataSize};
+    }
 
     /* Adjust pixel storage if row size is not four byte aligned */
     PixelStorage storage;
     if((size.x()*header.bpp/8)%4 != 0)
         storage.setAlignment(1);
 
-    if(format == PixelFormat::RGB8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == PixelFormat::RGBA8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
-    }
+    if(format == PixelFormat::RGB8Unorm)
+        Implementation::swizzleBgr(in, data, size.product());
+    else if(format == PixelFormat::RGBA8Unorm)
+        Implementation::swizzleBgra(in, data, size.product());
+    else if(!inPlace) std::copy_n(in, dataSize, data.begin());
 
     return ImageData2D{storage, format, size, std::move(data)};
 }
@@ -57,8 +57,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief TGA importer plugin
 
-Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed BGR,
-BGRA or grayscale images with 8 bits per channel.
+Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed and
+RLE-compressed BGR, BGRA or grayscale images with 8 bits per channel.
 
 This plugin depends on the @ref Trade library and is built if `WITH_TGAIMPORTER`
 is enabled when building Magnum. To use as a dynamic plugin, you need to load
@@ -72,6 +72,29 @@ The images are imported with @ref PixelFormat::RGB8Unorm,
 @ref PixelFormat::RGBA8Unorm or @ref PixelFormat::R8Unorm, respectively. Images
 are imported with default @ref PixelStorage parameters except for alignment,
 which may be changed to `1` if the data require it.
+
+The BGR(A) to RGB(A) conversion is vectorized with SSE2 and AVX2 for four-channel
+images and with SSSE3 for three-channel images, if the plugin is compiled with
+the corresponding instruction sets enabled. RLE packets crossing row
+boundaries are accepted as well.
+
+@section Trade-TgaImporter-mmap Memory-mapped import
+
+On Unix platforms, files opened through @ref openFile() are memory-mapped
+instead of being read into memory. The pixel data returned from
+@ref image2D() are then a private mapping of the file --- no copy is made for
+grayscale images and color images are swizzled in place, copying only the
+memory pages that get modified. In comparison, @ref openData() makes a copy of
+the input and each @ref image2D() call then makes a second, swizzled copy in a
+single pass. The mapped data are released by code from the plugin binary, so
+the plugin has to stay loaded for as long as the returned images exist. Set
+the @cb{.ini} mmap @ce configuration option to @cpp false @ce to always read
+the whole file instead, which is also what happens if file callbacks are set
+or the file can't be mapped.
+
+@snippet MagnumPlugins/TgaImporter/TgaImporter.conf config
+
+See @ref plugins-configuration for more information.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -87,11 +110,14 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         Features MAGNUM_TGAIMPORTER_LOCAL doFeatures() const override;
         bool MAGNUM_TGAIMPORTER_LOCAL doIsOpened() const override;
         void MAGNUM_TGAIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_TGAIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
         void MAGNUM_TGAIMPORTER_LOCAL doClose() override;
         UnsignedInt MAGNUM_TGAIMPORTER_LOCAL doImage2DCount() const override;
         Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
 
         Containers::Array<char> _in;
+        /* Set if _in is mapped from a file */
+        std::string _filename;
 };
 
 }}
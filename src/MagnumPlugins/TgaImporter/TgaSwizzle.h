@@ -0,0 +1,113 @@
+#ifndef Magnum_Trade_TgaSwizzle_h
+#define Magnum_Trade_TgaSwizzle_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/* Exchanges the first and third channel of 24- and 32-bit pixels, converting
+   BGR(A) to RGB(A) and back. Input and output can be the same memory. The
+   vectorized variants are picked at compile time based on the instruction
+   sets the compiler is allowed to use. */
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+inline void swizzleBgra(const char* in, char* out, std::size_t pixelCount) {
+    std::size_t i = 0;
+
+    /* Swap bytes 0 and 2 in each 32-bit lane */
+    #ifdef __AVX2__
+    const __m256i mask256 = _mm256_set1_epi32(int(0xff00ff00));
+    const __m256i low256 = _mm256_set1_epi32(0x000000ff);
+    for(; i + 8 <= pixelCount; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i*4));
+        const __m256i swapped = _mm256_or_si256(
+            _mm256_and_si256(v, mask256),
+            _mm256_or_si256(
+                _mm256_and_si256(_mm256_srli_epi32(v, 16), low256),
+                _mm256_slli_epi32(_mm256_and_si256(v, low256), 16)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i*4), swapped);
+    }
+    #endif
+
+    #ifdef __SSE2__
+    const __m128i mask128 = _mm_set1_epi32(int(0xff00ff00));
+    const __m128i low128 = _mm_set1_epi32(0x000000ff);
+    for(; i + 4 <= pixelCount; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i*4));
+        const __m128i swapped = _mm_or_si128(
+            _mm_and_si128(v, mask128),
+            _mm_or_si128(
+                _mm_and_si128(_mm_srli_epi32(v, 16), low128),
+                _mm_slli_epi32(_mm_and_si128(v, low128), 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i*4), swapped);
+    }
+    #endif
+
+    for(; i != pixelCount; ++i) {
+        const char b = in[i*4 + 0];
+        out[i*4 + 0] = in[i*4 + 2];
+        out[i*4 + 1] = in[i*4 + 1];
+        out[i*4 + 2] = b;
+        out[i*4 + 3] = in[i*4 + 3];
+    }
+}
+
+inline void swizzleBgr(const char* in, char* out, std::size_t pixelCount) {
+    std::size_t i = 0;
+
+    /* Five pixels in each 16-byte block, the last byte is passed through. It
+       belongs to the next pixel, so the loop stops while there's at least one
+       whole pixel after the block to overwrite it with a correct value later
+       (or, for in-place operation, to not write past the end). */
+    #ifdef __SSSE3__
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    for(; i + 6 <= pixelCount; i += 5) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i*3), _mm_shuffle_epi8(v, shuffle));
+    }
+    #endif
+
+    for(; i != pixelCount; ++i) {
+        const char b = in[i*3 + 0];
+        out[i*3 + 0] = in[i*3 + 2];
+        out[i*3 + 1] = in[i*3 + 1];
+        out[i*3 + 2] = b;
+    }
+}
+
+}}}
+
+#endif
@@ -0,0 +1,165 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Alice Margatroid <loveoverwhelming@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "MagnumPlugins/WavAudioImporter/WavHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct WavImporterBenchmark: TestSuite::Tester {
+    explicit WavImporterBenchmark();
+
+    void openFileMapped();
+    void openFileRead();
+
+    #ifdef __linux__
+    void peakMemoryBegin();
+    std::uint64_t peakMemoryEnd();
+    #endif
+
+    private:
+        void load(bool mmap);
+
+        std::string _filename;
+        #ifdef __linux__
+        std::uint64_t _memoryBegin{};
+        #endif
+
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+/* 64 MB of 16-bit stereo samples, about six minutes at 44.1 kHz */
+constexpr std::size_t SampleCount = 16*1024*1024;
+
+WavImporterBenchmark::WavImporterBenchmark() {
+    addBenchmarks({&WavImporterBenchmark::openFileMapped,
+                   &WavImporterBenchmark::openFileRead}, 5);
+
+    /* Peak memory use, measurable only on Linux */
+    #ifdef __linux__
+    addCustomBenchmarks({&WavImporterBenchmark::openFileMapped,
+                         &WavImporterBenchmark::openFileRead}, 1,
+        &WavImporterBenchmark::peakMemoryBegin,
+        &WavImporterBenchmark::peakMemoryEnd,
+        BenchmarkUnits::Bytes);
+    #endif
+
+    #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(WAVAUDIOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    using namespace Implementation;
+
+    const std::size_t headerSize = sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk);
+    Containers::Array<char> data{Containers::ValueInit, headerSize + SampleCount*4};
+
+    auto& header = *reinterpret_cast<WavHeaderChunk*>(data.data());
+    std::memcpy(header.chunk.chunkId, "RIFF", 4);
+    header.chunk.chunkSize = Utility::Endianness::littleEndian(UnsignedInt(data.size() - 8));
+    std::memcpy(header.format, "WAVE", 4);
+
+    auto& format = *reinterpret_cast<WavFormatChunk*>(data.data() + sizeof(WavHeaderChunk));
+    std::memcpy(format.chunk.chunkId, "fmt ", 4);
+    format.chunk.chunkSize = Utility::Endianness::littleEndian(UnsignedInt(sizeof(WavFormatChunk) - sizeof(RiffChunk)));
+    format.audioFormat = WavAudioFormat(Utility::Endianness::littleEndian(UnsignedShort(WavAudioFormat::Pcm)));
+    format.numChannels = Utility::Endianness::littleEndian(UnsignedShort(2));
+    format.sampleRate = Utility::Endianness::littleEndian(UnsignedInt(44100));
+    format.byteRate = Utility::Endianness::littleEndian(UnsignedInt(44100*4));
+    format.blockAlign = Utility::Endianness::littleEndian(UnsignedShort(4));
+    format.bitsPerSample = Utility::Endianness::littleEndian(UnsignedShort(16));
+
+    auto& samples = *reinterpret_cast<RiffChunk*>(data.data() + sizeof(WavHeaderChunk) + sizeof(WavFormatChunk));
+    std::memcpy(samples.chunkId, "data", 4);
+    samples.chunkSize = Utility::Endianness::littleEndian(UnsignedInt(SampleCount*4));
+    for(std::size_t i = headerSize; i != data.size(); ++i)
+        data[i] = char(i*7);
+
+    Utility::Directory::mkpath(WAVAUDIOIMPORTER_TEST_WRITE_DIR);
+    _filename = Utility::Directory::join(WAVAUDIOIMPORTER_TEST_WRITE_DIR, "benchmark.wav");
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::write(_filename, data));
+}
+
+#ifdef __linux__
+/* Value of given memory field in /proc/self/status, converted to bytes */
+std::uint64_t processMemory(const char* const field) {
+    std::ifstream in{"/proc/self/status"};
+    const std::size_t fieldSize = std::strlen(field);
+    std::string line;
+    while(std::getline(in, line))
+        if(line.compare(0, fieldSize, field) == 0)
+            return std::stoull(line.substr(fieldSize))*1024;
+    return 0;
+}
+
+void WavImporterBenchmark::peakMemoryBegin() {
+    /* Writing 5 to clear_refs resets VmHWM to the current VmRSS */
+    std::ofstream{"/proc/self/clear_refs"} << "5";
+    _memoryBegin = processMemory("VmRSS:");
+}
+
+std::uint64_t WavImporterBenchmark::peakMemoryEnd() {
+    return processMemory("VmHWM:") - _memoryBegin;
+}
+#endif
+
+void WavImporterBenchmark::openFileMapped() { load(true); }
+
+void WavImporterBenchmark::openFileRead() { load(false); }
+
+void WavImporterBenchmark::load(const bool mmap) {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    importer->configuration().setValue("mmap", mmap);
+
+    /* Touch every page of the samples, as a consumer of the data would,
+       otherwise the mapped data wouldn't get faulted in at all */
+    Containers::Array<char> data;
+    UnsignedInt checksum = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openFile(_filename));
+        data = importer->data();
+        for(std::size_t i = 0; i < data.size(); i += 4096)
+            checksum += UnsignedByte(data[i]);
+    }
+
+    CORRADE_COMPARE(importer->format(), BufferFormat::Stereo16);
+    CORRADE_COMPARE(data.size(), SampleCount*4);
+    CORRADE_VERIFY(checksum);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterBenchmark)
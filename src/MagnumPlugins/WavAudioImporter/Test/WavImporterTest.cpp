@@ -28,6 +28,7 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
@@ -36,6 +37,14 @@
 
 namespace Magnum { namespace Audio { namespace Test { namespace {
 
+constexpr struct {
+    const char* name;
+    bool mmap;
+} OpenFileData[] {
+    {"mapped", true},
+    {"read", false}
+};
+
 struct WavImporterTest: TestSuite::Tester {
     explicit WavImporterTest();
 
@@ -72,6 +81,8 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void openFile();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -110,6 +121,9 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::surround51Channel16,
               &WavImporterTest::surround71Channel24});
 
+    addInstancedTests({&WavImporterTest::openFile},
+        Containers::arraySize(OpenFileData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
@@ -421,6 +435,36 @@ void WavImporterTest::surround71Channel24() {
     CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
+void WavImporterTest::openFile() {
+    auto&& data = OpenFileData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    importer->configuration().setValue("mmap", data.mmap);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8junk.wav")));
+
+    CORRADE_COMPARE(importer->format(), BufferFormat::Mono8);
+    CORRADE_COMPARE(importer->frequency(), 22050);
+
+    Containers::Array<char> first = importer->data();
+    Containers::Array<char> second = importer->data();
+
+    /* The data should stay valid after the importer is gone */
+    importer = nullptr;
+
+    /* The file has a junk chunk before the data, so they don't start at a
+       page boundary */
+    const Containers::Array<char> file = Utility::Directory::read(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8junk.wav"));
+    const auto expected = Containers::arrayView(file).suffix(0x44);
+    CORRADE_COMPARE_AS(first, expected,
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+
+    /* Modifying the data shouldn't affect the other array */
+    first[0] = 0;
+    CORRADE_COMPARE_AS(second, expected,
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -25,3 +25,4 @@
 
 #cmakedefine WAVAUDIOIMPORTER_PLUGIN_FILENAME "${WAVAUDIOIMPORTER_PLUGIN_FILENAME}"
 #define WAVAUDIOIMPORTER_TEST_DIR "${WAVAUDIOIMPORTER_TEST_DIR}"
+#define WAVAUDIOIMPORTER_TEST_WRITE_DIR "${WAVAUDIOIMPORTER_TEST_WRITE_DIR}"
@@ -27,9 +27,11 @@
 #include "WavImporter.h"
 
 #include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/Endianness.h>
 
+#include "MagnumPlugins/Implementation/mappedFile.h"
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
 namespace Magnum { namespace Audio {
@@ -45,13 +47,42 @@ WavImporter::WavImporter(PluginManager::AbstractManager& manager, const std::str
 
 auto WavImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
-bool WavImporter::doIsOpened() const { return _data; }
+bool WavImporter::doIsOpened() const { return _in; }
 
 void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    const Containers::Optional<Containers::ArrayView<const char>> samples = parse(data);
+    if(!samples) return;
+
+    /* Copy the data */
+    _in = Containers::Array<char>{Containers::NoInit, samples->size()};
+    std::copy(samples->begin(), samples->end(), _in.begin());
+    _data = _in;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    /* Map the file instead of reading it and reference the samples in place.
+       If mapping is not possible, fall back to the default implementation. */
+    if(configuration().value<bool>("mmap")) {
+        Containers::Optional<Containers::Array<char>> mapped = Magnum::Implementation::mapFile(filename);
+        if(mapped) {
+            const Containers::Optional<Containers::ArrayView<const char>> samples = parse(*mapped);
+            if(!samples) return;
+
+            _in = std::move(*mapped);
+            _data = *samples;
+            _filename = filename;
+            return;
+        }
+    }
+
+    AbstractImporter::doOpenFile(filename);
+}
+
+Containers::Optional<Containers::ArrayView<const char>> WavImporter::parse(Containers::ArrayView<const char> data) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Get the RIFF/WAV header */
@@ -61,7 +92,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        return Containers::NullOpt;
     }
 
     Utility::Endianness::littleEndianInPlace(header.chunk.chunkSize);
@@ -70,7 +101,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
         Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return Containers::NullOpt;
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -88,7 +119,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                return Containers::NullOpt;
             }
 
             formatChunk = reinterpret_cast<const WavFormatChunk*>(currChunk);
@@ -96,7 +127,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                return Containers::NullOpt;
             }
 
             dataChunk = currChunk;
@@ -109,13 +140,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /* Make sure we actually got a format chunk */
     if(formatChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Fix endianness on Format chunk */
@@ -139,7 +170,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check IEEE Float format */
@@ -156,7 +187,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check A-Law format */
@@ -169,7 +200,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check μ-Law format */
@@ -182,26 +213,26 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Unknown/unimplemented format */
     } else {
         Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        return Containers::NullOpt;
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
         Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Save frequency */
@@ -210,21 +241,29 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /** @todo Convert the data from little endian too */
     CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
 
-    /* Copy the data */
-    const char* dataChunkPtr = reinterpret_cast<const char*>(dataChunk + 1);
-    _data = Containers::Array<char>(dataChunkSize);
-    std::copy(dataChunkPtr, dataChunkPtr+dataChunkSize, _data.begin());
-    return;
+    return Containers::ArrayView<const char>{reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize};
 }
 
-void WavImporter::doClose() { _data = nullptr; }
+void WavImporter::doClose() {
+    _in = nullptr;
+    _data = nullptr;
+    _filename = {};
+}
 
 BufferFormat WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy(_data.size());
+    /* If the file is mapped, map the samples once more instead of copying
+       them, so the returned array doesn't depend on the importer. Copy if that
+       fails, e.g. because the file was deleted in the meantime. */
+    if(!_filename.empty()) {
+        Containers::Optional<Containers::Array<char>> mapped = Magnum::Implementation::mapFile(_filename, _data.data() - _in.data(), _data.size());
+        if(mapped) return std::move(*mapped);
+    }
+
+    Containers::Array<char> copy{Containers::NoInit, _data.size()};
     std::copy(_data.begin(), _data.end(), copy.begin());
     return copy;
 }
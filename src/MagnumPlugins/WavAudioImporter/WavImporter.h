@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -83,6 +84,21 @@ a dependency of another plugin with CMake, you need to request the
 @section Audio-WavImporter-limitations Behavior and limitations
 
 Multi-channel formats are not supported.
+
+@section Audio-WavImporter-mmap Memory-mapped import
+
+On Unix platforms, files opened through @ref openFile() are memory-mapped
+instead of being read into memory and @ref data() returns a private mapping of
+the sample data, without making any copy. In comparison, @ref openData()
+copies the sample data and each @ref data() call then makes another copy. The
+mapped data are released by code from the plugin binary, so the plugin has to
+stay loaded for as long as the returned arrays exist. Set the
+@cb{.ini} mmap @ce configuration option to @cpp false @ce to always read the
+whole file instead, which is also what happens if the file can't be mapped.
+
+@snippet MagnumPlugins/WavAudioImporter/WavAudioImporter.conf config
+
+See @ref plugins-configuration for more information.
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
     public:
@@ -96,13 +112,20 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Features doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
 
-        Containers::Array<char> _data;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Optional<Containers::ArrayView<const char>> parse(Containers::ArrayView<const char> data);
+
+        /* Either a copy of the samples or the whole file, if it's mapped */
+        Containers::Array<char> _in;
+        Containers::ArrayView<const char> _data;
+        /* Set if _in is mapped from a file */
+        std::string _filename;
         BufferFormat _format;
         UnsignedInt _frequency;
 };